@@ -1,9 +1,35 @@
 #include <include/CppDoublyLinkedList.hpp>
+#include <include/CppUnrolledDoublyLinkedList.hpp>
+#include <include/CppSkipDoublyLinkedList.hpp>
+#include <include/CppConcurrentDoublyLinkedList.hpp>
+#include <include/CppFineGrainedDoublyLinkedList.hpp>
+#include <include/CppSpscDoublyLinkedList.hpp>
+#include <include/CppIntrusiveDoublyLinkedList.hpp>
+#include <include/CppXorDoublyLinkedList.hpp>
+#include <include/CppIndexedDoublyLinkedList.hpp>
+#include <include/CppStaticDoublyLinkedList.hpp>
+#include <include/CppDoublyLinkedListParallel.hpp>
+#include <include/CppDoublyLinkedListSerialization.hpp>
+#include <include/CppMappedDoublyLinkedList.hpp>
+#include <include/CppSharedDoublyLinkedList.hpp>
 #include <include/CppCommon.hpp>
 
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <cstdio>
 #include <cstring>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <sys/wait.h>
 
 ///////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////
@@ -21,6 +47,30 @@ const unsigned int rangeMax = 1u << 10u;
  * Range multiplier
  */
 const unsigned int rangeMultiplier = 2u;
+/**
+ * Minimal length of tiny container, for sweep below rangeMin.
+ */
+const unsigned int tinyRangeMin = 1u;
+/**
+ * Maximal length of tiny container.
+ */
+const unsigned int tinyRangeMax = rangeMin;
+/**
+ * Number of items kept inside the list object by CSmallDoublyLinkedList.
+ */
+const unsigned int inlineItems = 8u;
+/**
+ * Minimal length of large container, which doesn't fit in cache.
+ */
+const unsigned int rangeLargeMin = 1u << 16u;
+/**
+ * Maximal length of large container.
+ */
+const unsigned int rangeLargeMax = 1u << 22u;
+/**
+ * Range multiplier for large containers.
+ */
+const unsigned int rangeLargeMultiplier = 4u;
 
 
 const unsigned int oneObjectSizeBytes1 = 1u;
@@ -46,6 +96,7 @@ const benchmark::BigO complexityPushBack = benchmark::oAuto;
 /**
  * @brief Fills container with objects. Adds items to the end.
  * @tparam T type of object.
+ * @tparam TAllocator Allocator of the container.
  * @param aContainer Container to fill.
  * @param aSize Number of items to fill.
  * @return Size of container. Required return value by benchmark.
@@ -53,11 +104,11 @@ const benchmark::BigO complexityPushBack = benchmark::oAuto;
  * while optimizing - it could detect that method doesn't have
  * side effect, so it can throw away.
  */
-template<unsigned int TSize>
+template<unsigned int TSize, typename TAllocator = CDoublyLinkedListPoolAllocator<CObject<TSize>>>
 unsigned int pushBack(unsigned int aSize)
 {
     using Type = CObject<TSize>;
-    CDoublyLinkedList<Type> container;
+    CDoublyLinkedList<Type, TAllocator> container;
     for (unsigned int i = 0; i < aSize; ++i)
     {
       Type item(i);
@@ -130,6 +181,92 @@ BENCHMARK_TEMPLATE(doubly_linked_list_pushBack, oneObjectSizeBytes16384)
 BENCHMARK_TEMPLATE(doubly_linked_list_pushBack, oneObjectSizeBytes32768)
 ->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
 
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Benchmark method. Reference for doubly_linked_list_pushBack, every item is allocated on the global heap.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void doubly_linked_list_pushBack_heap(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(pushBack<TSize, std::allocator<CObject<TSize>>>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_heap, oneObjectSizeBytes1)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_heap, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_heap, oneObjectSizeBytes8)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_heap, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_heap, oneObjectSizeBytes512)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Fills request scoped container with objects. Items are taken from a monotonic buffer
+ * and the container is thrown away without visiting its items.
+ * @tparam TSize size object.
+ * @param aSize Number of items to fill.
+ * @return Size of container.
+ */
+template<unsigned int TSize>
+unsigned int pushBackMonotonic(unsigned int aSize)
+{
+    using Type = CObject<TSize>;
+    std::pmr::monotonic_buffer_resource resource;
+    CPmrDoublyLinkedList<Type> container(&resource);
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+      Type item(i);
+      container.pushBack(item);
+    }
+    const unsigned int size = container.size();
+    container.release();
+    return size;
+}
+
+/**
+ * @brief Benchmark method.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void doubly_linked_list_pushBack_monotonic(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(pushBackMonotonic<TSize>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_monotonic, oneObjectSizeBytes1)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_monotonic, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_monotonic, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushBack_monotonic, oneObjectSizeBytes512)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
 ////////////////////////////////////////////////////////////////////
 /////////////////////////// PUSH_FRONT /////////////////////////////
 
@@ -141,17 +278,18 @@ const benchmark::BigO complexityPushFront = benchmark::oAuto;
 /**
  * @brief Fills container with objects. Adds items at the beginning side.
  * @tparam TSize size object.
+ * @tparam TAllocator Allocator of the container.
  * @param aSize Number of items to fill.
  * @return Size of container. Required return value by benchmark.
  * Without return value, compiler can remove method completely
  * while optimizing - it could detect that method doesn't have
  * side effect, so it can throw away.
  */
-template<unsigned int TSize>
+template<unsigned int TSize, typename TAllocator = CDoublyLinkedListPoolAllocator<CObject<TSize>>>
 unsigned int pushFront(unsigned int aSize)
 {
     using Type = CObject<TSize>;
-    CDoublyLinkedList<Type> container;
+    CDoublyLinkedList<Type, TAllocator> container;
     for (unsigned int i = 0; i < aSize; ++i)
     {
       Type item(i);
@@ -223,6 +361,41 @@ BENCHMARK_TEMPLATE(doubly_linked_list_pushFront, oneObjectSizeBytes16384)
 BENCHMARK_TEMPLATE(doubly_linked_list_pushFront, oneObjectSizeBytes32768)
 ->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
 
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Benchmark method. Reference for doubly_linked_list_pushFront, every item is allocated on the global heap.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void doubly_linked_list_pushFront_heap(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    const unsigned int valueCast = static_cast<unsigned int>(value);
+
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(pushFront<TSize, std::allocator<CObject<TSize>>>(valueCast));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushFront_heap, oneObjectSizeBytes1)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushFront_heap, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushFront_heap, oneObjectSizeBytes8)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushFront_heap, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_pushFront_heap, oneObjectSizeBytes512)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
 /////////////////////////////////////////////////////////////////
 /////////////////////////// GET /////////////////////////////////
 
@@ -334,6 +507,2144 @@ BENCHMARK_TEMPLATE(doubly_linked_list_get, oneObjectSizeBytes1024, 25u)
 BENCHMARK_TEMPLATE(doubly_linked_list_get, oneObjectSizeBytes16384, 25u)
 ->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet25);
 
+///////////////////////////////////////////////////////////////////
+/////////////////////////// UNROLLED //////////////////////////////
+
+/**
+ * Number of items in one node of unrolled list.
+ */
+const std::size_t unrolledNodeCapacity = 16u;
+
+/**
+ * @brief Fills unrolled container with objects. Adds items to the end.
+ * @tparam TSize size object.
+ * @param aSize Number of items to fill.
+ * @return Size of container.
+ */
+template<unsigned int TSize>
+unsigned int unrolledPushBack(unsigned int aSize)
+{
+    using Type = CObject<TSize>;
+    CUnrolledDoublyLinkedList<Type, unrolledNodeCapacity> container;
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+      Type item(i);
+      container.pushBack(item);
+    }
+    return container.size();
+}
+
+/**
+ * @brief Benchmark method.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void unrolled_doubly_linked_list_pushBack(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(unrolledPushBack<TSize>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushBack, oneObjectSizeBytes1)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushBack, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushBack, oneObjectSizeBytes8)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushBack, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Fills unrolled container with objects. Adds items at the beginning side.
+ * @tparam TSize size object.
+ * @param aSize Number of items to fill.
+ * @return Size of container.
+ */
+template<unsigned int TSize>
+unsigned int unrolledPushFront(unsigned int aSize)
+{
+    using Type = CObject<TSize>;
+    CUnrolledDoublyLinkedList<Type, unrolledNodeCapacity> container;
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+      Type item(i);
+      container.pushFront(item);
+    }
+    return container.size();
+}
+
+/**
+ * @brief Benchmark method.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void unrolled_doubly_linked_list_pushFront(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(unrolledPushFront<TSize>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushFront, oneObjectSizeBytes1)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushFront, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushFront, oneObjectSizeBytes8)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_pushFront, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushFront);
+
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Benchmark for get method of unrolled list.
+ * @tparam TSizeObject Size of objects
+ * @tparam TPercentage Factor used to calculate index for get method.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSizeObject, unsigned int TPercentage>
+void unrolled_doubly_linked_list_get(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CUnrolledDoublyLinkedList<CObject<TSizeObject>, unrolledNodeCapacity> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(CObject<TSizeObject>(i));
+    }
+    const float factor = static_cast<float>(TPercentage) / 100.0f;
+    const float part = (container.size() - 1u) * factor;
+
+    const unsigned int index = static_cast<unsigned int>(std::round(part));
+
+    aState.SetComplexityN(index);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(container.get(index));
+    }
+}
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes1, 50u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet50);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes4, 50u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet50);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes16, 50u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet50);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes1, 25u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet25);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes4, 25u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet25);
+
+BENCHMARK_TEMPLATE(unrolled_doubly_linked_list_get, oneObjectSizeBytes16, 25u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityGet25);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// MOVE / EMPLACE ////////////////////////
+
+/**
+ * @brief Payload which owns heap memory, so copying it is a deep copy.
+ */
+using CHeavyObject = std::vector<unsigned char>;
+
+/**
+ * @brief How the payload is put into the list.
+ */
+enum class EInsertMode
+{
+    Copy,
+    Move,
+    Emplace
+};
+
+/**
+ * @brief Fills container with heavy objects and takes them out again.
+ * @tparam TSize size of payload.
+ * @tparam TMode How the payload is put into the list.
+ * @param aSize Number of items to fill.
+ * @return Sum of first bytes of removed payloads.
+ */
+template<unsigned int TSize, EInsertMode TMode>
+unsigned int pushBackPopFrontHeavy(unsigned int aSize)
+{
+    using Type = CHeavyObject;
+    CDoublyLinkedList<Type> container;
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+        if (TMode == EInsertMode::Emplace)
+        {
+            container.emplaceBack(TSize, static_cast<unsigned char>(i));
+        }
+        else
+        {
+            Type item(TSize, static_cast<unsigned char>(i));
+            if (TMode == EInsertMode::Move)
+            {
+                container.pushBack(std::move(item));
+            }
+            else
+            {
+                container.pushBack(item);
+            }
+        }
+    }
+
+    unsigned int sum = 0;
+    while (!container.empty())
+    {
+        sum += container.popFront()[0];
+    }
+    return sum;
+}
+
+/**
+ * @brief Benchmark method.
+ * @tparam TSize size of payload.
+ * @tparam TMode How the payload is put into the list.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize, EInsertMode TMode>
+void doubly_linked_list_heavy_pushBack_popFront(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(pushBackPopFrontHeavy<TSize, TMode>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16, EInsertMode::Copy)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16, EInsertMode::Move)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16, EInsertMode::Emplace)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes1024, EInsertMode::Copy)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes1024, EInsertMode::Move)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes1024, EInsertMode::Emplace)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16384, EInsertMode::Copy)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16384, EInsertMode::Move)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_heavy_pushBack_popFront, oneObjectSizeBytes16384, EInsertMode::Emplace)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(complexityPushBack);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// VECTOR OF LISTS ///////////////////////
+
+/**
+ * @brief Builds a list in a function and returns it.
+ * @tparam TSize size object.
+ * @param aSize Number of items.
+ * @return List.
+ */
+template<unsigned int TSize>
+CDoublyLinkedList<CObject<TSize>> makeList(unsigned int aSize)
+{
+    CDoublyLinkedList<CObject<TSize>> container;
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+        container.pushBack(CObject<TSize>(i));
+    }
+    return container;
+}
+
+/**
+ * @brief Benchmark for storing lists in a vector. Lists are moved when the vector grows.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize>
+void doubly_linked_list_vector_of_lists(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    const unsigned int listSize = 64u;
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        std::vector<CDoublyLinkedList<CObject<TSize>>> lists;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            lists.push_back(makeList<TSize>(listSize));
+        }
+        benchmark::DoNotOptimize(lists.data());
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_vector_of_lists, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oAuto);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_vector_of_lists, oneObjectSizeBytes512)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oAuto);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// SKIP LIST /////////////////////////////
+
+/**
+ * @brief Benchmark method. Reads item placed at given percentage of skip list length.
+ * @tparam TSizeObject size object.
+ * @tparam TPercentage Position of item in percent of container size.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSizeObject, unsigned int TPercentage>
+void skip_doubly_linked_list_get(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CSkipDoublyLinkedList<CObject<TSizeObject>> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(CObject<TSizeObject>(i));
+    }
+    const float factor = static_cast<float>(TPercentage) / 100.0f;
+    const float part = (container.size() - 1u) * factor;
+
+    const unsigned int index = static_cast<unsigned int>(std::round(part));
+
+    aState.SetComplexityN(index);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(container.get(index));
+    }
+}
+
+BENCHMARK_TEMPLATE(skip_doubly_linked_list_get, oneObjectSizeBytes4, 25u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oLogN);
+
+BENCHMARK_TEMPLATE(skip_doubly_linked_list_get, oneObjectSizeBytes4, 50u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oLogN);
+
+BENCHMARK_TEMPLATE(skip_doubly_linked_list_get, oneObjectSizeBytes4, 75u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oLogN);
+
+BENCHMARK_TEMPLATE(skip_doubly_linked_list_get, oneObjectSizeBytes4, 100u)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oLogN);
+
+///////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Benchmark method. Inserts item in the middle and removes it again.
+ * @tparam TContainer Container type.
+ * @tparam TSizeObject size object.
+ * @param aState Benchmark state.
+ */
+template<typename TContainer, unsigned int TSizeObject>
+void doubly_linked_list_insert_eraseAt_middle(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    TContainer container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(CObject<TSizeObject>(i));
+    }
+    const unsigned int index = size / 2u;
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        container.insert(index, CObject<TSizeObject>(index));
+        benchmark::DoNotOptimize(container.eraseAt(index));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_insert_eraseAt_middle, CDoublyLinkedList<CObject<oneObjectSizeBytes4>>, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_insert_eraseAt_middle, CSkipDoublyLinkedList<CObject<oneObjectSizeBytes4>>, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oLogN);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// ACCESS PATTERNS ///////////////////////
+
+/**
+ * @brief Order in which positions are read.
+ */
+enum class EAccessPattern
+{
+    Sequential,
+    Strided,
+    Random
+};
+
+/**
+ * Distance between two reads in strided pattern.
+ */
+const unsigned int accessStride = 7u;
+
+/**
+ * @brief Creates positions to read.
+ * @tparam TPattern Order of positions.
+ * @param aSize Size of container.
+ * @return Positions, one per item of container.
+ */
+template<EAccessPattern TPattern>
+std::vector<unsigned int> makeAccessIndexes(unsigned int aSize)
+{
+    std::vector<unsigned int> indexes(aSize);
+    std::mt19937 generator(aSize);
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+        if (TPattern == EAccessPattern::Sequential)
+        {
+            indexes[i] = i;
+        }
+        else if (TPattern == EAccessPattern::Strided)
+        {
+            indexes[i] = (i * accessStride) % aSize;
+        }
+        else
+        {
+            indexes[i] = generator() % aSize;
+        }
+    }
+    return indexes;
+}
+
+/**
+ * @brief Benchmark method. Reads every item once by position in given order.
+ * @tparam TSizeObject size object.
+ * @tparam TPattern Order of positions.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSizeObject, EAccessPattern TPattern>
+void doubly_linked_list_get_pattern(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<CObject<TSizeObject>> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(CObject<TSizeObject>(i));
+    }
+    const std::vector<unsigned int> indexes = makeAccessIndexes<TPattern>(size);
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        for (unsigned int index : indexes)
+        {
+            benchmark::DoNotOptimize(container.get(index));
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_get_pattern, oneObjectSizeBytes4, EAccessPattern::Sequential)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_get_pattern, oneObjectSizeBytes4, EAccessPattern::Strided)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_get_pattern, oneObjectSizeBytes4, EAccessPattern::Random)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNSquared);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// CONTAINS //////////////////////////////
+
+/**
+ * @brief Memory resource which counts bytes taken from the upstream resource.
+ */
+class CCountingResource : public std::pmr::memory_resource
+{
+public:
+
+    std::size_t mBytes = 0;
+
+private:
+
+    void* do_allocate(std::size_t aBytes, std::size_t aAlignment) override
+    {
+        mBytes += aBytes;
+        return std::pmr::new_delete_resource()->allocate(aBytes, aAlignment);
+    }
+
+    void do_deallocate(void* aPtr, std::size_t aBytes, std::size_t aAlignment) override
+    {
+        mBytes -= aBytes;
+        std::pmr::new_delete_resource()->deallocate(aPtr, aBytes, aAlignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& aOther) const noexcept override
+    {
+        return (this == &aOther);
+    }
+};
+
+/**
+ * @brief Benchmark method. Looks for every value once, half of them are not in the list.
+ * Reports memory taken by the list and its index per item as counter.
+ * @tparam TLookupPolicy Lookup policy of the list.
+ * @param aState Benchmark state.
+ */
+template<typename TLookupPolicy>
+void doubly_linked_list_contains(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CCountingResource resource;
+    CDoublyLinkedList<unsigned int, std::pmr::polymorphic_allocator<unsigned int>, TLookupPolicy> container(&resource);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(2u * i);
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            benchmark::DoNotOptimize(container.contains(i));
+        }
+    }
+    aState.counters["bytesPerItem"] = static_cast<double>(resource.mBytes) / size;
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_contains, CNoLookupPolicy)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNSquared);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_contains, CHashLookupPolicy<>)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// SORT //////////////////////////////////
+
+/**
+ * @brief Payload of given size with a key to sort by.
+ * @tparam TSize size of payload.
+ */
+template<unsigned int TSize>
+struct CSortObject
+{
+    explicit CSortObject(unsigned int aKey)
+        : mKey(aKey)
+        , mObject(aKey)
+    {}
+
+    bool operator<(const CSortObject& aOther) const
+    {
+        return (mKey < aOther.mKey);
+    }
+
+    unsigned int mKey;
+    CObject<TSize> mObject;
+};
+
+/**
+ * @brief How the list is sorted.
+ */
+enum class ESortMode
+{
+    Relink,
+    VectorRoundTrip
+};
+
+/**
+ * @brief Benchmark method. Sorts list of shuffled keys. The list is rebuilt outside of measured time.
+ * @tparam TSize size of payload.
+ * @tparam TMode How the list is sorted.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSize, ESortMode TMode>
+void doubly_linked_list_sort(benchmark::State& aState)
+{
+    using Type = CSortObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    const std::vector<unsigned int> keys = makeAccessIndexes<EAccessPattern::Random>(size);
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        aState.PauseTiming();
+        CDoublyLinkedList<Type> container;
+        for (unsigned int key : keys)
+        {
+            container.emplaceBack(key);
+        }
+        aState.ResumeTiming();
+
+        if (TMode == ESortMode::Relink)
+        {
+            container.sort();
+        }
+        else
+        {
+            std::vector<Type> values;
+            values.reserve(size);
+            for (const Type& value : container)
+            {
+                values.push_back(value);
+            }
+            std::stable_sort(values.begin(), values.end());
+            CDoublyLinkedList<Type> sorted;
+            for (const Type& value : values)
+            {
+                sorted.pushBack(value);
+            }
+            container = std::move(sorted);
+        }
+        benchmark::DoNotOptimize(container.get(0));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes4, ESortMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes4, ESortMode::VectorRoundTrip)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes16, ESortMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes16, ESortMode::VectorRoundTrip)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes512, ESortMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes512, ESortMode::VectorRoundTrip)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes2048, ESortMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes2048, ESortMode::VectorRoundTrip)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes16384, ESortMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_sort, oneObjectSizeBytes16384, ESortMode::VectorRoundTrip)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oNLogN);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// SPLICE ////////////////////////////////
+
+/**
+ * @brief How items are moved between lists.
+ */
+enum class ETransferMode
+{
+    Relink,
+    PopPush
+};
+
+/**
+ * @brief Benchmark method. Splits list in the middle and joins both halves again.
+ * @tparam TSize size object.
+ * @tparam TMode How items are moved between lists.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSize, ETransferMode TMode>
+void doubly_linked_list_split_append(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<Type> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(Type(i));
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        if (TMode == ETransferMode::Relink)
+        {
+            CDoublyLinkedList<Type> tail = container.splitAt(container.begin() + (size / 2u));
+            container.append(std::move(tail));
+        }
+        else
+        {
+            CDoublyLinkedList<Type> tail;
+            for (unsigned int i = 0; i < size - size / 2u; ++i)
+            {
+                tail.pushFront(container.popBack());
+            }
+            while (!tail.empty())
+            {
+                container.pushBack(tail.popFront());
+            }
+        }
+        benchmark::DoNotOptimize(container.get(0));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_split_append, oneObjectSizeBytes4, ETransferMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_split_append, oneObjectSizeBytes4, ETransferMode::PopPush)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_split_append, oneObjectSizeBytes1024, ETransferMode::Relink)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_split_append, oneObjectSizeBytes1024, ETransferMode::PopPush)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/**
+ * @brief Benchmark method. Builds two lists independently, each with its own allocator, and joins them.
+ * Pools of the default allocator are joined, so items are relinked like with std::allocator
+ * instead of being moved into new items of the first list.
+ * @tparam TSize size object.
+ * @tparam TAllocator Allocator of the lists.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSize, template<typename> class TAllocator>
+void doubly_linked_list_join_independent(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        CDoublyLinkedList<Type, TAllocator<Type>> container;
+        CDoublyLinkedList<Type, TAllocator<Type>> other;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(Type(i));
+            other.pushBack(Type(i));
+        }
+        container.append(std::move(other));
+        benchmark::DoNotOptimize(container.get(0));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_join_independent, oneObjectSizeBytes4, CDoublyLinkedListPoolAllocator)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_join_independent, oneObjectSizeBytes4, std::allocator)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_join_independent, oneObjectSizeBytes1024, CDoublyLinkedListPoolAllocator)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_join_independent, oneObjectSizeBytes1024, std::allocator)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// BULK LOAD /////////////////////////////
+
+/**
+ * @brief How list is filled from the source range.
+ */
+enum class ELoadMode
+{
+    Range,
+    PushBackLoop
+};
+
+/**
+ * @brief Benchmark method. Builds list from a vector of objects.
+ * @tparam TSize size object.
+ * @tparam TMode How list is filled from the source range.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSize, ELoadMode TMode>
+void doubly_linked_list_bulk_load(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    std::vector<Type> source;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        source.emplace_back(i);
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        if (TMode == ELoadMode::Range)
+        {
+            CDoublyLinkedList<Type> container(source.begin(), source.end());
+            benchmark::DoNotOptimize(container.size());
+        }
+        else
+        {
+            CDoublyLinkedList<Type> container;
+            for (const Type& value : source)
+            {
+                container.pushBack(value);
+            }
+            benchmark::DoNotOptimize(container.size());
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_bulk_load, oneObjectSizeBytes4, ELoadMode::Range)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_bulk_load, oneObjectSizeBytes4, ELoadMode::PushBackLoop)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_bulk_load, oneObjectSizeBytes512, ELoadMode::Range)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_bulk_load, oneObjectSizeBytes512, ELoadMode::PushBackLoop)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// WORK QUEUE ////////////////////////////
+
+/**
+ * Maximal number of threads sharing one queue.
+ */
+const int threadsMax = 8;
+
+/**
+ * @brief CDoublyLinkedList guarded by one mutex, reference for the concurrent list.
+ * @tparam T Type of items.
+ */
+template<typename T>
+class CMutexDoublyLinkedList
+{
+public:
+
+    void pushBack(const T& aValue)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mList.pushBack(aValue);
+    }
+
+    bool tryPopFront(T& aValue)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        if (mList.empty())
+        {
+            return false;
+        }
+        aValue = mList.popFront();
+        return true;
+    }
+
+private:
+
+    std::mutex mMutex;
+    CDoublyLinkedList<T> mList;
+};
+
+/**
+ * @brief Benchmark method. Every thread pushes a value to the shared queue and takes one from it.
+ * @tparam TQueue Type of queue.
+ * @param aState Benchmark state.
+ */
+template<typename TQueue>
+void doubly_linked_list_work_queue(benchmark::State& aState)
+{
+    static TQueue* queue = nullptr;
+    if (aState.thread_index() == 0)
+    {
+        queue = new TQueue();
+    }
+
+    int value = aState.thread_index();
+    while (aState.KeepRunning())
+    {
+        queue->pushBack(value);
+        benchmark::DoNotOptimize(queue->tryPopFront(value));
+    }
+    aState.SetItemsProcessed(aState.iterations());
+
+    if (aState.thread_index() == 0)
+    {
+        delete queue;
+        queue = nullptr;
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_work_queue, CConcurrentDoublyLinkedList<int>)
+->ThreadRange(1, threadsMax)->UseRealTime();
+
+BENCHMARK_TEMPLATE(doubly_linked_list_work_queue, CMutexDoublyLinkedList<int>)
+->ThreadRange(1, threadsMax)->UseRealTime();
+
+/////////////////////////// READ WRITE MIX //////////////////////
+
+/**
+ * Number of items of shared list in read/write mix.
+ */
+const unsigned int mixListSize = 256u;
+
+/**
+ * @brief Shared list for read/write mix. Reads and writes walk to a position of list,
+ * a read takes value there, a write inserts a value there and erases it again.
+ * @tparam T Type of items.
+ */
+template<typename T>
+class CMutexMixList
+{
+public:
+
+    CMutexMixList()
+    {
+        for (unsigned int i = 0; i < mixListSize; ++i)
+        {
+            mList.pushBack(T(i));
+        }
+    }
+
+    T read(unsigned int aPosition)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        return *mList.get(aPosition);
+    }
+
+    void write(unsigned int aPosition, const T& aValue)
+    {
+        std::lock_guard<std::mutex> lock(mMutex);
+        mList.insert(aPosition, aValue);
+        mList.eraseAt(aPosition);
+    }
+
+private:
+
+    std::mutex mMutex;
+    CDoublyLinkedList<T> mList;
+};
+
+/**
+ * @brief CFineGrainedDoublyLinkedList with the interface of CMutexMixList.
+ * @tparam T Type of items.
+ */
+template<typename T>
+class CFineGrainedMixList
+{
+public:
+
+    CFineGrainedMixList()
+    {
+        for (unsigned int i = 0; i < mixListSize; ++i)
+        {
+            mList.pushBack(T(i));
+        }
+    }
+
+    T read(unsigned int aPosition)
+    {
+        return *at(aPosition);
+    }
+
+    void write(unsigned int aPosition, const T& aValue)
+    {
+        mList.erase(mList.insert(at(aPosition), aValue));
+    }
+
+private:
+
+    typename CFineGrainedDoublyLinkedList<T>::DIterator at(unsigned int aPosition)
+    {
+        auto it = mList.begin();
+        for (unsigned int i = 0; i < aPosition; ++i)
+        {
+            ++it;
+        }
+        return it;
+    }
+
+    CFineGrainedDoublyLinkedList<T> mList;
+};
+
+/**
+ * @brief Benchmark method. Threads read and write at random positions of one shared list.
+ * @tparam TList Type of shared list.
+ * @param aState Benchmark state, range(0) is percentage of writes.
+ */
+template<typename TList>
+void doubly_linked_list_read_write_mix(benchmark::State& aState)
+{
+    static TList* list = nullptr;
+    if (aState.thread_index() == 0)
+    {
+        list = new TList();
+    }
+
+    const unsigned int writePercent = static_cast<unsigned int>(aState.range(0));
+    std::mt19937 random(aState.thread_index());
+    while (aState.KeepRunning())
+    {
+        const unsigned int position = random() % mixListSize;
+        if ((random() % 100u) < writePercent)
+        {
+            list->write(position, -1);
+        }
+        else
+        {
+            benchmark::DoNotOptimize(list->read(position));
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations());
+
+    if (aState.thread_index() == 0)
+    {
+        delete list;
+        list = nullptr;
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_read_write_mix, CFineGrainedMixList<int>)
+->Arg(0)->Arg(10)->Arg(50)->ThreadRange(1, threadsMax)->UseRealTime();
+
+BENCHMARK_TEMPLATE(doubly_linked_list_read_write_mix, CMutexMixList<int>)
+->Arg(0)->Arg(10)->Arg(50)->ThreadRange(1, threadsMax)->UseRealTime();
+
+/////////////////////////// SPSC ////////////////////////////////
+
+/**
+ * @brief Adds values to queue one by one.
+ */
+template<typename TQueue, typename T>
+void pushValues(TQueue& aQueue, const std::vector<T>& aValues)
+{
+    for (const T& value : aValues)
+    {
+        aQueue.pushBack(value);
+    }
+}
+
+/**
+ * @brief Adds values to SPSC queue as one batch.
+ */
+template<typename T>
+void pushValues(CSpscDoublyLinkedList<T>& aQueue, const std::vector<T>& aValues)
+{
+    aQueue.pushBack(aValues.begin(), aValues.end());
+}
+
+/**
+ * @brief Takes up to aMax values from queue one by one.
+ */
+template<typename TQueue, typename T>
+std::size_t popValues(TQueue& aQueue, T* aValues, std::size_t aMax)
+{
+    std::size_t count = 0;
+    while ((count < aMax) && aQueue.tryPopFront(aValues[count]))
+    {
+        ++count;
+    }
+    return count;
+}
+
+/**
+ * @brief Takes up to aMax values from SPSC queue as one batch.
+ */
+template<typename T>
+std::size_t popValues(CSpscDoublyLinkedList<T>& aQueue, T* aValues, std::size_t aMax)
+{
+    return aQueue.popFront(aValues, aMax);
+}
+
+/**
+ * @brief Takes exactly aCount values from queue, waits for the producer if needed.
+ */
+template<typename TQueue, typename T>
+void waitValues(TQueue& aQueue, T* aValues, std::size_t aCount)
+{
+    std::size_t count = 0;
+    while (count < aCount)
+    {
+        const std::size_t taken = popValues(aQueue, aValues + count, aCount - count);
+        if (taken == 0)
+        {
+            std::this_thread::yield();
+        }
+        count += taken;
+    }
+}
+
+/**
+ * @brief Benchmark method. Thread 0 produces batches of range(0) values, thread 1 consumes them.
+ * @tparam TQueue Type of queue.
+ * @param aState Benchmark state.
+ */
+template<typename TQueue>
+void doubly_linked_list_spsc_throughput(benchmark::State& aState)
+{
+    static TQueue* queue = nullptr;
+    if (aState.thread_index() == 0)
+    {
+        queue = new TQueue();
+    }
+
+    const std::size_t batch = static_cast<std::size_t>(aState.range(0));
+    std::vector<int> values(batch, aState.thread_index());
+    while (aState.KeepRunning())
+    {
+        if (aState.thread_index() == 0)
+        {
+            pushValues(*queue, values);
+        }
+        else
+        {
+            waitValues(*queue, values.data(), batch);
+        }
+    }
+    aState.SetItemsProcessed(aState.iterations() * batch);
+
+    if (aState.thread_index() == 0)
+    {
+        delete queue;
+        queue = nullptr;
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_spsc_throughput, CSpscDoublyLinkedList<int>)
+->Arg(1)->Arg(32)->Threads(2)->UseRealTime();
+
+BENCHMARK_TEMPLATE(doubly_linked_list_spsc_throughput, CConcurrentDoublyLinkedList<int>)
+->Arg(1)->Arg(32)->Threads(2)->UseRealTime();
+
+BENCHMARK_TEMPLATE(doubly_linked_list_spsc_throughput, CMutexDoublyLinkedList<int>)
+->Arg(1)->Arg(32)->Threads(2)->UseRealTime();
+
+/**
+ * @brief Benchmark method. Round trip of one value: thread 0 sends it through the first queue,
+ * thread 1 returns it through the second one.
+ * @tparam TQueue Type of queue.
+ * @param aState Benchmark state.
+ */
+template<typename TQueue>
+void doubly_linked_list_spsc_latency(benchmark::State& aState)
+{
+    static TQueue* queues = nullptr;
+    if (aState.thread_index() == 0)
+    {
+        queues = new TQueue[2];
+    }
+
+    TQueue& input = queues[aState.thread_index()];
+    TQueue& output = queues[1 - aState.thread_index()];
+    int value = 0;
+    while (aState.KeepRunning())
+    {
+        if (aState.thread_index() == 0)
+        {
+            output.pushBack(value);
+            waitValues(input, &value, 1u);
+        }
+        else
+        {
+            waitValues(input, &value, 1u);
+            output.pushBack(value);
+        }
+    }
+
+    if (aState.thread_index() == 0)
+    {
+        delete[] queues;
+        queues = nullptr;
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_spsc_latency, CSpscDoublyLinkedList<int>)
+->Threads(2)->UseRealTime();
+
+BENCHMARK_TEMPLATE(doubly_linked_list_spsc_latency, CMutexDoublyLinkedList<int>)
+->Threads(2)->UseRealTime();
+
+/////////////////////////// INTRUSIVE ///////////////////////////
+
+/**
+ * @brief Object with embedded hook.
+ * @tparam TSize size object.
+ */
+template<unsigned int TSize>
+struct CHookedObject
+{
+    explicit CHookedObject(unsigned int aValue = 0u)
+        : mObject(aValue)
+    {}
+
+    CObject<TSize> mObject;
+    CDoublyLinkedListHook<CHookedObject> mHook;
+};
+
+/**
+ * @brief Who holds the items of benchmarked list.
+ */
+enum class EOwnership
+{
+    Intrusive,
+    Owning
+};
+
+/**
+ * @brief Benchmark method. Links objects which already exist, walks the list and empties it again.
+ * @tparam TSize size object.
+ * @tparam TOwnership Intrusive links the objects, owning list copies them into its items.
+ * @param aState Benchmark state.
+ */
+template<unsigned int TSize, EOwnership TOwnership>
+void doubly_linked_list_intrusive(benchmark::State& aState)
+{
+    using Type = CHookedObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    std::vector<Type> objects;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        objects.emplace_back(i);
+    }
+
+    aState.SetComplexityN(size);
+    if (TOwnership == EOwnership::Intrusive)
+    {
+        CIntrusiveDoublyLinkedList<Type, &Type::mHook> container;
+        while (aState.KeepRunning())
+        {
+            for (Type& object : objects)
+            {
+                container.pushBack(object);
+            }
+            for (Type& object : container)
+            {
+                benchmark::DoNotOptimize(object);
+            }
+            while (!container.empty())
+            {
+                container.popFront();
+            }
+        }
+    }
+    else
+    {
+        CDoublyLinkedList<Type> container;
+        while (aState.KeepRunning())
+        {
+            for (const Type& object : objects)
+            {
+                container.pushBack(object);
+            }
+            for (const Type& object : container)
+            {
+                benchmark::DoNotOptimize(object);
+            }
+            while (!container.empty())
+            {
+                container.popFront();
+            }
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_intrusive, oneObjectSizeBytes16, EOwnership::Intrusive)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_intrusive, oneObjectSizeBytes16, EOwnership::Owning)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_intrusive, oneObjectSizeBytes512, EOwnership::Intrusive)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_intrusive, oneObjectSizeBytes512, EOwnership::Owning)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// XOR LINKS ///////////////////////////
+
+/**
+ * @brief Benchmark method. Fills list, walks it forward and backward and empties it.
+ * Reports memory taken by items per item as counter, measured with a counting memory resource.
+ * @tparam TList List template.
+ * @tparam TSize size object.
+ * @param aState Benchmark state.
+ */
+template<template<typename, typename> class TList, unsigned int TSize>
+void doubly_linked_list_xor(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+
+    aState.SetComplexityN(size);
+    TList<Type, CDoublyLinkedListPoolAllocator<Type>> container;
+    while (aState.KeepRunning())
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(Type(i));
+        }
+        for (auto it = container.begin(); it != container.end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+        for (auto it = container.rbegin(); it != container.rend(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+        while (!container.empty())
+        {
+            benchmark::DoNotOptimize(container.popFront());
+        }
+    }
+
+    CCountingResource resource;
+    {
+        TList<Type, std::pmr::polymorphic_allocator<Type>> counted(&resource);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            counted.pushBack(Type(i));
+        }
+        aState.counters["bytesPerItem"] = static_cast<double>(resource.mBytes) / size;
+    }
+}
+
+/**
+ * @brief CDoublyLinkedList with default lookup policy, as a two-parameter template.
+ */
+template<typename T, typename TAllocator>
+using CPlainDoublyLinkedList = CDoublyLinkedList<T, TAllocator>;
+
+BENCHMARK_TEMPLATE(doubly_linked_list_xor, CXorDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_xor, CPlainDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_xor, CXorDoublyLinkedList, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_xor, CPlainDoublyLinkedList, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// SMALL LISTS /////////////////////////
+
+/**
+ * @brief Benchmark method. Creates, fills and destroys a short lived list of tiny size,
+ * compares lists which keep items inside the list object with pool and global heap.
+ * @tparam TSize size object.
+ * @tparam TAllocator Allocator of the container.
+ * @param aState benchmark state argument.
+ */
+template<unsigned int TSize, typename TAllocator>
+void doubly_linked_list_small(benchmark::State& aState)
+{
+    const int64_t value = aState.range(0);
+    aState.SetComplexityN(value);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(pushBack<TSize, TAllocator>(value));
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes4,
+                   CDoublyLinkedListInlineAllocator<CObject<oneObjectSizeBytes4>, inlineItems>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes4, CDoublyLinkedListPoolAllocator<CObject<oneObjectSizeBytes4>>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes4, std::allocator<CObject<oneObjectSizeBytes4>>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes16,
+                   CDoublyLinkedListInlineAllocator<CObject<oneObjectSizeBytes16>, inlineItems>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes16, CDoublyLinkedListPoolAllocator<CObject<oneObjectSizeBytes16>>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_small, oneObjectSizeBytes16, std::allocator<CObject<oneObjectSizeBytes16>>)
+->DenseRange(tinyRangeMin, tinyRangeMax)->Complexity(complexityPushBack);
+
+/////////////////////////// INDEX LINKS /////////////////////////
+
+/**
+ * @brief Benchmark method. Fills list and throws it away.
+ * Reports memory taken by the list per item as counter.
+ * @tparam TList Template of list, with type of items and allocator as parameters.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<template<typename, typename> class TList, unsigned int TSize>
+void doubly_linked_list_indexed_pushBack(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        TList<Type, CDoublyLinkedListPoolAllocator<Type>> container;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(Type(i));
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+
+    CCountingResource resource;
+    {
+        TList<Type, std::pmr::polymorphic_allocator<Type>> counted(&resource);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            counted.pushBack(Type(i));
+        }
+        aState.counters["bytesPerItem"] = static_cast<double>(resource.mBytes) / size;
+    }
+}
+
+/**
+ * @brief Benchmark method. Iterates over list filled from both ends.
+ * @tparam TList Template of list, with type of items and allocator as parameters.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<template<typename, typename> class TList, unsigned int TSize>
+void doubly_linked_list_indexed_iterate(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    TList<Type, CDoublyLinkedListPoolAllocator<Type>> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        ((i % 2u) == 0u) ? container.pushBack(Type(i)) : container.pushFront(Type(i));
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        for (auto it = container.begin(); it != container.end(); ++it)
+        {
+            benchmark::DoNotOptimize(*it);
+        }
+    }
+}
+
+/**
+ * @brief Benchmark method. Reads values at pseudo random positions, where the finger
+ * of CDoublyLinkedList helps little and both lists mostly walk from the nearer end.
+ * @tparam TList Template of list, with type of items and allocator as parameters.
+ * @tparam TSize size object.
+ * @param aState benchmark state argument.
+ */
+template<template<typename, typename> class TList, unsigned int TSize>
+void doubly_linked_list_indexed_get(benchmark::State& aState)
+{
+    using Type = CObject<TSize>;
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    TList<Type, CDoublyLinkedListPoolAllocator<Type>> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(Type(i));
+    }
+    std::vector<unsigned int> positions(64u);
+    std::mt19937 random(7);
+    for (unsigned int& position : positions)
+    {
+        position = random() % size;
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        for (const unsigned int position : positions)
+        {
+            benchmark::DoNotOptimize(container.get(position));
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_pushBack, CIndexedDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_pushBack, CPlainDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_iterate, CIndexedDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_iterate, CPlainDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_get, CIndexedDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_get, CPlainDoublyLinkedList, oneObjectSizeBytes4)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_iterate, CIndexedDoublyLinkedList, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_indexed_iterate, CPlainDoublyLinkedList, oneObjectSizeBytes16)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// STATIC LIST /////////////////////////
+
+/**
+ * @brief Benchmark method. Fills list from both ends and empties it again, the list lives
+ * as long as the benchmark, like a list on a latency critical path.
+ * @tparam TList Type of list.
+ * @param aState benchmark state argument.
+ */
+template<typename TList>
+void doubly_linked_list_static(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    std::unique_ptr<TList> container = std::make_unique<TList>();
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            ((i % 2u) == 0u) ? container->pushBack(i) : container->pushFront(i);
+        }
+        while (!container->empty())
+        {
+            benchmark::DoNotOptimize(container->popFront());
+        }
+    }
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_static, CStaticDoublyLinkedList<unsigned int, rangeMax>)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_static, CDoublyLinkedList<unsigned int>)
+->RangeMultiplier(rangeMultiplier)->Range(rangeMin, rangeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// LARGE LISTS /////////////////////////
+
+/**
+ * @brief Fills list with values and sorts them in pseudo random order, so neighbouring items
+ * lie far apart in memory and every step of traversal misses the cache. The list is not scanned,
+ * a list with jump pointers gets them from the pushes and the sort.
+ * @tparam TList Type of list.
+ * @param aContainer List to fill.
+ * @param aSize Number of values.
+ */
+template<typename TList>
+void fillScattered(TList& aContainer, unsigned int aSize)
+{
+    for (unsigned int i = 0; i < aSize; ++i)
+    {
+        aContainer.pushBack(i);
+    }
+    aContainer.sort([](unsigned int aFirst, unsigned int aSecond)
+    {
+        return (aFirst * 2654435761u) < (aSecond * 2654435761u);
+    });
+}
+
+/**
+ * @brief Benchmark method. Looks for a missing value, so the whole list is scanned.
+ * @tparam TList Type of list.
+ * @param aState benchmark state argument.
+ */
+template<typename TList>
+void doubly_linked_list_large_contains(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    TList container;
+    fillScattered(container, size);
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(container.contains(size));
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. Iterates over the list.
+ * @tparam TList Type of list.
+ * @param aState benchmark state argument.
+ */
+template<typename TList>
+void doubly_linked_list_large_iterate(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    TList container;
+    fillScattered(container, size);
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        unsigned int sum = 0;
+        for (const unsigned int value : container)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_large_contains, CDoublyLinkedList<unsigned int>)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_large_contains, CPrefetchDoublyLinkedList<unsigned int>)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_large_iterate, CDoublyLinkedList<unsigned int>)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_large_iterate, CPrefetchDoublyLinkedList<unsigned int>)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+/////////////////////////// COMPACTION /////////////////////////
+
+/**
+ * @brief Benchmark method. Iterates over a scattered list, compacted first if TCompact is true.
+ * @tparam TCompact Whether the list is compacted before it is measured.
+ * @param aState benchmark state argument.
+ */
+template<bool TCompact>
+void doubly_linked_list_compacted_iterate(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<unsigned int> container;
+    fillScattered(container, size);
+    if (TCompact)
+    {
+        container.compact();
+    }
+    aState.counters["fragmentation"] = container.fragmentation();
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        unsigned int sum = 0;
+        for (const unsigned int value : container)
+        {
+            sum += value;
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. Looks for a missing value in a scattered list, compacted first if TCompact is true.
+ * @tparam TCompact Whether the list is compacted before it is measured.
+ * @param aState benchmark state argument.
+ */
+template<bool TCompact>
+void doubly_linked_list_compacted_contains(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<unsigned int> container;
+    fillScattered(container, size);
+    if (TCompact)
+    {
+        container.compact();
+    }
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(container.contains(size));
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. Compacts a scattered list, the list is scattered again outside of the measurement.
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_compact(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<unsigned int> container;
+    fillScattered(container, size);
+
+    aState.SetComplexityN(size);
+    while (aState.KeepRunning())
+    {
+        container.compact();
+
+        aState.PauseTiming();
+        container.sort([](unsigned int aFirst, unsigned int aSecond)
+        {
+            return (aFirst * 2654435761u) < (aSecond * 2654435761u);
+        });
+        aState.ResumeTiming();
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+BENCHMARK_TEMPLATE(doubly_linked_list_compacted_iterate, false)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_compacted_iterate, true)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_compacted_contains, false)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK_TEMPLATE(doubly_linked_list_compacted_contains, true)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax)->Complexity(benchmark::oN);
+
+BENCHMARK(doubly_linked_list_compact)
+->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax / 4)->Complexity(benchmark::oNLogN);
+
+/////////////////////////// PARALLEL /////////////////////////
+
+/**
+ * @brief Benchmark method. Counts values of a list of rangeLargeMax items with a predicate
+ * which costs some arithmetic per value. Segments are found once, outside of the measurement.
+ * The argument is the number of threads, items per second show the scaling.
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_parallel_count_if(benchmark::State& aState)
+{
+    CDoublyLinkedListThreadPool pool(static_cast<std::size_t>(aState.range(0)));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < rangeLargeMax; ++i)
+    {
+        container.pushBack(i);
+    }
+    CDoublyLinkedListSegments segments(container);
+
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(parallelCountIf(segments, pool, [](unsigned int aValue)
+        {
+            return std::sqrt(static_cast<double>(aValue)) > 1000.0;
+        }));
+    }
+    aState.counters["threads"] = static_cast<double>(pool.size());
+    aState.SetItemsProcessed(aState.iterations() * rangeLargeMax);
+}
+
+/**
+ * @brief Benchmark method. Sums values of a list of rangeLargeMax items. The list keeps its split points,
+ * so only the first sum pays the pass which splits the list.
+ * The argument is the number of threads, items per second show the scaling.
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_parallel_reduce(benchmark::State& aState)
+{
+    CDoublyLinkedListThreadPool pool(static_cast<std::size_t>(aState.range(0)));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < rangeLargeMax; ++i)
+    {
+        container.pushBack(i);
+    }
+
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(parallelReduce(container, pool, 0ull, [](unsigned long long aSum, unsigned long long aValue)
+        {
+            return aSum + aValue;
+        }));
+    }
+    aState.counters["threads"] = static_cast<double>(pool.size());
+    aState.SetItemsProcessed(aState.iterations() * rangeLargeMax);
+}
+
+/**
+ * @brief Benchmark method. Looks for a missing value, the parallel counterpart of contains().
+ * Segments are found once, outside of the measurement.
+ * The argument is the number of threads, items per second show the scaling.
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_parallel_find(benchmark::State& aState)
+{
+    CDoublyLinkedListThreadPool pool(static_cast<std::size_t>(aState.range(0)));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < rangeLargeMax; ++i)
+    {
+        container.pushBack(i);
+    }
+    CDoublyLinkedListSegments segments(container);
+
+    while (aState.KeepRunning())
+    {
+        benchmark::DoNotOptimize(parallelFindIf(segments, pool, [](unsigned int aValue) { return aValue == rangeLargeMax; }));
+    }
+    aState.counters["threads"] = static_cast<double>(pool.size());
+    aState.SetItemsProcessed(aState.iterations() * rangeLargeMax);
+}
+
+/**
+ * @brief Benchmark method. Updates values of a list of rangeLargeMax items in place.
+ * Values don't feed a lookup index, so parallelForEach() passes them by non-const reference.
+ * The argument is the number of threads, items per second show the scaling.
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_parallel_for_each(benchmark::State& aState)
+{
+    CDoublyLinkedListThreadPool pool(static_cast<std::size_t>(aState.range(0)));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < rangeLargeMax; ++i)
+    {
+        container.pushBack(i);
+    }
+
+    while (aState.KeepRunning())
+    {
+        parallelForEach(container, pool, [](unsigned int& aValue) { aValue = aValue * 2654435761u + 1u; });
+    }
+    benchmark::DoNotOptimize(container.get(0));
+    aState.counters["threads"] = static_cast<double>(pool.size());
+    aState.SetItemsProcessed(aState.iterations() * rangeLargeMax);
+}
+
+BENCHMARK(doubly_linked_list_parallel_count_if)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK(doubly_linked_list_parallel_reduce)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK(doubly_linked_list_parallel_find)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK(doubly_linked_list_parallel_for_each)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+/////////////////////////// SERIALIZATION /////////////////////////
+
+/**
+ * @brief Benchmark method. Writes a list to a temporary file with serialize().
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_save(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+    }
+    std::FILE* file = std::tmpfile();
+    const int fd = fileno(file);
+
+    while (aState.KeepRunning())
+    {
+        lseek(fd, 0, SEEK_SET);
+        serialize(container, fd);
+    }
+    std::fclose(file);
+    aState.SetBytesProcessed(aState.iterations() * size * sizeof(unsigned int));
+}
+
+/**
+ * @brief Benchmark method. Reads a list from a temporary file with deserialize().
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_load(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    CDoublyLinkedList<unsigned int> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+    }
+    std::FILE* file = std::tmpfile();
+    const int fd = fileno(file);
+    serialize(container, fd);
+
+    while (aState.KeepRunning())
+    {
+        lseek(fd, 0, SEEK_SET);
+        CDoublyLinkedList<unsigned int> loaded;
+        deserialize(loaded, fd);
+        benchmark::DoNotOptimize(loaded.size());
+    }
+    std::fclose(file);
+    aState.SetBytesProcessed(aState.iterations() * size * sizeof(unsigned int));
+}
+
+/**
+ * @brief Benchmark method. Reads values one at a time through stdio and adds them with pushBack,
+ * the way lists were loaded without deserialize().
+ * @param aState benchmark state argument.
+ */
+void doubly_linked_list_load_values(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    std::FILE* file = std::tmpfile();
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        std::fwrite(&i, sizeof(i), 1u, file);
+    }
+
+    while (aState.KeepRunning())
+    {
+        std::rewind(file);
+        CDoublyLinkedList<unsigned int> loaded;
+        unsigned int value = 0;
+        while (std::fread(&value, sizeof(value), 1u, file) == 1u)
+        {
+            loaded.pushBack(value);
+        }
+        benchmark::DoNotOptimize(loaded.size());
+    }
+    std::fclose(file);
+    aState.SetBytesProcessed(aState.iterations() * size * sizeof(unsigned int));
+}
+
+BENCHMARK(doubly_linked_list_save)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+BENCHMARK(doubly_linked_list_load)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+BENCHMARK(doubly_linked_list_load_values)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// MAPPED LIST /////////////////////////
+
+/**
+ * @brief Path of a temporary file for the mapped list benchmarks.
+ * @return Path unique for the process.
+ */
+std::string mappedListPath()
+{
+    return "/tmp/mapped_list_benchmark_" + std::to_string(getpid());
+}
+
+/**
+ * @brief Benchmark method. Fills a new mapped list with pushBack, the file grows meanwhile.
+ * @param aState benchmark state argument.
+ */
+void mapped_list_push_back(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    const std::string path = mappedListPath();
+
+    while (aState.KeepRunning())
+    {
+        aState.PauseTiming();
+        std::remove(path.c_str());
+        aState.ResumeTiming();
+        CMappedDoublyLinkedList<unsigned int> container(path);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+        }
+        benchmark::DoNotOptimize(container.size());
+    }
+    std::remove(path.c_str());
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. Iterates over a mapped list.
+ * @param aState benchmark state argument.
+ */
+void mapped_list_iterate(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    const std::string path = mappedListPath();
+    std::remove(path.c_str());
+    {
+        CMappedDoublyLinkedList<unsigned int> container(path);
+        container.reserve(size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+        }
+
+        while (aState.KeepRunning())
+        {
+            unsigned long long sum = 0;
+            for (const unsigned int value : container)
+            {
+                sum += value;
+            }
+            benchmark::DoNotOptimize(sum);
+        }
+    }
+    std::remove(path.c_str());
+    aState.SetItemsProcessed(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. Opens an existing mapped list and reads its first and last value.
+ * Compare with doubly_linked_list_load, which has to read the whole list.
+ * @param aState benchmark state argument.
+ */
+void mapped_list_open(benchmark::State& aState)
+{
+    const unsigned int size = static_cast<unsigned int>(aState.range(0));
+    const std::string path = mappedListPath();
+    std::remove(path.c_str());
+    {
+        CMappedDoublyLinkedList<unsigned int> container(path);
+        container.reserve(size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+        }
+    }
+
+    while (aState.KeepRunning())
+    {
+        CMappedDoublyLinkedList<unsigned int> container(path);
+        benchmark::DoNotOptimize(*container.begin());
+        benchmark::DoNotOptimize(*container.rbegin());
+    }
+    std::remove(path.c_str());
+    aState.SetBytesProcessed(aState.iterations() * size * sizeof(unsigned int));
+}
+
+BENCHMARK(mapped_list_push_back)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+BENCHMARK(mapped_list_iterate)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+BENCHMARK(mapped_list_open)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax);
+
+///////////////////////////////////////////////////////////////////
+/////////////////////////// SHARED LIST /////////////////////////
+
+/**
+ * @brief Work item passed between processes.
+ */
+struct CWorkItem
+{
+    int64_t mSent;
+    uint64_t mSequence;
+    char mPayload[48];
+};
+
+/**
+ * @brief Returns time of monotonic clock, the same in all processes.
+ */
+int64_t monotonicNanoseconds()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief Runs function in a child process. The child doesn't return.
+ * @return Process id of child.
+ */
+template<typename TFunction>
+pid_t startProcess(TFunction aFunction)
+{
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        int status = 0;
+        try
+        {
+            aFunction();
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        _exit(status);
+    }
+    return pid;
+}
+
+/**
+ * @brief Benchmark method. A child process writes work items in place and pushes them to a shared list,
+ * this process pops them, reads them in place and releases them. Latency is from writing to popping.
+ * @param aState benchmark state argument.
+ */
+void shared_list_two_process(benchmark::State& aState)
+{
+    const uint64_t size = static_cast<uint64_t>(aState.range(0));
+    const std::string name = "/shared_list_benchmark_" + std::to_string(getpid());
+    CSharedDoublyLinkedList<CWorkItem>::unlink(name);
+    CSharedDoublyLinkedList<CWorkItem> consumer(name, 1024u);
+    int64_t latency = 0;
+
+    while (aState.KeepRunning())
+    {
+        const pid_t pid = startProcess([&name, size]()
+        {
+            CSharedDoublyLinkedList<CWorkItem> producer(name, 1024u);
+            for (uint64_t i = 0; i < size; ++i)
+            {
+                CWorkItem* item = producer.allocate();
+                item->mSequence = i;
+                item->mSent = monotonicNanoseconds();
+                producer.pushBack(item);
+            }
+        });
+        for (uint64_t i = 0; i < size; ++i)
+        {
+            CWorkItem* item = consumer.popFront();
+            latency += monotonicNanoseconds() - item->mSent;
+            consumer.release(item);
+        }
+        waitpid(pid, nullptr, 0);
+    }
+    CSharedDoublyLinkedList<CWorkItem>::unlink(name);
+    aState.SetItemsProcessed(aState.iterations() * size);
+    aState.counters["latency_ns"] = static_cast<double>(latency) / static_cast<double>(aState.iterations() * size);
+}
+
+/**
+ * @brief Benchmark method. The same exchange as shared_list_two_process through a pipe,
+ * each work item is copied into the pipe and out of it.
+ * @param aState benchmark state argument.
+ */
+void pipe_two_process(benchmark::State& aState)
+{
+    const uint64_t size = static_cast<uint64_t>(aState.range(0));
+    int64_t latency = 0;
+
+    while (aState.KeepRunning())
+    {
+        int fds[2];
+        if (pipe(fds) != 0)
+        {
+            aState.SkipWithError("pipe failed");
+            break;
+        }
+        const pid_t pid = startProcess([&fds, size]()
+        {
+            close(fds[0]);
+            CWorkItem item{};
+            for (uint64_t i = 0; i < size; ++i)
+            {
+                item.mSequence = i;
+                item.mSent = monotonicNanoseconds();
+                if (write(fds[1], &item, sizeof(item)) != static_cast<ssize_t>(sizeof(item)))
+                {
+                    throw std::runtime_error("write failed");
+                }
+            }
+        });
+        close(fds[1]);
+        CWorkItem item;
+        for (uint64_t i = 0; i < size; ++i)
+        {
+            std::size_t received = 0;
+            while (received < sizeof(item))
+            {
+                const ssize_t result = read(fds[0], reinterpret_cast<char*>(&item) + received, sizeof(item) - received);
+                if (result <= 0)
+                {
+                    break;
+                }
+                received += static_cast<std::size_t>(result);
+            }
+            latency += monotonicNanoseconds() - item.mSent;
+        }
+        close(fds[0]);
+        waitpid(pid, nullptr, 0);
+    }
+    aState.SetItemsProcessed(aState.iterations() * size);
+    aState.counters["latency_ns"] = static_cast<double>(latency) / static_cast<double>(aState.iterations() * size);
+}
+
+BENCHMARK(shared_list_two_process)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax / 4)->UseRealTime();
+
+BENCHMARK(pipe_two_process)->RangeMultiplier(rangeLargeMultiplier)->Range(rangeLargeMin, rangeLargeMax / 4)->UseRealTime();
+
 ///////////////////////////////////////////////////////////////////
 ///////////////////////////////////////////////////////////////////
 
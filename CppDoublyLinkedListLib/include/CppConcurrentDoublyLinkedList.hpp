@@ -0,0 +1,790 @@
+#ifndef CPP_CONCURRENT_DOUBLY_LINKED_LIST_HPP_
+#define CPP_CONCURRENT_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Lock-free Doubly Linked List for concurrent use as a deque. Any number of threads may call
+ * pushBack, pushFront, tryPopFront and tryPopBack at the same time.
+ *
+ * Implements the deque of M. Michael, "CAS-Based Lock-Free Algorithm for Shared Deques" (Euro-Par 2003).
+ * Both ends and a status are kept in one anchor word, which is replaced by a single CAS. A push that has
+ * moved the anchor leaves it in a push status until the link from the old end to the new item is set,
+ * and any thread which meets such an anchor finishes that link first.
+ *
+ * Items are addressed by 31-bit indexes, so the anchor fits into a 64-bit atomic on every platform.
+ * Items live in segments which are never returned to the system before destruction. Removed items
+ * are protected by hazard pointers and reused only when no thread can still reach them.
+ *
+ * Values are moved out of the list by pop, so T must be nothrow move assignable and nothrow destructible.
+ * @tparam T Type of items.
+ */
+template<typename T>
+class CConcurrentDoublyLinkedList
+{
+    static_assert(std::is_nothrow_move_assignable<T>::value, "T must be nothrow move assignable");
+    static_assert(std::is_nothrow_destructible<T>::value, "T must be nothrow destructible");
+
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief List item. Links are indexes of neighbours, 0 means no item.
+     */
+    struct CConcurrentDoublyLinkedListItem
+    {
+        /**
+         * @brief Index of previous item.
+         */
+        std::atomic<uint32_t> mPrevious;
+
+        /**
+         * @brief Index of next item. Links items of the free list too.
+         */
+        std::atomic<uint32_t> mNext;
+
+        /**
+         * @brief Storage for value, constructed while the item is in the list.
+         */
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type mValue;
+    };
+
+    using Item = CConcurrentDoublyLinkedListItem;
+
+    /**
+     * @brief Hazard pointers of one thread. Records are never deleted before the list,
+     * a thread takes a free one for the time of a call.
+     */
+    struct CHazardRecord
+    {
+        /**
+         * @brief Indexes of items the owner is going to read, 0 if slot is unused.
+         */
+        std::atomic<uint32_t> mHazards[3];
+
+        /**
+         * @brief true while a thread owns the record.
+         */
+        std::atomic<bool> mActive;
+
+        /**
+         * @brief Next record, immutable after the record is published.
+         */
+        CHazardRecord* mNextRecord;
+
+        /**
+         * @brief Items removed by owners of this record, waiting until they are not hazardous.
+         */
+        std::vector<uint32_t> mRetired;
+
+        /**
+         * @brief Buffer for hazards collected during scan.
+         */
+        std::vector<uint32_t> mScanned;
+    };
+
+    /**
+     * @brief Status of the anchor.
+     */
+    enum EStatus : uint64_t
+    {
+        Stable = 0u,
+        RightPush = 1u,
+        LeftPush = 2u
+    };
+
+    /**
+     * @brief Number of bits of item index.
+     */
+    static const unsigned int cIndexBits = 31u;
+
+    /**
+     * @brief Mask of item index.
+     */
+    static const uint64_t cIndexMask = (uint64_t(1u) << cIndexBits) - 1u;
+
+    /**
+     * @brief Items of the first segment have indexes [2^cFirstSegmentBits, 2^(cFirstSegmentBits + 1)),
+     * every further segment is twice as large as the previous one. Indexes below are unused.
+     */
+    static const unsigned int cFirstSegmentBits = 6u;
+
+    /**
+     * @brief Number of segments needed to cover all indexes.
+     */
+    static const unsigned int cMaxSegments = cIndexBits - cFirstSegmentBits;
+
+    /**
+     * @brief Minimal number of retired items before a thread scans hazard pointers.
+     */
+    static const std::size_t cRetireThreshold = 64u;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CConcurrentDoublyLinkedList()
+        : mAnchor(0u)
+        , mFree(0u)
+        , mNextUnused(uint32_t(1u) << cFirstSegmentBits)
+        , mRecords(nullptr)
+    {
+        for (unsigned int segment = 0; segment < cMaxSegments; segment++)
+        {
+            mSegments[segment].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    CConcurrentDoublyLinkedList(const CConcurrentDoublyLinkedList&) = delete;
+
+    /**
+     * @brief Destroys remaining values. No other thread may use the list any more.
+     */
+    ~CConcurrentDoublyLinkedList()
+    {
+        const uint64_t anchor = mAnchor.load();
+        assert(statusOf(anchor) == Stable);
+        for (uint32_t index = leftOf(anchor); index != 0; )
+        {
+            Item& entry = item(index);
+            valueOf(entry).~T();
+            index = (index == rightOf(anchor)) ? 0u : entry.mNext.load(std::memory_order_relaxed);
+        }
+        for (unsigned int segment = 0; segment < cMaxSegments; segment++)
+        {
+            delete[] mSegments[segment].load(std::memory_order_relaxed);
+        }
+        CHazardRecord* record = mRecords.load(std::memory_order_relaxed);
+        while (record != nullptr)
+        {
+            CHazardRecord* next = record->mNextRecord;
+            delete record;
+            record = next;
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CConcurrentDoublyLinkedList& operator=(const CConcurrentDoublyLinkedList&) = delete;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Indicates if the list is empty. The result may be outdated by the time it is returned.
+     * Complexity: O(1)
+     * @return true if list was empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (rightOf(mAnchor.load()) == 0);
+    }
+
+    /**
+     * @brief Adds value to the end of list. Lock-free.
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        emplaceBack(aValue);
+    }
+
+    /**
+     * @brief Adds value to the end of list. Lock-free.
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+    }
+
+    /**
+     * @brief Adds value to the beginning of list. Lock-free.
+     * @param aValue Value to add.
+     */
+    void pushFront(const T& aValue)
+    {
+        emplaceFront(aValue);
+    }
+
+    /**
+     * @brief Adds value to the beginning of list. Lock-free.
+     * @param aValue Value to add.
+     */
+    void pushFront(T&& aValue)
+    {
+        emplaceFront(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value at the end of list. Lock-free.
+     * @param aArgs Arguments for constructor of value.
+     */
+    template<typename... TArgs>
+    void emplaceBack(TArgs&&... aArgs)
+    {
+        CHazardGuard guard(*this);
+        const uint32_t index = createItem(std::forward<TArgs>(aArgs)...);
+        while (true)
+        {
+            const uint64_t anchor = mAnchor.load();
+            if (rightOf(anchor) == 0)
+            {
+                uint64_t expected = anchor;
+                if (mAnchor.compare_exchange_strong(expected, pack(index, index, Stable)))
+                {
+                    return;
+                }
+            }
+            else if (statusOf(anchor) == Stable)
+            {
+                item(index).mPrevious.store(rightOf(anchor));
+                uint64_t expected = anchor;
+                const uint64_t pushed = pack(leftOf(anchor), index, RightPush);
+                if (mAnchor.compare_exchange_strong(expected, pushed))
+                {
+                    stabilizeRight(guard, pushed);
+                    return;
+                }
+            }
+            else
+            {
+                stabilize(guard, anchor);
+            }
+        }
+    }
+
+    /**
+     * @brief Constructs value at the beginning of list. Lock-free.
+     * @param aArgs Arguments for constructor of value.
+     */
+    template<typename... TArgs>
+    void emplaceFront(TArgs&&... aArgs)
+    {
+        CHazardGuard guard(*this);
+        const uint32_t index = createItem(std::forward<TArgs>(aArgs)...);
+        while (true)
+        {
+            const uint64_t anchor = mAnchor.load();
+            if (leftOf(anchor) == 0)
+            {
+                uint64_t expected = anchor;
+                if (mAnchor.compare_exchange_strong(expected, pack(index, index, Stable)))
+                {
+                    return;
+                }
+            }
+            else if (statusOf(anchor) == Stable)
+            {
+                item(index).mNext.store(leftOf(anchor));
+                uint64_t expected = anchor;
+                const uint64_t pushed = pack(index, rightOf(anchor), LeftPush);
+                if (mAnchor.compare_exchange_strong(expected, pushed))
+                {
+                    stabilizeLeft(guard, pushed);
+                    return;
+                }
+            }
+            else
+            {
+                stabilize(guard, anchor);
+            }
+        }
+    }
+
+    /**
+     * @brief Removes the first value of list. Lock-free.
+     * @param aValue Receives removed value, unchanged if the list is empty.
+     * @return true if a value was removed, false if the list was empty.
+     */
+    bool tryPopFront(T& aValue)
+    {
+        CHazardGuard guard(*this);
+        uint64_t anchor;
+        while (true)
+        {
+            anchor = mAnchor.load();
+            if (leftOf(anchor) == 0)
+            {
+                return false;
+            }
+            if (leftOf(anchor) == rightOf(anchor))
+            {
+                if (mAnchor.compare_exchange_strong(anchor, 0u))
+                {
+                    break;
+                }
+            }
+            else if (statusOf(anchor) == Stable)
+            {
+                guard.protect(0, leftOf(anchor));
+                guard.protect(1, rightOf(anchor));
+                if (mAnchor.load() != anchor)
+                {
+                    continue;
+                }
+                const uint32_t next = item(leftOf(anchor)).mNext.load();
+                uint64_t expected = anchor;
+                if (mAnchor.compare_exchange_strong(expected, pack(next, rightOf(anchor), Stable)))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                stabilize(guard, anchor);
+            }
+        }
+        takeValue(guard, leftOf(anchor), aValue);
+        return true;
+    }
+
+    /**
+     * @brief Removes the last value of list. Lock-free.
+     * @param aValue Receives removed value, unchanged if the list is empty.
+     * @return true if a value was removed, false if the list was empty.
+     */
+    bool tryPopBack(T& aValue)
+    {
+        CHazardGuard guard(*this);
+        uint64_t anchor;
+        while (true)
+        {
+            anchor = mAnchor.load();
+            if (rightOf(anchor) == 0)
+            {
+                return false;
+            }
+            if (leftOf(anchor) == rightOf(anchor))
+            {
+                if (mAnchor.compare_exchange_strong(anchor, 0u))
+                {
+                    break;
+                }
+            }
+            else if (statusOf(anchor) == Stable)
+            {
+                guard.protect(0, leftOf(anchor));
+                guard.protect(1, rightOf(anchor));
+                if (mAnchor.load() != anchor)
+                {
+                    continue;
+                }
+                const uint32_t previous = item(rightOf(anchor)).mPrevious.load();
+                uint64_t expected = anchor;
+                if (mAnchor.compare_exchange_strong(expected, pack(leftOf(anchor), previous, Stable)))
+                {
+                    break;
+                }
+            }
+            else
+            {
+                stabilize(guard, anchor);
+            }
+        }
+        takeValue(guard, rightOf(anchor), aValue);
+        return true;
+    }
+
+private:
+
+    /**
+     * @brief Owns a hazard record for the time of a call and clears its hazards on exit.
+     */
+    class CHazardGuard
+    {
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        explicit CHazardGuard(CConcurrentDoublyLinkedList& aList)
+            : mRecord(aList.acquireRecord())
+        {}
+
+        CHazardGuard(const CHazardGuard&) = delete;
+
+        ~CHazardGuard()
+        {
+            for (std::atomic<uint32_t>& hazard : mRecord->mHazards)
+            {
+                hazard.store(0u, std::memory_order_release);
+            }
+            mRecord->mActive.store(false, std::memory_order_release);
+        }
+
+        CHazardGuard& operator=(const CHazardGuard&) = delete;
+
+        /**
+         * @brief Publishes index as hazardous. Caller must validate that the item is still reachable.
+         */
+        void protect(std::size_t aSlot, uint32_t aIndex)
+        {
+            mRecord->mHazards[aSlot].store(aIndex);
+        }
+
+        /**
+         * @brief Owned record.
+         */
+        CHazardRecord* const mRecord;
+    };
+
+    /**
+     * @brief Anchor - indexes of the first and the last item and status of pending push.
+     */
+    std::atomic<uint64_t> mAnchor;
+
+    /**
+     * @brief Top of the free list of items - index in the low word, ABA counter in the high word.
+     */
+    std::atomic<uint64_t> mFree;
+
+    /**
+     * @brief Lowest index which has never been used.
+     */
+    std::atomic<uint32_t> mNextUnused;
+
+    /**
+     * @brief Segments of items, allocated on first use.
+     */
+    std::atomic<Item*> mSegments[cMaxSegments];
+
+    /**
+     * @brief Head of hazard records.
+     */
+    std::atomic<CHazardRecord*> mRecords;
+
+    /**
+     * @brief Packs anchor.
+     */
+    static uint64_t pack(uint32_t aLeft, uint32_t aRight, EStatus aStatus)
+    {
+        return uint64_t(aLeft) | (uint64_t(aRight) << cIndexBits) | (uint64_t(aStatus) << (2u * cIndexBits));
+    }
+
+    /**
+     * @brief Index of the first item of anchor.
+     */
+    static uint32_t leftOf(uint64_t aAnchor)
+    {
+        return static_cast<uint32_t>(aAnchor & cIndexMask);
+    }
+
+    /**
+     * @brief Index of the last item of anchor.
+     */
+    static uint32_t rightOf(uint64_t aAnchor)
+    {
+        return static_cast<uint32_t>((aAnchor >> cIndexBits) & cIndexMask);
+    }
+
+    /**
+     * @brief Status of anchor.
+     */
+    static EStatus statusOf(uint64_t aAnchor)
+    {
+        return static_cast<EStatus>(aAnchor >> (2u * cIndexBits));
+    }
+
+    /**
+     * @brief Returns position of the highest set bit.
+     */
+    static unsigned int highestBit(uint32_t aValue)
+    {
+#if defined(__GNUC__)
+        return 31u - static_cast<unsigned int>(__builtin_clz(aValue));
+#else
+        unsigned int bit = 0u;
+        while ((aValue >>= 1u) != 0u)
+        {
+            bit++;
+        }
+        return bit;
+#endif
+    }
+
+    /**
+     * @brief Returns item by index.
+     */
+    Item& item(uint32_t aIndex) const
+    {
+        const unsigned int segment = highestBit(aIndex) - cFirstSegmentBits;
+        return mSegments[segment].load(std::memory_order_acquire)[aIndex - (uint32_t(1u) << highestBit(aIndex))];
+    }
+
+    /**
+     * @brief Returns value of item.
+     */
+    static T& valueOf(Item& aItem)
+    {
+        return *reinterpret_cast<T*>(&aItem.mValue);
+    }
+
+    /**
+     * @brief Takes item from the free list or from the unused range and constructs value in it.
+     * @return Index of the new item.
+     */
+    template<typename... TArgs>
+    uint32_t createItem(TArgs&&... aArgs)
+    {
+        uint32_t index = 0;
+        uint64_t free = mFree.load();
+        while ((free & cIndexMask) != 0)
+        {
+            const uint32_t next = item(static_cast<uint32_t>(free & cIndexMask)).mNext.load(std::memory_order_relaxed);
+            if (mFree.compare_exchange_weak(free, (((free >> 32u) + 1u) << 32u) | next))
+            {
+                index = static_cast<uint32_t>(free & cIndexMask);
+                break;
+            }
+        }
+        if (index == 0)
+        {
+            index = mNextUnused.fetch_add(1u);
+            if (index > cIndexMask)
+            {
+                throw std::length_error("CConcurrentDoublyLinkedList: too many items");
+            }
+            ensureSegment(highestBit(index) - cFirstSegmentBits);
+        }
+
+        Item& entry = item(index);
+        try
+        {
+            ::new (static_cast<void*>(&entry.mValue)) T(std::forward<TArgs>(aArgs)...);
+        }
+        catch (...)
+        {
+            releaseItem(index);
+            throw;
+        }
+        entry.mPrevious.store(0u, std::memory_order_relaxed);
+        entry.mNext.store(0u, std::memory_order_relaxed);
+        return index;
+    }
+
+    /**
+     * @brief Allocates segment unless another thread did it already.
+     */
+    void ensureSegment(unsigned int aSegment)
+    {
+        if (mSegments[aSegment].load(std::memory_order_acquire) != nullptr)
+        {
+            return;
+        }
+        Item* segment = new Item[std::size_t(1u) << (aSegment + cFirstSegmentBits)];
+        Item* expected = nullptr;
+        if (!mSegments[aSegment].compare_exchange_strong(expected, segment, std::memory_order_acq_rel))
+        {
+            delete[] segment;
+        }
+    }
+
+    /**
+     * @brief Returns item without value to the free list.
+     */
+    void releaseItem(uint32_t aIndex)
+    {
+        Item& entry = item(aIndex);
+        uint64_t free = mFree.load();
+        do
+        {
+            entry.mNext.store(static_cast<uint32_t>(free & cIndexMask), std::memory_order_relaxed);
+        }
+        while (!mFree.compare_exchange_weak(free, (((free >> 32u) + 1u) << 32u) | aIndex));
+    }
+
+    /**
+     * @brief Moves value out of removed item and retires the item.
+     */
+    void takeValue(CHazardGuard& aGuard, uint32_t aIndex, T& aValue)
+    {
+        T& value = valueOf(item(aIndex));
+        aValue = std::move(value);
+        value.~T();
+        retire(aGuard, aIndex);
+    }
+
+    /**
+     * @brief Takes unused hazard record or publishes a new one.
+     */
+    CHazardRecord* acquireRecord()
+    {
+        for (CHazardRecord* record = mRecords.load(std::memory_order_acquire); record != nullptr;
+             record = record->mNextRecord)
+        {
+            if (!record->mActive.load(std::memory_order_relaxed) && !record->mActive.exchange(true))
+            {
+                return record;
+            }
+        }
+
+        CHazardRecord* record = new CHazardRecord;
+        for (std::atomic<uint32_t>& hazard : record->mHazards)
+        {
+            hazard.store(0u, std::memory_order_relaxed);
+        }
+        record->mActive.store(true, std::memory_order_relaxed);
+        record->mRetired.reserve(cRetireThreshold);
+        record->mNextRecord = mRecords.load(std::memory_order_relaxed);
+        while (!mRecords.compare_exchange_weak(record->mNextRecord, record, std::memory_order_release,
+                                               std::memory_order_relaxed))
+        {
+        }
+        return record;
+    }
+
+    /**
+     * @brief Adds removed item to retired items and frees those no thread protects.
+     * Never throws, so a removed value is never lost.
+     */
+    void retire(CHazardGuard& aGuard, uint32_t aIndex) noexcept
+    {
+        CHazardRecord& own = *aGuard.mRecord;
+        try
+        {
+            own.mRetired.push_back(aIndex);
+            if (own.mRetired.size() < cRetireThreshold)
+            {
+                return;
+            }
+
+            own.mScanned.clear();
+            for (CHazardRecord* record = mRecords.load(std::memory_order_acquire); record != nullptr;
+                 record = record->mNextRecord)
+            {
+                for (std::atomic<uint32_t>& hazard : record->mHazards)
+                {
+                    const uint32_t index = hazard.load();
+                    if (index != 0)
+                    {
+                        own.mScanned.push_back(index);
+                    }
+                }
+            }
+        }
+        catch (const std::bad_alloc&)
+        {
+            // Item is not reused, its segment still frees it in destructor.
+            return;
+        }
+        std::sort(own.mScanned.begin(), own.mScanned.end());
+
+        std::size_t kept = 0;
+        for (uint32_t index : own.mRetired)
+        {
+            if (std::binary_search(own.mScanned.begin(), own.mScanned.end(), index))
+            {
+                own.mRetired[kept++] = index;
+            }
+            else
+            {
+                releaseItem(index);
+            }
+        }
+        own.mRetired.resize(kept);
+    }
+
+    /**
+     * @brief Finishes pending push of anchor.
+     */
+    void stabilize(CHazardGuard& aGuard, uint64_t aAnchor)
+    {
+        if (statusOf(aAnchor) == RightPush)
+        {
+            stabilizeRight(aGuard, aAnchor);
+        }
+        else
+        {
+            stabilizeLeft(aGuard, aAnchor);
+        }
+    }
+
+    /**
+     * @brief Links the previous last item to the pushed last item and marks anchor stable.
+     */
+    void stabilizeRight(CHazardGuard& aGuard, uint64_t aAnchor)
+    {
+        aGuard.protect(0, leftOf(aAnchor));
+        aGuard.protect(1, rightOf(aAnchor));
+        if (mAnchor.load() != aAnchor)
+        {
+            return;
+        }
+        const uint32_t previous = item(rightOf(aAnchor)).mPrevious.load();
+        aGuard.protect(2, previous);
+        if (mAnchor.load() != aAnchor)
+        {
+            return;
+        }
+        uint32_t previousNext = item(previous).mNext.load();
+        if (previousNext != rightOf(aAnchor))
+        {
+            if (mAnchor.load() != aAnchor)
+            {
+                return;
+            }
+            if (!item(previous).mNext.compare_exchange_strong(previousNext, rightOf(aAnchor)))
+            {
+                return;
+            }
+        }
+        uint64_t expected = aAnchor;
+        mAnchor.compare_exchange_strong(expected, pack(leftOf(aAnchor), rightOf(aAnchor), Stable));
+    }
+
+    /**
+     * @brief Links the previous first item to the pushed first item and marks anchor stable.
+     */
+    void stabilizeLeft(CHazardGuard& aGuard, uint64_t aAnchor)
+    {
+        aGuard.protect(0, leftOf(aAnchor));
+        aGuard.protect(1, rightOf(aAnchor));
+        if (mAnchor.load() != aAnchor)
+        {
+            return;
+        }
+        const uint32_t next = item(leftOf(aAnchor)).mNext.load();
+        aGuard.protect(2, next);
+        if (mAnchor.load() != aAnchor)
+        {
+            return;
+        }
+        uint32_t nextPrevious = item(next).mPrevious.load();
+        if (nextPrevious != leftOf(aAnchor))
+        {
+            if (mAnchor.load() != aAnchor)
+            {
+                return;
+            }
+            if (!item(next).mPrevious.compare_exchange_strong(nextPrevious, leftOf(aAnchor)))
+            {
+                return;
+            }
+        }
+        uint64_t expected = aAnchor;
+        mAnchor.compare_exchange_strong(expected, pack(leftOf(aAnchor), rightOf(aAnchor), Stable));
+    }
+};
+
+#endif
@@ -4,15 +4,49 @@
 /*----------------------------------------------------------------------
                                 Include
  *----------------------------------------------------------------------*/
+#include <algorithm>
 #include <cassert>
-#include <exception>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "CppDoublyLinkedListLookup.hpp"
+#include "CppDoublyLinkedListPool.hpp"
+#include "CppDoublyLinkedListPrefetch.hpp"
 
 /**
  * @brief Doubly Linked List. Holds pointers to the beginning, end of the list and size of the list.
  * Therefore some operations have constant complexity.
+ * Items are allocated with TAllocator rebound to the item type. By default items come from a slab pool,
+ * use std::allocator<T> to allocate every item on the global heap, CPmrDoublyLinkedList
+ * to take items from a std::pmr::memory_resource or CSmallDoublyLinkedList to keep the first
+ * items inside the list object.
+ * Positional access remembers the last accessed item (finger), so reading neighbouring positions
+ * one after another is cheap. Because get() moves the finger, even const access must not run
+ * concurrently with other access to the same list.
+ * TLookupPolicy selects how contains() and find() look for values: CNoLookupPolicy scans the list,
+ * CHashLookupPolicy keeps a hash index of items (see CHashDoublyLinkedList).
+ * TPrefetchPolicy selects how forward traversal hides memory latency: CNoPrefetchPolicy just follows
+ * the links, CJumpPrefetchPolicy prefetches items ahead through jump pointers (see CPrefetchDoublyLinkedList).
+ * Items of a list which is changed for long get scattered in memory, compact() lays the list out
+ * in address order again, setCompactionThreshold() lets the list do it on its own.
  * @tparam T Type of items.
+ * @tparam TAllocator Allocator of items.
+ * @tparam TLookupPolicy Lookup policy.
+ * @tparam TPrefetchPolicy Prefetch policy.
  */
-template<typename T>
+template<typename T,
+         typename TAllocator = CDoublyLinkedListPoolAllocator<T>,
+         typename TLookupPolicy = CNoLookupPolicy,
+         typename TPrefetchPolicy = CNoPrefetchPolicy>
 class CDoublyLinkedList
 {
     /*----------------------------------------------------------------------
@@ -23,10 +57,11 @@ class CDoublyLinkedList
     /**
      * @brief List item. Each list's value is hold in this class.
      * It wraps value by adding pointer to next and previous element.
+     * The prefetch policy may add its hint as base.
      * @tparam TItem Type of items stored in a list.
      */
     template<typename TItem>
-    class CDoublyLinkedListItem
+    class CDoublyLinkedListItem : public TPrefetchPolicy::CHint
     {
     public:
 
@@ -34,48 +69,42 @@ class CDoublyLinkedList
                                 Constructors & Destructors
          *----------------------------------------------------------------------*/
         explicit CDoublyLinkedListItem(const TItem& aValue)
-            : mNext(nullptr)
-            , mPrevious(nullptr)
+            : mPrevious(nullptr)
+            , mNext(nullptr)
             , mValue(aValue)
         {}
 
-        CDoublyLinkedListItem(  CDoublyLinkedListItem<TItem>* const aPrevious, 
+        /**
+         * @brief Constructs value in place from given arguments.
+         */
+        template<typename... TArgs>
+        CDoublyLinkedListItem(  CDoublyLinkedListItem<TItem>* const aPrevious,
                                 CDoublyLinkedListItem<TItem>* const aNext,
-                                const TItem& aValue)
-            : mNext(aNext)
-            , mPrevious(aPrevious)
-            , mValue(aValue)
+                                TArgs&&... aArgs)
+            : mPrevious(aPrevious)
+            , mNext(aNext)
+            , mValue(std::forward<TArgs>(aArgs)...)
         {}
 
         CDoublyLinkedListItem(const CDoublyLinkedListItem& iTem)
-            : mNext(iTem.mNext)
+            : TPrefetchPolicy::CHint()
             , mPrevious(iTem.mPrevious)
+            , mNext(iTem.mNext)
             , mValue(iTem.mValue)
         {}
 
         CDoublyLinkedListItem(CDoublyLinkedListItem&& iTem)
-            : mNext(iTem.mNext)
+            : TPrefetchPolicy::CHint()
             , mPrevious(iTem.mPrevious)
-            , mValue(iTem.mValue)
+            , mNext(iTem.mNext)
+            , mValue(std::move(iTem.mValue))
         {
             iTem.mPrevious = nullptr;
             iTem.mNext = nullptr;
-            mValue = NULL;
         }
 
         ~CDoublyLinkedListItem() = default;
 
-        /*----------------------------------------------------------------------
-                                Overload operators
-         *----------------------------------------------------------------------*/
-        /**
-         * @brief Operator ->
-         */
-        T* operator->()
-        {
-            return &(this);
-        }
-
         /**
          * @brief Pointer to previous Item.
          */
@@ -110,6 +139,12 @@ public:
 
     public:
 
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
         /*----------------------------------------------------------------------
                                 Constructors & Destructors
          *----------------------------------------------------------------------*/
@@ -123,6 +158,10 @@ public:
 
         CDoublyLinkedListIterator(CDoublyLinkedListIterator&&) = default;
 
+        CDoublyLinkedListIterator& operator=(const CDoublyLinkedListIterator&) = default;
+
+        CDoublyLinkedListIterator& operator=(CDoublyLinkedListIterator&&) = default;
+
         /*----------------------------------------------------------------------
                                 Overload operators
          *----------------------------------------------------------------------*/
@@ -136,6 +175,7 @@ public:
 
             for (int i = 0; i < aDiffIndex; i++)
             {
+                TPrefetchPolicy::prefetch(*arg);
                 arg = arg->mNext;
             }
             CDoublyLinkedListIterator it(arg);
@@ -163,6 +203,7 @@ public:
          */
         CDoublyLinkedListIterator& operator ++()
         {
+            TPrefetchPolicy::prefetch(*mPtr);
             mPtr = mPtr->mNext;
             return *this;
         }
@@ -173,6 +214,7 @@ public:
         CDoublyLinkedListIterator operator ++(int)
         {
             CDoublyLinkedListIterator it(mPtr);
+            TPrefetchPolicy::prefetch(*mPtr);
             mPtr = mPtr->mNext;
             return it;
         }
@@ -209,7 +251,7 @@ public:
          */
         const T* operator->()const
         {
-            return &(mPtr);
+            return &(mPtr->mValue);
         }
 
         /**
@@ -266,6 +308,12 @@ public:
         CDoublyLinkedListItem<T>* mPtr;
     public:
 
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
         /*----------------------------------------------------------------------
                                Constructors & Destructors
          *----------------------------------------------------------------------*/
@@ -279,6 +327,10 @@ public:
 
         CReverseDoublyLinkedListIterator(CReverseDoublyLinkedListIterator&&) = default;
 
+        CReverseDoublyLinkedListIterator& operator=(const CReverseDoublyLinkedListIterator&) = default;
+
+        CReverseDoublyLinkedListIterator& operator=(CReverseDoublyLinkedListIterator&&) = default;
+
         /*----------------------------------------------------------------------
                                 Overload operators
          *----------------------------------------------------------------------*/
@@ -308,6 +360,7 @@ public:
 
             for (int i = 0; i < aDiffIndex; i++)
             {
+                TPrefetchPolicy::prefetch(*arg);
                 arg = arg->mNext;
             }
             CReverseDoublyLinkedListIterator it(arg);
@@ -366,7 +419,7 @@ public:
          */
         const T* operator->()const
         {
-            return &mPtr;
+            return &(mPtr->mValue);
         }
 
         /**
@@ -418,24 +471,98 @@ public:
                            Constructors & Destructors
      *----------------------------------------------------------------------*/
     CDoublyLinkedList()
-        : mBegin(nullptr)
+        : mAllocator()
+        , mIndex(mAllocator)
+        , mBegin(nullptr)
         , mTail(nullptr)
-        , n(nullptr)
-        , mSize(NULL)
+        , mSize(0)
+        , mFinger(nullptr)
+        , mFingerIndex(0)
+        , mJumps()
+        , mCompactionThreshold(0.0)
+        , mChanges(0)
+        , mVersion(0)
+    {}
+
+    explicit CDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+        , mIndex(mAllocator)
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+        , mFinger(nullptr)
+        , mFingerIndex(0)
+        , mJumps()
+        , mCompactionThreshold(0.0)
+        , mChanges(0)
+        , mVersion(0)
+    {}
+
+    CDoublyLinkedList(const CDoublyLinkedList& aObj)
+        : CDoublyLinkedList(aObj, TAllocator(ItemTraits::select_on_container_copy_construction(aObj.mAllocator)))
+    {}
+
+    CDoublyLinkedList(const CDoublyLinkedList& aObj, const TAllocator& aAllocator)
+        : CDoublyLinkedList(aObj.begin(), aObj.end(), aAllocator)
     {}
 
-    CDoublyLinkedList(const CDoublyLinkedList<T>& aObj)
+    /**
+     * @brief Creates list with copies of values from range [aFirst, aLast).
+     * Complexity: O(n), see pushBack(TIterator, TIterator).
+     */
+    template<typename TIterator, typename = typename std::iterator_traits<TIterator>::iterator_category>
+    CDoublyLinkedList(TIterator aFirst, TIterator aLast, const TAllocator& aAllocator = TAllocator())
+        : CDoublyLinkedList(aAllocator)
     {
-        IniEmptyList();
-        if (!aObj.empty())
+        pushBack(aFirst, aLast);
+    }
+
+    /**
+     * @brief Creates list with copies of given values.
+     * Complexity: O(n), see pushBack(TIterator, TIterator).
+     */
+    CDoublyLinkedList(std::initializer_list<T> aValues, const TAllocator& aAllocator = TAllocator())
+        : CDoublyLinkedList(aValues.begin(), aValues.end(), aAllocator)
+    {}
+
+    /**
+     * @brief Move constructor. Takes over items of the other list.
+     * Complexity: O(1), O(n) with inline storage of items - values are moved into items of this list.
+     */
+    CDoublyLinkedList(CDoublyLinkedList&& aObj) noexcept(!CHasInlineStorage<ItemAllocator>::value)
+        : mAllocator(std::move(aObj.mAllocator))
+        , mIndex(mAllocator)
+        , mBegin(aObj.mBegin)
+        , mTail(aObj.mTail)
+        , mSize(aObj.mSize)
+        , mFinger(aObj.mFinger)
+        , mFingerIndex(aObj.mFingerIndex)
+        , mJumps(aObj.mJumps)
+        , mCompactionThreshold(0.0)
+        , mChanges(0)
+        , mVersion(0)
+    {
+        if constexpr (CHasInlineStorage<ItemAllocator>::value)
         {
-            DIterator iterator(aObj.mBegin);
-            for (int i = 0; i < aObj.mSize; i++)
+            IniEmptyList();
+            try
+            {
+                for (CDoublyLinkedListItem<T>* item = aObj.mBegin; item != nullptr; item = item->mNext)
+                {
+                    emplaceBack(std::move(item->mValue));
+                }
+            }
+            catch (...)
             {
-                T arg = iterator.getValueItem();
-                iterator++;
-                pushBack(arg);
+                ClearList();
+                throw;
             }
+            aObj.ClearList();
+        }
+        else
+        {
+            mIndex.swap(aObj.mIndex);
+            aObj.IniEmptyList();
         }
     }
 
@@ -448,35 +575,70 @@ public:
                                 Overload operators
      *----------------------------------------------------------------------*/
 
-    CDoublyLinkedList<T>& operator=(const CDoublyLinkedList<T>& aObj)
+    CDoublyLinkedList& operator=(const CDoublyLinkedList& aObj)
     {
-        if (!aObj.empty())
+        if (this == &aObj)
         {
-            if (empty())
-            {
-                IniEmptyList();
-            }
-            else
+            return *this;
+        }
+
+        if constexpr (ItemTraits::propagate_on_container_copy_assignment::value)
+        {
+            if (mAllocator != aObj.mAllocator)
             {
                 ClearList();
             }
+            mAllocator = aObj.mAllocator;
+        }
+
+        assign(aObj.begin(), aObj.end());
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment. Takes over items of the other list.
+     * Complexity: O(1) if allocator propagates or both allocators are equal,
+     * otherwise O(n) - values are moved into items allocated by this list.
+     */
+    CDoublyLinkedList& operator=(CDoublyLinkedList&& aObj)
+        noexcept(ItemTraits::propagate_on_container_move_assignment::value || ItemTraits::is_always_equal::value)
+    {
+        if (this == &aObj)
+        {
+            return *this;
+        }
 
-            DIterator iterator(aObj.mBegin);
-            for (int i = 0; i < aObj.mSize; i++)
+        ClearList();
+        if constexpr (ItemTraits::propagate_on_container_move_assignment::value)
+        {
+            mAllocator = std::move(aObj.mAllocator);
+        }
+        else if (mAllocator != aObj.mAllocator)
+        {
+            for (CDoublyLinkedListItem<T>* item = aObj.mBegin; item != nullptr; item = item->mNext)
             {
-                T arg = iterator.getValueItem();
-                iterator++;
-                pushBack(arg);
+                emplaceBack(std::move(item->mValue));
             }
+            aObj.ClearList();
+            return *this;
         }
- 
+
+        mBegin = aObj.mBegin;
+        mTail = aObj.mTail;
+        mSize = aObj.mSize;
+        mFinger = aObj.mFinger;
+        mFingerIndex = aObj.mFingerIndex;
+        mJumps = aObj.mJumps;
+        mVersion++;
+        mIndex.swap(aObj.mIndex);
+        aObj.IniEmptyList();
         return *this;
     }
 
     /**
      * @brief Compares vectors
      */
-    bool operator==(const CDoublyLinkedList<T>& aObj)
+    bool operator==(const CDoublyLinkedList& aObj) const
     {
         if (mBegin == aObj.mBegin)
         {
@@ -505,7 +667,7 @@ public:
     /**
      * @brief Compare operator
      */
-    bool operator!=(const CDoublyLinkedList<T>& aObj)
+    bool operator!=(const CDoublyLinkedList& aObj) const
     {
         return !(*this == aObj);
     }
@@ -514,6 +676,103 @@ public:
                                 Methods
      *----------------------------------------------------------------------*/
 
+    /**
+     * @brief Returns copy of the allocator used by the list.
+     * @return Allocator.
+     */
+    TAllocator get_allocator() const
+    {
+        return TAllocator(mAllocator);
+    }
+
+    /**
+     * @brief Exchanges items with the other list.
+     * Complexity: O(1), O(n) with inline storage of items - values are exchanged by moves.
+     * Allocators are exchanged if they propagate on swap, otherwise they have to be equal.
+     * @param aObj Other list.
+     */
+    void swap(CDoublyLinkedList& aObj) noexcept(!CHasInlineStorage<ItemAllocator>::value)
+    {
+        if constexpr (CHasInlineStorage<ItemAllocator>::value)
+        {
+            if (this != &aObj)
+            {
+                CDoublyLinkedList temp(std::move(aObj));
+                aObj = std::move(*this);
+                *this = std::move(temp);
+            }
+            return;
+        }
+        else if constexpr (ItemTraits::propagate_on_container_swap::value)
+        {
+            using std::swap;
+            swap(mAllocator, aObj.mAllocator);
+        }
+        else
+        {
+            assert(mAllocator == aObj.mAllocator);
+        }
+        std::swap(mBegin, aObj.mBegin);
+        std::swap(mTail, aObj.mTail);
+        std::swap(mSize, aObj.mSize);
+        std::swap(mFinger, aObj.mFinger);
+        std::swap(mFingerIndex, aObj.mFingerIndex);
+        std::swap(mJumps, aObj.mJumps);
+        mVersion++;
+        aObj.mVersion++;
+        mIndex.swap(aObj.mIndex);
+    }
+
+    /**
+     * @brief Forgets all items without destroying them and without returning their memory to the allocator.
+     * Complexity: O(1)
+     * Intended for lists whose memory is reclaimed at once by the allocator,
+     * e.g. a request scoped list on std::pmr::monotonic_buffer_resource. Destructors of items are not called.
+     */
+    void release()
+    {
+        mIndex.clear();
+        IniEmptyList();
+    }
+
+    /**
+     * @brief Replaces values of the list with copies of values from range [aFirst, aLast).
+     * Existing items are reused, the rest is allocated like in pushBack(TIterator, TIterator).
+     * With CHashLookupPolicy the list is cleared first.
+     * Complexity: O(n + m)
+     * @param aFirst Iterator to the first value.
+     * @param aLast Iterator after the last value.
+     */
+    template<typename TIterator, typename = typename std::iterator_traits<TIterator>::iterator_category>
+    void assign(TIterator aFirst, TIterator aLast)
+    {
+        if constexpr (Index::cEnabled)
+        {
+            ClearList();
+        }
+
+        CDoublyLinkedListItem<T>* item = mBegin;
+        for (; (item != nullptr) && (aFirst != aLast); item = item->mNext, ++aFirst)
+        {
+            item->mValue = *aFirst;
+        }
+        if (item != nullptr)
+        {
+            // surplus items are destroyed with the temporary list
+            extractItems(item, nullptr);
+        }
+        pushBack(aFirst, aLast);
+    }
+
+    /**
+     * @brief Replaces values of the list with copies of given values.
+     * @see assign(TIterator, TIterator)
+     */
+    void assign(std::initializer_list<T> aValues)
+    {
+        assign(aValues.begin(), aValues.end());
+    }
+
     /**
      * @brief Returns a number of items.
      * Complexity: O(n) - because it has to pass for all item.
@@ -531,46 +790,105 @@ public:
      */
     void pushBack(const T& aValue)
     {
+        emplaceBack(aValue);
+        compactIfFragmented();
+    }
+
+    /**
+     * @brief Adds value to list. The value is moved into the list.
+     * Complexity: O(1) - because the list holds pointer to the last item.
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+        compactIfFragmented();
+    }
+
+    /**
+     * @brief Constructs value in place at the end of the list.
+     * Complexity: O(1) - because the list holds pointer to the last item.
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceBack(TArgs&&... aArgs)
+    {
+        CDoublyLinkedListItem<T>* item = createItem(mTail, nullptr, std::forward<TArgs>(aArgs)...);
         if (empty())
         {
-            n = new CDoublyLinkedListItem<T>(nullptr, nullptr, aValue);
-            mBegin = n;
-            mTail = n;
-            mSize++;
+            mBegin = item;
+        }
+        else
+        {
+            mTail->mNext = item;
+        }
+        mTail = item;
+        mSize++;
+        mJumps.linkedBack(item, mSize);
+        mVersion++;
+        return item->mValue;
+    }
+
+    /**
+     * @brief Adds copies of values from range [aFirst, aLast) to the end of the list.
+     * For forward iterators all items are allocated at once, with the default pool allocator
+     * in one contiguous block, and linked in a single pass. Nothing is added if a copy throws.
+     * Complexity: O(m)
+     * @param aFirst Iterator to the first value.
+     * @param aLast Iterator after the last value.
+     */
+    template<typename TIterator, typename = typename std::iterator_traits<TIterator>::iterator_category>
+    void pushBack(TIterator aFirst, TIterator aLast)
+    {
+        using Category = typename std::iterator_traits<TIterator>::iterator_category;
+        if constexpr (std::is_base_of<std::forward_iterator_tag, Category>::value)
+        {
+            const uintmax_t count = std::distance(aFirst, aLast);
+            if (count > 0u)
+            {
+                createItems(aFirst, count);
+            }
         }
         else
         {
-            n = new CDoublyLinkedListItem<T>(mTail, nullptr, aValue);
-            mTail->mNext = n;
-            mTail = n;
-            mSize++;
+            for (; aFirst != aLast; ++aFirst)
+            {
+                emplaceBack(*aFirst);
+            }
         }
     }
 
     /**
-     * @brief Removes last item from list.
-     * Complexity: O(n) - because it has to pass through all items
-     * @return Last item fropushFrontm list.
+     * @brief Removes last item from list. The value is moved out of the list.
+     * Complexity: O(1) - because the list holds pointer to the last item.
+     * @return Last item from list.
      */
     T popBack()
     {
+        compactIfFragmented();
         if (!empty())
         {
             if (mSize == 1)
             {
-                T returnItem = mBegin->mValue;
-                delete mBegin;
-                mBegin = nullptr;
-                mTail = nullptr;
-                n = nullptr;
-                mSize = 0;
+                mIndex.remove(mBegin);
+                T returnItem = std::move(mBegin->mValue);
+                destroyItem(mBegin);
+                IniEmptyList();
 
                 return returnItem;
             }
 
+            if (mFinger == mTail)
+            {
+                mFinger = nullptr;
+            }
             CDoublyLinkedListItem<T>* newTail = mTail->mPrevious;
-            T returnItem = mTail->mValue;
-            delete mTail;
+            mJumps.unlinkingBack(mTail);
+            mVersion++;
+            mIndex.remove(mTail);
+            T returnItem = std::move(mTail->mValue);
+            destroyItem(mTail);
             mSize--;
 
             mTail = newTail;
@@ -581,7 +899,7 @@ public:
         }
         else
         {
-            throw std::exception("Try to delate item from empty List");
+            throw std::out_of_range("Try to delete item from empty List");
         }
     }
 
@@ -592,48 +910,86 @@ public:
      */
     void pushFront(const T& aValue)
     {
+        emplaceFront(aValue);
+        compactIfFragmented();
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list. The value is moved into the list.
+     * Complexity: O(1) - because the list holds pointer to the beginning.
+     * @param aValue Value.
+     */
+    void pushFront(T&& aValue)
+    {
+        emplaceFront(std::move(aValue));
+        compactIfFragmented();
+    }
+
+    /**
+     * @brief Constructs value in place at the beginning of the list.
+     * Complexity: O(1) - because the list holds pointer to the beginning.
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceFront(TArgs&&... aArgs)
+    {
+        CDoublyLinkedListItem<T>* item = createItem(nullptr, mBegin, std::forward<TArgs>(aArgs)...);
         if (empty())
         {
-            n = new CDoublyLinkedListItem<T>(nullptr, nullptr, aValue);
-            mBegin = n;
-            mTail = n;
-            mSize++;
+            mTail = item;
         }
         else
         {
-            n = new CDoublyLinkedListItem<T>(nullptr, mBegin, aValue);
-            mBegin = n;
-            mSize++;
+            mBegin->mPrevious = item;
+        }
+        if (mFinger != nullptr)
+        {
+            mFingerIndex++;
         }
+        mBegin = item;
+        mSize++;
+        mJumps.linkedFront(item, mSize);
+        mVersion++;
+        return item->mValue;
     }
 
     /**
-     * @brief Remove the first element from the list.
+     * @brief Remove the first element from the list. The value is moved out of the list.
      * Complexity: O(1) - because list has pointer to beginning.
      * @return The first item from list.
      */
     T popFront()
     {
+        compactIfFragmented();
         if (mSize == 1)
         {
-            T returnItem = mBegin->mValue;
-            delete mBegin;
-            mBegin = nullptr;
-            mTail = nullptr;
-            n = nullptr;
-            mSize = 0;
+            mIndex.remove(mBegin);
+            T returnItem = std::move(mBegin->mValue);
+            destroyItem(mBegin);
+            IniEmptyList();
 
             return returnItem;
         }
 
         if (!empty())
         {
+            if (mFinger == mBegin)
+            {
+                mFinger = nullptr;
+            }
+            else if (mFinger != nullptr)
+            {
+                mFingerIndex--;
+            }
+            mJumps.unlinkingFront(mBegin);
+            mVersion++;
             mBegin->mNext->mPrevious = nullptr;
             CDoublyLinkedListItem<T>* newBegin = mBegin->mNext;
 
-            DIterator deleteIterator(mBegin);
-            T returnItem = mBegin->mValue;
-            delete deleteIterator.getItem();
+            mIndex.remove(mBegin);
+            T returnItem = std::move(mBegin->mValue);
+            destroyItem(mBegin);
             mSize--;
 
             mBegin = newBegin;
@@ -643,7 +999,7 @@ public:
         }
         else
         {
-            throw std::exception("Try to delate item from empty List");
+            throw std::out_of_range("Try to delete item from empty List");
         }
     }
 
@@ -651,25 +1007,24 @@ public:
      * @brief Checks the list contains object.
      * Complexity: O(n) - because it has to check all items. In the worst case entire list will be checked.
      * The worst case takes place if there isn't the value in the list or it is on the last position.
+     * O(1) expected with CHashLookupPolicy.
      * @param aValue Value to check.
      * @return true if list contains value, otherwise false.
      */
-    bool contains(const T& aValue)
+    bool contains(const T& aValue) const
     {
-        if (!empty())
-        {
-            DIterator iterator(mBegin);
-            for (int i = 0; i < mSize; i++)
-            {
-                T arg = iterator.getValueItem();
-                if (arg == aValue)
-                {
-                    return true;
-                }
-                iterator++;
-            }
-        }
-        return false;
+        return (findItem(aValue) != nullptr);
+    }
+
+    /**
+     * @brief Finds the first item holding given value. With CHashLookupPolicy any item holding the value is found.
+     * Complexity: O(n), O(1) expected with CHashLookupPolicy.
+     * @param aValue Value to find.
+     * @return Iterator to the item or end() if there isn't the value in the list.
+     */
+    DIterator find(const T& aValue) const
+    {
+        return DIterator(findItem(aValue));
     }
 
     /**
@@ -683,7 +1038,9 @@ public:
     }
 
     /**
-     * @brief Get pointer to the value at given position. Complexity: O(n) - because it has to check all items in the worst case.
+     * @brief Get pointer to the value at given position.
+     * Complexity: O(d) - d is the distance to the nearest of the beginning, the end and the last accessed position.
+     * Sequential or clustered reads are therefore O(1) per call, O(n) in the worst case.
      * @param aIndex Position of value.
      * @return Pointer to value or null if there isn't value at given position.
      */
@@ -694,14 +1051,13 @@ public:
             return nullptr;
         }
 
-        DIterator iterator(mBegin);
-        iterator = iterator + aIndex;
-        return &(iterator.getValueItem());
+        return &(findItem(aIndex)->mValue);
     }
 
     /**
      * @brief Inserts value at given position.
-     * @param aIndex Position of value. Must be lower than size.
+     * Complexity: O(d) - d is the distance to the nearest of the beginning, the end and the last accessed position.
+     * @param aIndex Position of value. Must be lower than size, 0 inserts also into an empty list.
      * @param aValue Value to insert.
      */
     void insert(const uintmax_t aIndex, const T& aValue)
@@ -712,100 +1068,1093 @@ public:
         }
         else if (aIndex < mSize)
         {
-            DIterator iterator(mBegin);
-            iterator = iterator + aIndex;
-            CDoublyLinkedListItem<T>* indexItem = iterator.getItem();
-            n = new CDoublyLinkedListItem<T>(indexItem->mPrevious, indexItem, aValue);
-            indexItem->mPrevious->mNext = n;
-            indexItem->mPrevious = n;
-            mSize++;
-            indexItem = nullptr;
+            DIterator iterator = emplace(DIterator(findItem(aIndex)), aValue);
+            mFinger = iterator.getItem();
+            mFingerIndex = aIndex;
         }
     }
 
     /**
-     * @brief Returns a random access iterator that points to the beginning.
-     * @return Iterator to the beginning.
+     * @brief Inserts value at given position. The value is moved into the list.
+     * Complexity: O(d) - d is the distance to the nearest of the beginning, the end and the last accessed position.
+     * @param aIndex Position of value. Must be lower than size, 0 inserts also into an empty list.
+     * @param aValue Value to insert.
      */
-    DIterator begin() const
+    void insert(const uintmax_t aIndex, T&& aValue)
     {
-        DIterator iterator(mBegin);
-        return iterator;
+        if (aIndex == 0)
+        {
+            pushFront(std::move(aValue));
+        }
+        else if (aIndex < mSize)
+        {
+            DIterator iterator = emplace(DIterator(findItem(aIndex)), std::move(aValue));
+            mFinger = iterator.getItem();
+            mFingerIndex = aIndex;
+        }
     }
 
     /**
-     * @brief Returns a random access iterator that points to the item after the last one.
-     * @return Iterator to the item after the last one.
+     * @brief Constructs value in place before given position.
+     * Complexity: O(1)
+     * @param aPosition Iterator to the item before which the value is constructed, end() to add value at the end.
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Iterator to the new value.
      */
-    DIterator end() const
+    template<typename... TArgs>
+    DIterator emplace(DIterator aPosition, TArgs&&... aArgs)
     {
-        DIterator iterator(nullptr);
-        return iterator;
-    }
+        CDoublyLinkedListItem<T>* indexItem = aPosition.getItem();
+        if (indexItem == nullptr)
+        {
+            emplaceBack(std::forward<TArgs>(aArgs)...);
+            return DIterator(mTail);
+        }
+        if (indexItem == mBegin)
+        {
+            emplaceFront(std::forward<TArgs>(aArgs)...);
+            return DIterator(mBegin);
+        }
 
-    /**
-     * @brief Returns a reverse random access iterator that points to the last item.
-     * @return Reverse iterator to the last item.
-     */
-    DReverseIterator rbegin() const
-    {
-        DReverseIterator iterator(mTail);
-        return iterator;
+        CDoublyLinkedListItem<T>* item = createItem(indexItem->mPrevious, indexItem, std::forward<TArgs>(aArgs)...);
+        indexItem->mPrevious->mNext = item;
+        indexItem->mPrevious = item;
+        mSize++;
+        mFinger = nullptr;
+        Jumps::linkedBetween(item);
+        mVersion++;
+        return DIterator(item);
     }
 
     /**
-     * @brief Returns a reverse random access iterator that points to the item before the first one.
-     * @return Reverse iterator to the item before the first one.
+     * @brief Removes value at given position.
+     * Complexity: O(d) - d is the distance to the nearest of the beginning, the end and the last accessed position.
+     * @param aIndex Position of value. Must be lower than size.
+     * @return Removed value.
      */
-    DReverseIterator rend() const
+    T eraseAt(const uintmax_t aIndex)
     {
-        DReverseIterator iterator(nullptr);
-        return iterator;
-    }
-
-private:
+        if (aIndex >= mSize)
+        {
+            throw std::out_of_range("Try to delete item out of List");
+        }
+        if (aIndex == 0)
+        {
+            return popFront();
+        }
+        if (aIndex == mSize - 1u)
+        {
+            return popBack();
+        }
 
-    /**
-     * @brief Pointer to the first item of the list.
-     */
-    CDoublyLinkedListItem<T>* mBegin;
-    CDoublyLinkedListItem<T>* mTail;
-    CDoublyLinkedListItem<T>* n;
-    uintmax_t mSize;
+        CDoublyLinkedListItem<T>* indexItem = findItem(aIndex);
+        indexItem->mPrevious->mNext = indexItem->mNext;
+        indexItem->mNext->mPrevious = indexItem->mPrevious;
+        mSize--;
+        mFinger = indexItem->mNext;
 
-    /**
-     * @brief Method for initialization empty List
-     */
-    void IniEmptyList()
-    {
-        n = nullptr;
-        mBegin = nullptr;
-        mTail = nullptr;
-        mSize = 0;
+        mIndex.remove(indexItem);
+        T returnItem = std::move(indexItem->mValue);
+        destroyItem(indexItem);
+        return returnItem;
     }
 
     /**
-     * @brief Method which at all clear List
+     * @brief Sorts the list. The sort is stable, equal values keep their order.
+     * Items are relinked, values are neither copied nor moved and nothing is allocated.
+     * Complexity: O(n log n)
+     * @param aCompare Comparison which returns true if the first argument goes before the second one.
      */
-
-    void ClearList()
+    template<typename TCompare = std::less<T>>
+    void sort(TCompare aCompare = TCompare())
     {
-        if (empty())
+        if (mSize < 2u)
         {
             return;
         }
 
-        for (DIterator iterator(mBegin); iterator != end(); iterator++)
+        // bins[i] holds a sorted chain of 2^i items or nothing, higher bins hold earlier items
+        const unsigned int cBinCount = 64u;
+        CDoublyLinkedListItem<T>* bins[cBinCount] = {};
+        unsigned int usedBins = 0;
+        CDoublyLinkedListItem<T>* item = mBegin;
+        while (item != nullptr)
         {
-            delete iterator.getItem();
+            CDoublyLinkedListItem<T>* carry = item;
+            item = item->mNext;
+            carry->mNext = nullptr;
+
+            unsigned int i = 0;
+            for (; bins[i] != nullptr; i++)
+            {
+                carry = mergeItems(bins[i], carry, aCompare);
+                bins[i] = nullptr;
+            }
+            bins[i] = carry;
+            if (i >= usedBins)
+            {
+                usedBins = i + 1u;
+            }
         }
 
-        n = nullptr;
-        mBegin = nullptr;
-        mTail = nullptr;
-        mSize = 0;
-    }
+        CDoublyLinkedListItem<T>* sorted = nullptr;
+        for (unsigned int i = 0; i < usedBins; i++)
+        {
+            if (bins[i] != nullptr)
+            {
+                sorted = mergeItems(bins[i], sorted, aCompare);
+            }
+        }
+        relinkItems(sorted);
+    }
+
+    /**
+     * @brief Merges other sorted list into this sorted list. The merge is stable,
+     * of equal values the ones from this list go first. The other list is empty afterwards.
+     * If allocators of both lists are equal, items of the other list are relinked into this list,
+     * values are neither copied nor moved and nothing is allocated. Otherwise values of the other list
+     * are moved into items allocated by this list first. Pools of the default allocator are joined first,
+     * see splice(DIterator, CDoublyLinkedList&).
+     * Complexity: O(n + m)
+     * @param aObj Other sorted list.
+     * @param aCompare Comparison the lists are sorted with.
+     */
+    template<typename TCompare = std::less<T>>
+    void merge(CDoublyLinkedList& aObj, TCompare aCompare = TCompare())
+    {
+        if ((this == &aObj) || aObj.empty())
+        {
+            return;
+        }
+        if constexpr (ItemTraits::propagate_on_container_swap::value)
+        {
+            if (empty())
+            {
+                swap(aObj);
+                return;
+            }
+        }
+        joinAllocator(aObj);
+        if (mAllocator != aObj.mAllocator)
+        {
+            // values are moved into items of this list behind its last item, then both runs are merged
+            CDoublyLinkedList part(std::move(aObj));
+            CDoublyLinkedListItem<T>* const last = mTail;
+            try
+            {
+                for (CDoublyLinkedListItem<T>* item = part.mBegin; item != nullptr; item = item->mNext)
+                {
+                    emplaceBack(std::move(item->mValue));
+                }
+            }
+            catch (...)
+            {
+                mergeTail(last, aCompare);
+                throw;
+            }
+            mergeTail(last, aCompare);
+            return;
+        }
+
+        mIndex.splice(aObj.mIndex);
+        const uintmax_t size = mSize + aObj.mSize;
+        relinkItems(mergeItems(mBegin, aObj.mBegin, aCompare));
+        mSize = size;
+        aObj.IniEmptyList();
+    }
+
+    /**
+     * @brief Merges other sorted list into this sorted list.
+     * @see merge(CDoublyLinkedList&, TCompare)
+     */
+    template<typename TCompare = std::less<T>>
+    void merge(CDoublyLinkedList&& aObj, TCompare aCompare = TCompare())
+    {
+        merge(aObj, aCompare);
+    }
+
+    /**
+     * @brief Moves all items of other list before given position. The other list is empty afterwards.
+     * If allocators of both lists are equal, items are relinked, values are neither copied nor moved
+     * and nothing is allocated. Otherwise values are moved into items allocated by this list.
+     * Pools of lists with the default pool allocator are joined, so their allocators are equal
+     * and items are always relinked. Joined lists share memory of their pools, so they must not be
+     * changed from different threads at once afterwards. An empty list takes over the items and the pool.
+     * Complexity: O(1) if allocators are equal or can be joined, otherwise O(m). O(m) expected with CHashLookupPolicy.
+     * @param aPosition Iterator to the item before which items are put, end() to put them at the end.
+     * @param aObj Other list.
+     */
+    void splice(DIterator aPosition, CDoublyLinkedList& aObj)
+    {
+        if ((this == &aObj) || aObj.empty())
+        {
+            return;
+        }
+        if constexpr (ItemTraits::propagate_on_container_swap::value)
+        {
+            if (empty())
+            {
+                swap(aObj);
+                return;
+            }
+        }
+        joinAllocator(aObj);
+        if (mAllocator != aObj.mAllocator)
+        {
+            CDoublyLinkedList part(std::move(aObj));
+            for (CDoublyLinkedListItem<T>* item = part.mBegin; item != nullptr; item = item->mNext)
+            {
+                emplace(aPosition, std::move(item->mValue));
+            }
+            return;
+        }
+
+        mIndex.splice(aObj.mIndex);
+        linkItems(aPosition.getItem(), aObj.mBegin, aObj.mTail, aObj.mSize);
+        aObj.IniEmptyList();
+    }
+
+    /**
+     * @brief Moves items [aFirst, aLast) of other list before given position.
+     * The other list may be this list if aPosition is not in the range.
+     * Items are relinked if allocators of both lists are equal, see splice(DIterator, CDoublyLinkedList&).
+     * Complexity: O(k) - k is the number of moved items, because they have to be counted.
+     * @param aPosition Iterator to the item before which items are put, end() to put them at the end.
+     * @param aObj Other list.
+     * @param aFirst Iterator to the first item to move.
+     * @param aLast Iterator to the item after the last one to move.
+     */
+    void splice(DIterator aPosition, CDoublyLinkedList& aObj, DIterator aFirst, DIterator aLast)
+    {
+        if (aFirst == aLast)
+        {
+            return;
+        }
+
+        CDoublyLinkedList part = aObj.extractItems(aFirst.getItem(), aLast.getItem());
+        splice(aPosition, part);
+    }
+
+    /**
+     * @brief Splits the list at given position. Items from the position to the end are moved to new list,
+     * which shares the allocator with this list. Items are relinked, nothing is allocated for them.
+     * Complexity: O(k) - k is the number of moved items, because they have to be counted.
+     * @param aPosition Iterator to the first item of the new list.
+     * @return List with items from the position to the end.
+     */
+    CDoublyLinkedList splitAt(DIterator aPosition)
+    {
+        if (aPosition == end())
+        {
+            return CDoublyLinkedList(get_allocator());
+        }
+        return extractItems(aPosition.getItem(), nullptr);
+    }
+
+    /**
+     * @brief Puts all items of other list at the end of this list.
+     * @see splice(DIterator, CDoublyLinkedList&)
+     * @param aObj Other list.
+     */
+    void append(CDoublyLinkedList&& aObj)
+    {
+        splice(end(), aObj);
+    }
+
+    /**
+     * @brief Lays the list out in memory in its own order. Values are moved among the items so that
+     * the first value is in the item with the lowest address, the second one in the next item and so on,
+     * and the items are relinked in address order. Traversal then walks memory forwards, through
+     * contiguous runs of items with the pool allocator, instead of jumping around.
+     * Nothing is allocated for items, only two temporary arrays of n entries. Nothing is changed
+     * if they can't be allocated. Iterators and references stay valid but may refer to other values.
+     * Available if values are nothrow movable and the list has no lookup index.
+     * Complexity: O(n log n) - because items are sorted by address.
+     */
+    void compact()
+    {
+        static_assert(cCompactable, "compact() needs nothrow movable values and no lookup index");
+
+        mChanges = 0;
+        if (mSize < 2)
+        {
+            return;
+        }
+
+        std::vector<CDoublyLinkedListItem<T>*> items;
+        items.reserve(mSize);
+        for (CDoublyLinkedListItem<T>* item = mBegin; item != nullptr; item = item->mNext)
+        {
+            items.push_back(item);
+        }
+        std::sort(items.begin(), items.end(), std::less<CDoublyLinkedListItem<T>*>());
+
+        // address rank of the item which holds the value of each position
+        std::vector<std::size_t> sources(mSize);
+        std::size_t position = 0;
+        for (CDoublyLinkedListItem<T>* item = mBegin; item != nullptr; item = item->mNext, position++)
+        {
+            sources[position] = std::lower_bound(items.begin(), items.end(), item, std::less<CDoublyLinkedListItem<T>*>())
+                                - items.begin();
+        }
+
+        // values are moved along the cycles of the permutation
+        for (std::size_t start = 0; start < sources.size(); start++)
+        {
+            if (sources[start] == start)
+            {
+                continue;
+            }
+
+            T value(std::move(items[start]->mValue));
+            std::size_t target = start;
+            while (sources[target] != start)
+            {
+                const std::size_t source = sources[target];
+                items[target]->mValue = std::move(items[source]->mValue);
+                sources[target] = target;
+                target = source;
+            }
+            items[target]->mValue = std::move(value);
+            sources[target] = target;
+        }
+
+        typename TPrefetchPolicy::template CTrail<CDoublyLinkedListItem<T>> trail;
+        for (std::size_t i = 0; i < items.size(); i++)
+        {
+            items[i]->mPrevious = (i > 0) ? items[i - 1] : nullptr;
+            items[i]->mNext = (i + 1 < items.size()) ? items[i + 1] : nullptr;
+            trail.step(items[i]);
+        }
+        mBegin = items.front();
+        mTail = items.back();
+        mFinger = nullptr;
+        mFingerIndex = 0;
+        mJumps.reset();
+        mVersion++;
+    }
+
+    /**
+     * @brief Measures how scattered the items are. A link is scattered if the next item doesn't lie
+     * shortly after the current one in memory, which is what a prefetcher can follow.
+     * Complexity: O(n) - because it has to pass for all item.
+     * @return Fraction of scattered links, 0 for a list in one contiguous run of items, 1 at most.
+     */
+    double fragmentation() const
+    {
+        if (mSize < 2)
+        {
+            return 0.0;
+        }
+
+        uintmax_t scattered = 0;
+        for (const CDoublyLinkedListItem<T>* item = mBegin; item->mNext != nullptr; item = item->mNext)
+        {
+            TPrefetchPolicy::prefetch(*item);
+            const std::uintptr_t current = reinterpret_cast<std::uintptr_t>(item);
+            const std::uintptr_t next = reinterpret_cast<std::uintptr_t>(item->mNext);
+            if ((next <= current) || (next - current > sizeof(CDoublyLinkedListItem<T>) + cSequentialGap))
+            {
+                scattered++;
+            }
+        }
+        return static_cast<double>(scattered) / static_cast<double>(mSize - 1);
+    }
+
+    /**
+     * @brief Turns on automatic compaction. Once the number of items added and removed since the last
+     * check reaches half of the size of the list, the next pushBack(), pushFront(), popBack() or popFront()
+     * measures fragmentation() and calls compact() if it is above the threshold. Those calls then
+     * may change which values iterators and references refer to.
+     * Complexity: amortized O(log n) per added or removed item.
+     * The setting belongs to the list object, it isn't copied, moved or swapped with the items.
+     * @param aThreshold Fraction of scattered links above which the list is compacted, 0 turns it off.
+     */
+    void setCompactionThreshold(const double aThreshold)
+    {
+        static_assert(cCompactable, "compaction needs nothrow movable values and no lookup index");
+        mCompactionThreshold = aThreshold;
+        mChanges = 0;
+    }
+
+    /**
+     * @brief Returns iterators to the first items of segments of nearly equal size, the first segments
+     * one item longer than the rest, for the parallel algorithms. Split points are kept until links
+     * of the list change, so an unchanged list is passed over only once for any number of scans.
+     * May be called from several threads at once, like other const methods.
+     * Complexity: O(1) if the list wasn't changed since the last call with the same count, otherwise O(n).
+     * @param aCount Number of segments. Must not be greater than size.
+     * @return Iterators to the first items, empty for 0 segments.
+     */
+    std::vector<DIterator> splitPoints(const std::size_t aCount) const
+    {
+        std::shared_ptr<const CSplitPoints> points = std::atomic_load(&mSplitPoints);
+        if (!points || (points->mVersion != mVersion) || (points->mFirsts.size() != aCount))
+        {
+            auto found = std::make_shared<CSplitPoints>();
+            found->mVersion = mVersion;
+            found->mFirsts.reserve(aCount);
+            CDoublyLinkedListItem<T>* item = mBegin;
+            for (std::size_t segment = 0; segment < aCount; segment++)
+            {
+                found->mFirsts.push_back(item);
+                const uintmax_t items = (mSize / aCount) + ((segment < (mSize % aCount)) ? 1u : 0u);
+                for (uintmax_t i = 0; (i < items) && (segment + 1u < aCount); i++)
+                {
+                    item = item->mNext;
+                }
+            }
+            points = std::move(found);
+            std::atomic_store(&mSplitPoints, points);
+        }
+        return std::vector<DIterator>(points->mFirsts.begin(), points->mFirsts.end());
+    }
+
+    /**
+     * @brief Calls function with reference to each value of given number of items, so values can be
+     * changed in place. Only for lists without a lookup index, which would have to follow the changes.
+     * Complexity: O(k) - k is the number of items.
+     * @param aFirst Iterator to the first item.
+     * @param aCount Number of items. Must not exceed the items from aFirst to the end.
+     * @param aFunction Function called with T&.
+     */
+    template<typename TFunction,
+             bool TEnabled = !TLookupPolicy::template CIndex<T, CDoublyLinkedListItem<T>, TAllocator>::cEnabled,
+             typename = std::enable_if_t<TEnabled>>
+    void visit(DIterator aFirst, uintmax_t aCount, TFunction aFunction)
+    {
+        for (CDoublyLinkedListItem<T>* item = aFirst.getItem(); aCount > 0u; aCount--)
+        {
+            TPrefetchPolicy::prefetch(*item);
+            aFunction(item->mValue);
+            item = item->mNext;
+        }
+    }
+
+    /**
+     * @brief Returns a random access iterator that points to the beginning.
+     * @return Iterator to the beginning.
+     */
+    DIterator begin() const
+    {
+        DIterator iterator(mBegin);
+        return iterator;
+    }
+
+    /**
+     * @brief Returns a random access iterator that points to the item after the last one.
+     * @return Iterator to the item after the last one.
+     */
+    DIterator end() const
+    {
+        DIterator iterator(nullptr);
+        return iterator;
+    }
+
+    /**
+     * @brief Returns a reverse random access iterator that points to the last item.
+     * @return Reverse iterator to the last item.
+     */
+    DReverseIterator rbegin() const
+    {
+        DReverseIterator iterator(mTail);
+        return iterator;
+    }
+
+    /**
+     * @brief Returns a reverse random access iterator that points to the item before the first one.
+     * @return Reverse iterator to the item before the first one.
+     */
+    DReverseIterator rend() const
+    {
+        DReverseIterator iterator(nullptr);
+        return iterator;
+    }
+
+private:
+
+    using ItemAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<CDoublyLinkedListItem<T>>;
+    using ItemTraits = std::allocator_traits<ItemAllocator>;
+
+    using Index = typename TLookupPolicy::template CIndex<T, CDoublyLinkedListItem<T>, TAllocator>;
+    using Jumps = typename TPrefetchPolicy::template CJumps<CDoublyLinkedListItem<T>>;
+
+    static_assert(!(CHasInlineStorage<ItemAllocator>::value && Index::cEnabled),
+                  "Lookup index can't be used with inline storage of items");
+
+    /**
+     * @brief Whether compact() can move values among items without breaking the list or the index.
+     */
+    static constexpr bool cCompactable = !Index::cEnabled
+                                         && std::is_nothrow_move_constructible<T>::value
+                                         && std::is_nothrow_move_assignable<T>::value;
+
+    /**
+     * @brief Largest gap in bytes between neighbouring items which fragmentation() counts as sequential.
+     * One cache line, it leaves room for headers of general purpose allocators.
+     */
+    static constexpr std::uintptr_t cSequentialGap = 64u;
+
+    /**
+     * @brief Lowest number of changes between checks of automatic compaction.
+     */
+    static constexpr uintmax_t cMinCompactionChanges = 64u;
+
+    /**
+     * @brief Allocator of items.
+     */
+    ItemAllocator mAllocator;
+
+    /**
+     * @brief Lookup index of values. Empty class with CNoLookupPolicy.
+     */
+    Index mIndex;
+
+    /**
+     * @brief Pointer to the first item of the list.
+     */
+    CDoublyLinkedListItem<T>* mBegin;
+    CDoublyLinkedListItem<T>* mTail;
+    uintmax_t mSize;
+
+    /**
+     * @brief Last accessed item and its position. Null if there is no valid finger.
+     */
+    mutable CDoublyLinkedListItem<T>* mFinger;
+    mutable uintmax_t mFingerIndex;
+
+    /**
+     * @brief Items at which pushes set jumps. Empty class with CNoPrefetchPolicy.
+     */
+    Jumps mJumps;
+
+    /**
+     * @brief Fragmentation above which the list compacts itself, 0 if it doesn't.
+     * Items added and removed since the last check.
+     */
+    double mCompactionThreshold;
+    uintmax_t mChanges;
+
+    /**
+     * @brief Split points found by splitPoints() and the version of the list they were found for.
+     * The version changes with every change of links, so split points of a changed list aren't used.
+     */
+    struct CSplitPoints
+    {
+        uintmax_t mVersion;
+        std::vector<CDoublyLinkedListItem<T>*> mFirsts;
+    };
+    mutable std::shared_ptr<const CSplitPoints> mSplitPoints;
+    uintmax_t mVersion;
+
+    /**
+     * @brief Finds item at given position. Walks from the beginning, the end or the finger,
+     * whichever is the nearest, and moves the finger to the found item.
+     * @param aIndex Position of item. Must be lower than size.
+     * @return Pointer to the item.
+     */
+    CDoublyLinkedListItem<T>* findItem(const uintmax_t aIndex) const
+    {
+        CDoublyLinkedListItem<T>* item = mBegin;
+        uintmax_t position = 0;
+        uintmax_t distance = aIndex;
+        if (mSize - 1u - aIndex < distance)
+        {
+            item = mTail;
+            position = mSize - 1u;
+            distance = mSize - 1u - aIndex;
+        }
+        if (mFinger != nullptr)
+        {
+            const uintmax_t fingerDistance = (aIndex > mFingerIndex) ? (aIndex - mFingerIndex) : (mFingerIndex - aIndex);
+            if (fingerDistance < distance)
+            {
+                item = mFinger;
+                position = mFingerIndex;
+            }
+        }
+
+        for (; position < aIndex; position++)
+        {
+            TPrefetchPolicy::prefetch(*item);
+            item = item->mNext;
+        }
+        for (; position > aIndex; position--)
+        {
+            item = item->mPrevious;
+        }
+
+        mFinger = item;
+        mFingerIndex = aIndex;
+        return item;
+    }
+
+    /**
+     * @brief Finds item holding given value, in the index if there is one.
+     * @param aValue Value to find.
+     * @return Pointer to the item or null if there isn't the value in the list.
+     */
+    CDoublyLinkedListItem<T>* findItem(const T& aValue) const
+    {
+        if constexpr (Index::cEnabled)
+        {
+            return mIndex.find(aValue);
+        }
+        else
+        {
+            for (CDoublyLinkedListItem<T>* item = mBegin; item != nullptr; item = item->mNext)
+            {
+                TPrefetchPolicy::prefetch(*item);
+                if (item->mValue == aValue)
+                {
+                    return item;
+                }
+            }
+            return nullptr;
+        }
+    }
+
+    /**
+     * @brief Merges two sorted chains of items linked by mNext. Of equal values the ones from the first chain go first.
+     * mPrevious is not updated.
+     * @param aFirst First item of the first chain or null.
+     * @param aSecond First item of the second chain or null.
+     * @param aCompare Comparison the chains are sorted with.
+     * @return First item of the merged chain.
+     */
+    template<typename TCompare>
+    static CDoublyLinkedListItem<T>* mergeItems(CDoublyLinkedListItem<T>* aFirst,
+                                                CDoublyLinkedListItem<T>* aSecond,
+                                                TCompare& aCompare)
+    {
+        CDoublyLinkedListItem<T>* head = nullptr;
+        CDoublyLinkedListItem<T>** last = &head;
+        while ((aFirst != nullptr) && (aSecond != nullptr))
+        {
+            if (aCompare(aSecond->mValue, aFirst->mValue))
+            {
+                *last = aSecond;
+                aSecond = aSecond->mNext;
+            }
+            else
+            {
+                *last = aFirst;
+                aFirst = aFirst->mNext;
+            }
+            last = &((*last)->mNext);
+        }
+        *last = (aFirst != nullptr) ? aFirst : aSecond;
+        return head;
+    }
+
+    /**
+     * @brief Joins pools of allocators of this list and of the other one, if the allocator supports it,
+     * so items of the other list can be relinked into this list.
+     * @param aObj Other list.
+     */
+    void joinAllocator(CDoublyLinkedList& aObj)
+    {
+        if constexpr (CHasJoin<ItemAllocator>::value)
+        {
+            mAllocator.join(aObj.mAllocator);
+        }
+    }
+
+    /**
+     * @brief Merges sorted items behind given item into the sorted items up to it.
+     * @param aLast Last item of the first run, null if the first run is empty.
+     * @param aCompare Comparison the runs are sorted with.
+     */
+    template<typename TCompare>
+    void mergeTail(CDoublyLinkedListItem<T>* const aLast, TCompare& aCompare)
+    {
+        if ((aLast == nullptr) || (aLast->mNext == nullptr))
+        {
+            return;
+        }
+        CDoublyLinkedListItem<T>* const second = aLast->mNext;
+        aLast->mNext = nullptr;
+        relinkItems(mergeItems(mBegin, second, aCompare));
+    }
+
+    /**
+     * @brief Makes chain of items linked by mNext the content of the list. Restores mPrevious,
+     * jumps, the beginning and the end. Size is kept, the finger is dropped.
+     * @param aHead First item of the chain.
+     */
+    void relinkItems(CDoublyLinkedListItem<T>* const aHead)
+    {
+        typename TPrefetchPolicy::template CTrail<CDoublyLinkedListItem<T>> trail;
+        CDoublyLinkedListItem<T>* previous = nullptr;
+        for (CDoublyLinkedListItem<T>* item = aHead; item != nullptr; item = item->mNext)
+        {
+            item->mPrevious = previous;
+            trail.step(item);
+            previous = item;
+        }
+        mBegin = aHead;
+        mTail = previous;
+        mFinger = nullptr;
+        mJumps.reset();
+        mVersion++;
+    }
+
+    /**
+     * @brief Links detached chain of items before given item.
+     * @param aPosition Item before which the chain is put, null to put it at the end.
+     * @param aFirst First item of the chain.
+     * @param aLast Last item of the chain.
+     * @param aCount Number of items in the chain.
+     */
+    void linkItems(CDoublyLinkedListItem<T>* const aPosition,
+                   CDoublyLinkedListItem<T>* const aFirst,
+                   CDoublyLinkedListItem<T>* const aLast,
+                   const uintmax_t aCount)
+    {
+        CDoublyLinkedListItem<T>* previous = (aPosition != nullptr) ? aPosition->mPrevious : mTail;
+        aFirst->mPrevious = previous;
+        aLast->mNext = aPosition;
+        if (previous != nullptr)
+        {
+            previous->mNext = aFirst;
+        }
+        else
+        {
+            mBegin = aFirst;
+        }
+        if (aPosition != nullptr)
+        {
+            aPosition->mPrevious = aLast;
+        }
+        else
+        {
+            mTail = aLast;
+        }
+        mSize += aCount;
+        mFinger = nullptr;
+        mJumps.reset();
+        mVersion++;
+    }
+
+    /**
+     * @brief Unlinks chain of items from the list. Items are neither destroyed nor removed from the index.
+     * @param aFirst First item of the chain.
+     * @param aLast Last item of the chain.
+     * @param aCount Number of items in the chain.
+     */
+    void unlinkItems(CDoublyLinkedListItem<T>* const aFirst,
+                     CDoublyLinkedListItem<T>* const aLast,
+                     const uintmax_t aCount)
+    {
+        if (aFirst->mPrevious != nullptr)
+        {
+            aFirst->mPrevious->mNext = aLast->mNext;
+        }
+        else
+        {
+            mBegin = aLast->mNext;
+        }
+        if (aLast->mNext != nullptr)
+        {
+            aLast->mNext->mPrevious = aFirst->mPrevious;
+        }
+        else
+        {
+            mTail = aFirst->mPrevious;
+        }
+        aFirst->mPrevious = nullptr;
+        aLast->mNext = nullptr;
+        mSize -= aCount;
+        mFinger = nullptr;
+        mJumps.reset();
+        mVersion++;
+    }
+
+    /**
+     * @brief Moves items [aFirst, aEnd) to new list sharing the allocator with this list.
+     * @param aFirst First item to move.
+     * @param aEnd Item after the last one to move, null to move items up to the end.
+     * @return List with moved items.
+     */
+    CDoublyLinkedList extractItems(CDoublyLinkedListItem<T>* const aFirst, CDoublyLinkedListItem<T>* const aEnd)
+    {
+        CDoublyLinkedListItem<T>* last = (aEnd != nullptr) ? aEnd->mPrevious : mTail;
+        uintmax_t count = mSize;
+        if ((aFirst != mBegin) || (aEnd != nullptr))
+        {
+            count = 1u;
+            for (CDoublyLinkedListItem<T>* item = aFirst; item != last; item = item->mNext)
+            {
+                count++;
+            }
+        }
+
+        CDoublyLinkedList part(get_allocator());
+        if constexpr (CHasInlineStorage<ItemAllocator>::value)
+        {
+            // items may lie in the inline storage of this list, so only values are moved
+            for (CDoublyLinkedListItem<T>* item = aFirst; item != aEnd; item = item->mNext)
+            {
+                part.emplaceBack(std::move(item->mValue));
+            }
+            unlinkItems(aFirst, last, count);
+            for (CDoublyLinkedListItem<T>* item = aFirst; item != nullptr; )
+            {
+                CDoublyLinkedListItem<T>* next = item->mNext;
+                destroyItem(item);
+                item = next;
+            }
+            return part;
+        }
+        part.mIndex.splice(mIndex, aFirst, count);
+        unlinkItems(aFirst, last, count);
+        part.linkItems(nullptr, aFirst, last, count);
+        return part;
+    }
+
+    /**
+     * @brief Allocates and constructs new item.
+     * @param aPrevious Previous item.
+     * @param aNext Next item.
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Pointer to the new item.
+     */
+    template<typename... TArgs>
+    CDoublyLinkedListItem<T>* createItem(CDoublyLinkedListItem<T>* const aPrevious,
+                                         CDoublyLinkedListItem<T>* const aNext,
+                                         TArgs&&... aArgs)
+    {
+        CDoublyLinkedListItem<T>* item = ItemTraits::allocate(mAllocator, 1);
+        try
+        {
+            constructItem(item, aPrevious, aNext, std::forward<TArgs>(aArgs)...);
+        }
+        catch (...)
+        {
+            ItemTraits::deallocate(mAllocator, item, 1);
+            throw;
+        }
+        return item;
+    }
+
+    /**
+     * @brief Constructs item in allocated memory and adds it to the index.
+     * Nothing is left constructed if the call throws.
+     * @param aItem Memory of the item.
+     * @param aPrevious Previous item.
+     * @param aNext Next item.
+     * @param aArgs Arguments passed to the constructor of value.
+     */
+    template<typename... TArgs>
+    void constructItem(CDoublyLinkedListItem<T>* const aItem,
+                       CDoublyLinkedListItem<T>* const aPrevious,
+                       CDoublyLinkedListItem<T>* const aNext,
+                       TArgs&&... aArgs)
+    {
+        ItemTraits::construct(mAllocator, aItem, aPrevious, aNext, std::forward<TArgs>(aArgs)...);
+        try
+        {
+            mIndex.add(aItem);
+        }
+        catch (...)
+        {
+            ItemTraits::destroy(mAllocator, aItem);
+            throw;
+        }
+        mChanges++;
+    }
+
+    /**
+     * @brief Creates items with copies of given number of values and links them at the end of the list.
+     * Items are allocated in a batch if the allocator supports it, otherwise one by one.
+     * Nothing is added if the call throws.
+     * @param aFirst Iterator to the first value.
+     * @param aCount Number of values. Must not be 0.
+     */
+    template<typename TIterator>
+    void createItems(TIterator aFirst, const uintmax_t aCount)
+    {
+        CDoublyLinkedListItem<T>* batch = nullptr;
+        if constexpr (CHasBatchAllocation<ItemAllocator>::value)
+        {
+            batch = mAllocator.allocateBatch(aCount);
+        }
+
+        CDoublyLinkedListItem<T>* first = nullptr;
+        CDoublyLinkedListItem<T>* last = nullptr;
+        uintmax_t count = 0;
+        typename TPrefetchPolicy::template CTrail<CDoublyLinkedListItem<T>> trail;
+        try
+        {
+            for (; count < aCount; count++, ++aFirst)
+            {
+                CDoublyLinkedListItem<T>* item = nullptr;
+                if (batch != nullptr)
+                {
+                    item = batch + count;
+                    constructItem(item, last, nullptr, *aFirst);
+                }
+                else
+                {
+                    item = createItem(last, nullptr, *aFirst);
+                }
+
+                if (last != nullptr)
+                {
+                    last->mNext = item;
+                }
+                else
+                {
+                    first = item;
+                }
+                last = item;
+                trail.step(item);
+            }
+        }
+        catch (...)
+        {
+            while (last != nullptr)
+            {
+                CDoublyLinkedListItem<T>* previous = last->mPrevious;
+                mIndex.remove(last);
+                destroyItem(last);
+                last = previous;
+            }
+            if (batch != nullptr)
+            {
+                for (; count < aCount; count++)
+                {
+                    ItemTraits::deallocate(mAllocator, batch + count, 1);
+                }
+            }
+            throw;
+        }
+        linkItems(nullptr, first, last, aCount);
+    }
+
+    /**
+     * @brief Destroys item and returns its memory to the allocator.
+     * @param aItem Item to destroy.
+     */
+    void destroyItem(CDoublyLinkedListItem<T>* const aItem)
+    {
+        mJumps.forget(aItem);
+        mVersion++;
+        ItemTraits::destroy(mAllocator, aItem);
+        ItemTraits::deallocate(mAllocator, aItem, 1);
+        mChanges++;
+    }
+
+    /**
+     * @brief Checks fragmentation once enough items were added and removed since the last check
+     * and compacts the list if it is above the threshold. Must be called only when no item
+     * of the list is held by the caller.
+     */
+    void compactIfFragmented() noexcept
+    {
+        if constexpr (cCompactable)
+        {
+            if ((mCompactionThreshold > 0.0) && (mChanges >= std::max(mSize / 2u, cMinCompactionChanges)))
+            {
+                mChanges = 0;
+                if (fragmentation() > mCompactionThreshold)
+                {
+                    try
+                    {
+                        compact();
+                    }
+                    catch (const std::bad_alloc&)
+                    {
+                        // the list stays as it is, compaction is only an optimization
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Method for initialization empty List
+     */
+    void IniEmptyList()
+    {
+        mBegin = nullptr;
+        mTail = nullptr;
+        mSize = 0;
+        mFinger = nullptr;
+        mFingerIndex = 0;
+        mJumps.reset();
+        mVersion++;
+    }
+
+    /**
+     * @brief Method which at all clear List
+     */
+
+    void ClearList()
+    {
+        if (empty())
+        {
+            return;
+        }
+
+        mIndex.clear();
+        CDoublyLinkedListItem<T>* item = mBegin;
+        while (item != nullptr)
+        {
+            TPrefetchPolicy::prefetch(*item);
+            CDoublyLinkedListItem<T>* next = item->mNext;
+            destroyItem(item);
+            item = next;
+        }
+
+        IniEmptyList();
+    }
 
 };
 
+/**
+ * @brief Exchanges items of two lists.
+ * Complexity: O(1)
+ */
+template<typename T, typename TAllocator, typename TLookupPolicy, typename TPrefetchPolicy>
+void swap(CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aFirst,
+          CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aSecond) noexcept(noexcept(aFirst.swap(aSecond)))
+{
+    aFirst.swap(aSecond);
+}
+
+/**
+ * @brief Doubly Linked List which takes items from a std::pmr::memory_resource.
+ * @tparam T Type of items.
+ */
+template<typename T>
+using CPmrDoublyLinkedList = CDoublyLinkedList<T, std::pmr::polymorphic_allocator<T>>;
+
+/**
+ * @brief Doubly Linked List which keeps its first N items inside the list object and takes
+ * further items from the pool. Short lists of up to N items make no heap allocation.
+ * Moving or swapping such lists moves values one by one, so it is O(n).
+ * @tparam T Type of items.
+ * @tparam N Number of items kept inside the list object, at most 64.
+ */
+template<typename T, std::size_t N>
+using CSmallDoublyLinkedList = CDoublyLinkedList<T, CDoublyLinkedListInlineAllocator<T, N>>;
+
+/**
+ * @brief Doubly Linked List with a hash index of values, contains() and find() are O(1) expected.
+ * @tparam T Type of items. Has to be hashable with std::hash.
+ * @tparam TAllocator Allocator of items and of the index.
+ */
+template<typename T, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+using CHashDoublyLinkedList = CDoublyLinkedList<T, TAllocator, CHashLookupPolicy<>>;
+
+/**
+ * @brief Doubly Linked List which prefetches items ahead through jump pointers while traversing forward.
+ * Meant for long lists which don't fit in cache, see CJumpPrefetchPolicy.
+ * @tparam T Type of items.
+ * @tparam TAllocator Allocator of items.
+ */
+template<typename T, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+using CPrefetchDoublyLinkedList = CDoublyLinkedList<T, TAllocator, CNoLookupPolicy, CJumpPrefetchPolicy<>>;
+
 #endif
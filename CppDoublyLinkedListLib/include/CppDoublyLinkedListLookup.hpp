@@ -0,0 +1,251 @@
+#ifndef CPP_DOUBLY_LINKED_LIST_LOOKUP_HPP_
+#define CPP_DOUBLY_LINKED_LIST_LOOKUP_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @brief Lookup policy of CDoublyLinkedList which keeps no index.
+ * contains() and find() scan the list. The list pays nothing for the policy.
+ */
+struct CNoLookupPolicy
+{
+    /**
+     * @brief Empty index.
+     * @tparam TValue Type of values.
+     * @tparam TNode Type of list items.
+     * @tparam TAllocator Allocator of the list.
+     */
+    template<typename TValue, typename TNode, typename TAllocator>
+    class CIndex
+    {
+    public:
+
+        static constexpr bool cEnabled = false;
+
+        template<typename TOtherAllocator>
+        explicit CIndex(const TOtherAllocator&)
+        {}
+
+        void add(TNode* const) {}
+
+        void remove(TNode* const) noexcept {}
+
+        TNode* find(const TValue&) const
+        {
+            return nullptr;
+        }
+
+        void clear() noexcept {}
+
+        void splice(CIndex&) noexcept {}
+
+        void splice(CIndex&, TNode* const, const std::size_t) noexcept {}
+
+        void swap(CIndex&) noexcept {}
+    };
+};
+
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Lookup policy of CDoublyLinkedList which keeps a hash index of items.
+ * contains() and find() are O(1) expected. Each item costs one extra hash map entry,
+ * allocated with the allocator of the list.
+ * Values are hashed with THash and compared with operator==. A value must not be changed through
+ * an iterator in a way which changes its hash while it is in the list.
+ * @tparam THash Hash function template, instantiated for the type of values.
+ */
+template<template<typename> class THash = std::hash>
+struct CHashLookupPolicy
+{
+    /**
+     * @brief Hash index. Maps hash of value to items holding it, so values are not copied into the index.
+     * @tparam TValue Type of values.
+     * @tparam TNode Type of list items. Value is accessed as mValue.
+     * @tparam TAllocator Allocator of the list.
+     */
+    template<typename TValue, typename TNode, typename TAllocator>
+    class CIndex
+    {
+    public:
+
+        static constexpr bool cEnabled = true;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        /**
+         * @brief Creates empty index.
+         * @param aAllocator Allocator of the list or its rebound copy.
+         */
+        template<typename TOtherAllocator>
+        explicit CIndex(const TOtherAllocator& aAllocator)
+            : mMap(0, CIdentityHash(), std::equal_to<std::size_t>(), MapAllocator(aAllocator))
+        {}
+
+        /*----------------------------------------------------------------------
+                                    Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Adds item to the index.
+         * Complexity: O(1) expected.
+         * @param aNode Item with constructed value.
+         */
+        void add(TNode* const aNode)
+        {
+            mMap.emplace(THash<TValue>()(aNode->mValue), aNode);
+        }
+
+        /**
+         * @brief Removes item from the index. Has to be called while the value is still unchanged.
+         * Complexity: O(1) expected.
+         * @param aNode Item in the index.
+         */
+        void remove(TNode* const aNode) noexcept
+        {
+            auto it = findEntry(aNode);
+            if (it != mMap.end())
+            {
+                mMap.erase(it);
+            }
+        }
+
+        /**
+         * @brief Finds any item holding given value.
+         * Complexity: O(1) expected.
+         * @param aValue Value to find.
+         * @return Pointer to the item or null if there isn't such value.
+         */
+        TNode* find(const TValue& aValue) const
+        {
+            auto range = mMap.equal_range(THash<TValue>()(aValue));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second->mValue == aValue)
+                {
+                    return it->second;
+                }
+            }
+            return nullptr;
+        }
+
+        void clear() noexcept
+        {
+            mMap.clear();
+        }
+
+        /**
+         * @brief Takes over all items of the other index. Nothing is changed if the call throws.
+         * Entries are copied, node handles (merge, extract) are not used because libstdc++ leaks
+         * copies of stateful allocators held by them.
+         * Complexity: O(n) expected, n is the size of the other index.
+         * @param aOther Other index. It is empty afterwards.
+         */
+        void splice(CIndex& aOther)
+        {
+            for (auto it = aOther.mMap.begin(); it != aOther.mMap.end(); ++it)
+            {
+                try
+                {
+                    mMap.insert(*it);
+                }
+                catch (...)
+                {
+                    for (auto added = aOther.mMap.begin(); added != it; ++added)
+                    {
+                        remove(added->second);
+                    }
+                    throw;
+                }
+            }
+            aOther.mMap.clear();
+        }
+
+        /**
+         * @brief Takes over given items of the other index. Nothing is changed if the call throws.
+         * Entries are copied, see splice(CIndex&).
+         * Complexity: O(k) expected.
+         * @param aOther Other index.
+         * @param aFirst First item to take over.
+         * @param aCount Number of items to take over, linked by mNext from the first one.
+         */
+        void splice(CIndex& aOther, TNode* const aFirst, const std::size_t aCount)
+        {
+            TNode* node = aFirst;
+            for (std::size_t i = 0; i < aCount; i++)
+            {
+                try
+                {
+                    mMap.insert(*aOther.findEntry(node));
+                }
+                catch (...)
+                {
+                    for (TNode* added = aFirst; added != node; added = added->mNext)
+                    {
+                        remove(added);
+                    }
+                    throw;
+                }
+                node = node->mNext;
+            }
+            node = aFirst;
+            for (std::size_t i = 0; i < aCount; i++)
+            {
+                aOther.mMap.erase(aOther.findEntry(node));
+                node = node->mNext;
+            }
+        }
+
+        void swap(CIndex& aOther) noexcept
+        {
+            mMap.swap(aOther.mMap);
+        }
+
+    private:
+
+        /**
+         * @brief Finds entry of given item.
+         * @param aNode Item in the index.
+         * @return Iterator to the entry or end if the item isn't in the index.
+         */
+        auto findEntry(TNode* const aNode) const
+        {
+            auto range = mMap.equal_range(THash<TValue>()(aNode->mValue));
+            for (auto it = range.first; it != range.second; ++it)
+            {
+                if (it->second == aNode)
+                {
+                    return it;
+                }
+            }
+            return mMap.end();
+        }
+
+        /**
+         * @brief Keys are already hashes.
+         */
+        struct CIdentityHash
+        {
+            std::size_t operator()(const std::size_t aKey) const noexcept
+            {
+                return aKey;
+            }
+        };
+
+        using MapAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<std::pair<const std::size_t, TNode*>>;
+
+        std::unordered_multimap<std::size_t, TNode*, CIdentityHash, std::equal_to<std::size_t>, MapAllocator> mMap;
+    };
+};
+
+#endif
@@ -0,0 +1,633 @@
+#ifndef CPP_DOUBLY_LINKED_LIST_PARALLEL_HPP_
+#define CPP_DOUBLY_LINKED_LIST_PARALLEL_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Fixed set of threads which run batches of numbered tasks for the parallel list algorithms.
+ * The thread which calls run() works on the batch too, so a pool of one thread has no workers
+ * and runs everything in the caller.
+ * Batches from several threads are run one after another. A task must not call run() of its pool.
+ */
+class CDoublyLinkedListThreadPool
+{
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Starts the workers.
+     * @param aThreads Number of threads which run tasks, the calling thread included.
+     */
+    explicit CDoublyLinkedListThreadPool(const std::size_t aThreads = std::thread::hardware_concurrency())
+    {
+        const std::size_t workers = std::max<std::size_t>(aThreads, 1u) - 1u;
+        mWorkers.reserve(workers);
+        try
+        {
+            for (std::size_t i = 0; i < workers; i++)
+            {
+                mWorkers.emplace_back([this]() { work(); });
+            }
+        }
+        catch (...)
+        {
+            stop();
+            throw;
+        }
+    }
+
+    CDoublyLinkedListThreadPool(const CDoublyLinkedListThreadPool&) = delete;
+
+    /**
+     * @brief Stops and joins the workers. No batch may be running.
+     */
+    ~CDoublyLinkedListThreadPool()
+    {
+        stop();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CDoublyLinkedListThreadPool& operator=(const CDoublyLinkedListThreadPool&) = delete;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns the number of threads which run tasks, the calling thread included.
+     * @return Number of threads.
+     */
+    std::size_t size() const noexcept
+    {
+        return mWorkers.size() + 1u;
+    }
+
+    /**
+     * @brief Runs tasks 0 to aCount - 1 on the workers and the calling thread and waits for all of them.
+     * If tasks throw, the remaining ones still run and the first exception is rethrown.
+     * @param aCount Number of tasks.
+     * @param aTask Function called with the number of the task.
+     */
+    template<typename TTask>
+    void run(const std::size_t aCount, TTask&& aTask)
+    {
+        std::lock_guard<std::mutex> batchLock(mBatchMutex);
+        CBatch batch(aCount, [&aTask](const std::size_t aNumber) { aTask(aNumber); });
+
+        std::unique_lock<std::mutex> lock(mMutex);
+        mBatch = &batch;
+        mGeneration++;
+        lock.unlock();
+        mWake.notify_all();
+
+        runTasks(batch);
+
+        lock.lock();
+        mIdle.wait(lock, [this]() { return mActive == 0u; });
+        mBatch = nullptr;
+        lock.unlock();
+
+        if (batch.mError)
+        {
+            std::rethrow_exception(batch.mError);
+        }
+    }
+
+private:
+
+    /**
+     * @brief Batch of tasks, lives on the stack of run().
+     */
+    struct CBatch
+    {
+        CBatch(const std::size_t aCount, std::function<void(std::size_t)> aTask)
+            : mTask(std::move(aTask))
+            , mCount(aCount)
+            , mNext(0u)
+        {}
+
+        std::function<void(std::size_t)> mTask;
+        const std::size_t mCount;
+
+        /**
+         * @brief Number of the next task to take.
+         */
+        std::atomic<std::size_t> mNext;
+
+        /**
+         * @brief The first exception thrown by a task, guarded by mErrorMutex.
+         */
+        std::exception_ptr mError;
+        std::mutex mErrorMutex;
+    };
+
+    /**
+     * @brief Takes tasks of batch until there are none left.
+     * @param aBatch Batch.
+     */
+    static void runTasks(CBatch& aBatch)
+    {
+        for (std::size_t number = aBatch.mNext.fetch_add(1u, std::memory_order_relaxed); number < aBatch.mCount;
+             number = aBatch.mNext.fetch_add(1u, std::memory_order_relaxed))
+        {
+            try
+            {
+                aBatch.mTask(number);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock(aBatch.mErrorMutex);
+                if (!aBatch.mError)
+                {
+                    aBatch.mError = std::current_exception();
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Loop of worker. Waits for a batch it hasn't seen yet and helps with it.
+     */
+    void work()
+    {
+        std::size_t seen = 0u;
+        std::unique_lock<std::mutex> lock(mMutex);
+        for (;;)
+        {
+            mWake.wait(lock, [this, seen]() { return mStop || ((mBatch != nullptr) && (mGeneration != seen)); });
+            if (mStop)
+            {
+                return;
+            }
+
+            seen = mGeneration;
+            CBatch* batch = mBatch;
+            mActive++;
+            lock.unlock();
+            runTasks(*batch);
+            lock.lock();
+            if (--mActive == 0u)
+            {
+                mIdle.notify_one();
+            }
+        }
+    }
+
+    /**
+     * @brief Stops and joins the workers.
+     */
+    void stop() noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mMutex);
+            mStop = true;
+        }
+        mWake.notify_all();
+        for (std::thread& worker : mWorkers)
+        {
+            worker.join();
+        }
+        mWorkers.clear();
+    }
+
+    std::vector<std::thread> mWorkers;
+
+    /**
+     * @brief Serializes batches of different callers.
+     */
+    std::mutex mBatchMutex;
+
+    /**
+     * @brief Guards the fields below. Workers wait on mWake for a batch, run() waits on mIdle for workers.
+     */
+    std::mutex mMutex;
+    std::condition_variable mWake;
+    std::condition_variable mIdle;
+
+    /**
+     * @brief Current batch, null between batches. Its number, which tells workers a new batch from the old one.
+     */
+    CBatch* mBatch = nullptr;
+    std::size_t mGeneration = 0u;
+
+    /**
+     * @brief Number of workers working on the current batch.
+     */
+    std::size_t mActive = 0u;
+    bool mStop = false;
+};
+
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Checks if list keeps its split points, see CDoublyLinkedList::splitPoints().
+ * @tparam TList List.
+ */
+template<typename TList, typename = void>
+struct CHasSplitPoints : std::false_type
+{};
+
+template<typename TList>
+struct CHasSplitPoints<TList, std::void_t<decltype(std::declval<TList&>().splitPoints(std::size_t()))>>
+    : std::true_type
+{};
+
+/**
+ * @brief Checks if list lets functions change its values in place, see CDoublyLinkedList::visit().
+ * @tparam TList List.
+ * @tparam TFunction Function.
+ */
+template<typename TList, typename TFunction, typename = void>
+struct CHasVisit : std::false_type
+{};
+
+template<typename TList, typename TFunction>
+struct CHasVisit<TList, TFunction, std::void_t<decltype(std::declval<TList&>().visit(
+    std::declval<TList&>().begin(), std::size_t(), std::declval<TFunction&>()))>>
+    : std::true_type
+{};
+
+/**
+ * @brief Split points of a list for the parallel algorithms: the first item of each segment.
+ * They are found by one pass over the list, which is sequential. CDoublyLinkedList keeps its
+ * split points until it is changed, so only the first scan of an unchanged list pays the pass.
+ * For other lists, a list which is scanned several times without changes should be split once
+ * and the segments reused. Segments are valid as long as the list isn't changed.
+ *
+ * The number of segments depends only on the number of items, not on the number of threads,
+ * so results of parallelReduce() are the same on every machine.
+ * @tparam TIterator Forward iterator of the list.
+ */
+template<typename TIterator>
+class CDoublyLinkedListSegments
+{
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Lowest number of items of a segment, smaller work isn't worth a thread.
+     */
+    static constexpr std::size_t cMinItems = 1u << 14;
+
+    /**
+     * @brief Highest number of segments.
+     */
+    static constexpr std::size_t cMaxSegments = 256u;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Splits items [aFirst, aLast) into segments of nearly equal size.
+     * Complexity: O(n) - because it has to pass for all item.
+     * @param aFirst Iterator to the first item.
+     * @param aLast Iterator to the item after the last one.
+     * @param aSize Number of items in the range.
+     */
+    CDoublyLinkedListSegments(TIterator aFirst, TIterator aLast, const std::size_t aSize)
+        : mLast(aLast)
+        , mSize(aSize)
+        , mCount(count(aSize))
+    {
+        split(aFirst);
+    }
+
+    /**
+     * @brief Splits all items of list. Split points kept by the list are reused.
+     * Complexity: O(n), O(1) for an unchanged list which keeps its split points.
+     * @param aList List, the segments refer to values through its iterators for const or non-const list.
+     */
+    template<typename TList, typename = decltype(std::declval<TList&>().begin())>
+    explicit CDoublyLinkedListSegments(TList& aList)
+        : mLast(aList.end())
+        , mSize(static_cast<std::size_t>(aList.size()))
+        , mCount(count(mSize))
+    {
+        if constexpr (CHasSplitPoints<TList>::value)
+        {
+            mFirsts = aList.splitPoints(mCount);
+        }
+        else
+        {
+            split(aList.begin());
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns the number of segments, 0 for an empty range.
+     * @return Number of segments.
+     */
+    std::size_t size() const noexcept
+    {
+        return mCount;
+    }
+
+    /**
+     * @brief Returns iterator to the first item of segment.
+     * @param aSegment Number of segment.
+     * @return Iterator to the first item.
+     */
+    TIterator first(const std::size_t aSegment) const
+    {
+        return mFirsts[aSegment];
+    }
+
+    /**
+     * @brief Returns the number of items of segment, the first segments are one item longer than the rest.
+     * @param aSegment Number of segment.
+     * @return Number of items.
+     */
+    std::size_t items(const std::size_t aSegment) const noexcept
+    {
+        return (mSize / mCount) + ((aSegment < (mSize % mCount)) ? 1u : 0u);
+    }
+
+    /**
+     * @brief Returns iterator to the item after the last one of the whole range.
+     * @return Iterator to the end.
+     */
+    TIterator last() const
+    {
+        return mLast;
+    }
+
+private:
+
+    /**
+     * @brief Returns the number of segments of given number of items.
+     */
+    static std::size_t count(const std::size_t aSize) noexcept
+    {
+        return std::min(cMaxSegments, (aSize + cMinItems - 1u) / cMinItems);
+    }
+
+    /**
+     * @brief Finds the first items of segments by one pass from given item.
+     */
+    void split(TIterator aFirst)
+    {
+        mFirsts.reserve(mCount);
+        for (std::size_t segment = 0; segment < mCount; segment++)
+        {
+            mFirsts.push_back(aFirst);
+            if (segment + 1u < mCount)
+            {
+                for (std::size_t i = 0; i < items(segment); i++)
+                {
+                    ++aFirst;
+                }
+            }
+        }
+    }
+
+    std::vector<TIterator> mFirsts;
+    TIterator mLast;
+
+    /**
+     * @brief Number of items and number of segments.
+     */
+    std::size_t mSize;
+    std::size_t mCount;
+};
+
+template<typename TList>
+CDoublyLinkedListSegments(TList&) -> CDoublyLinkedListSegments<decltype(std::declval<TList&>().begin())>;
+
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Calls function for every value of segments, segments run in parallel.
+ * The function must be safe to call for different values at once.
+ * @param aSegments Segments of the list.
+ * @param aPool Threads.
+ * @param aFunction Function called with reference to value.
+ */
+template<typename TIterator, typename TFunction>
+void parallelForEach(const CDoublyLinkedListSegments<TIterator>& aSegments,
+                     CDoublyLinkedListThreadPool& aPool,
+                     TFunction aFunction)
+{
+    aPool.run(aSegments.size(), [&aSegments, &aFunction](const std::size_t aSegment)
+    {
+        TIterator iterator = aSegments.first(aSegment);
+        for (std::size_t i = aSegments.items(aSegment); i > 0u; i--, ++iterator)
+        {
+            aFunction(*iterator);
+        }
+    });
+}
+
+/**
+ * @brief Calls function for every value of list, segments run in parallel. A non-const list which
+ * lets functions change its values in place, like CDoublyLinkedList without a lookup index,
+ * passes non-const references.
+ * @see parallelForEach(const CDoublyLinkedListSegments<TIterator>&, CDoublyLinkedListThreadPool&, TFunction)
+ */
+template<typename TList, typename TFunction, typename = decltype(std::declval<TList&>().begin())>
+void parallelForEach(TList& aList, CDoublyLinkedListThreadPool& aPool, TFunction aFunction)
+{
+    const CDoublyLinkedListSegments segments(aList);
+    if constexpr (CHasVisit<TList, TFunction>::value)
+    {
+        aPool.run(segments.size(), [&aList, &segments, &aFunction](const std::size_t aSegment)
+        {
+            aList.visit(segments.first(aSegment), segments.items(aSegment), aFunction);
+        });
+    }
+    else
+    {
+        parallelForEach(segments, aPool, std::move(aFunction));
+    }
+}
+
+/**
+ * @brief Combines values of segments with operation. Every segment is folded from left to right
+ * starting with its first value, then aInitial and the results of segments are folded in list order.
+ * The grouping depends only on the number of values, so the result is deterministic, and it equals
+ * the sequential fold if the operation is associative.
+ * @param aSegments Segments of the list.
+ * @param aPool Threads.
+ * @param aInitial Initial value.
+ * @param aOperation Operation, called with (TResult, value) and (TResult, TResult).
+ * @return Result of the fold, aInitial if there are no values.
+ */
+template<typename TIterator, typename TResult, typename TOperation>
+TResult parallelReduce(const CDoublyLinkedListSegments<TIterator>& aSegments,
+                       CDoublyLinkedListThreadPool& aPool,
+                       TResult aInitial,
+                       TOperation aOperation)
+{
+    std::vector<std::optional<TResult>> results(aSegments.size());
+    aPool.run(aSegments.size(), [&aSegments, &aOperation, &results](const std::size_t aSegment)
+    {
+        TIterator iterator = aSegments.first(aSegment);
+        TResult result(*iterator);
+        ++iterator;
+        for (std::size_t i = aSegments.items(aSegment) - 1u; i > 0u; i--, ++iterator)
+        {
+            result = aOperation(std::move(result), *iterator);
+        }
+        results[aSegment].emplace(std::move(result));
+    });
+
+    for (std::optional<TResult>& result : results)
+    {
+        aInitial = aOperation(std::move(aInitial), std::move(*result));
+    }
+    return aInitial;
+}
+
+/**
+ * @see parallelReduce(const CDoublyLinkedListSegments<TIterator>&, CDoublyLinkedListThreadPool&, TResult, TOperation)
+ */
+template<typename TList, typename TResult, typename TOperation>
+TResult parallelReduce(const TList& aList, CDoublyLinkedListThreadPool& aPool, TResult aInitial, TOperation aOperation)
+{
+    return parallelReduce(CDoublyLinkedListSegments(aList), aPool, std::move(aInitial), std::move(aOperation));
+}
+
+/**
+ * @brief Finds the first value in list order which satisfies predicate. Segments after a segment
+ * with a match stop early, so the predicate may not be called for all values.
+ * @param aSegments Segments of the list.
+ * @param aPool Threads.
+ * @param aPredicate Predicate, must be safe to call for different values at once.
+ * @return Iterator to the first value which satisfies predicate, end of the range if there is none.
+ */
+template<typename TIterator, typename TPredicate>
+TIterator parallelFindIf(const CDoublyLinkedListSegments<TIterator>& aSegments,
+                         CDoublyLinkedListThreadPool& aPool,
+                         TPredicate aPredicate)
+{
+    // segments check the first found segment once per this number of items
+    static constexpr std::size_t cCheckMask = 1023u;
+
+    std::atomic<std::size_t> found(aSegments.size());
+    std::vector<std::optional<TIterator>> results(aSegments.size());
+    aPool.run(aSegments.size(), [&aSegments, &aPredicate, &found, &results](const std::size_t aSegment)
+    {
+        TIterator iterator = aSegments.first(aSegment);
+        const std::size_t items = aSegments.items(aSegment);
+        for (std::size_t i = 0; i < items; i++, ++iterator)
+        {
+            if (((i & cCheckMask) == 0u) && (found.load(std::memory_order_relaxed) < aSegment))
+            {
+                return;
+            }
+            if (aPredicate(*iterator))
+            {
+                results[aSegment].emplace(iterator);
+                std::size_t first = found.load(std::memory_order_relaxed);
+                while ((aSegment < first) && !found.compare_exchange_weak(first, aSegment, std::memory_order_relaxed))
+                {}
+                return;
+            }
+        }
+    });
+
+    const std::size_t first = found.load(std::memory_order_relaxed);
+    return (first < aSegments.size()) ? *results[first] : aSegments.last();
+}
+
+/**
+ * @see parallelFindIf(const CDoublyLinkedListSegments<TIterator>&, CDoublyLinkedListThreadPool&, TPredicate)
+ */
+template<typename TList, typename TPredicate>
+auto parallelFindIf(const TList& aList, CDoublyLinkedListThreadPool& aPool, TPredicate aPredicate)
+{
+    return parallelFindIf(CDoublyLinkedListSegments(aList), aPool, std::move(aPredicate));
+}
+
+/**
+ * @brief Finds the first item with given value, the parallel counterpart of find().
+ * @param aList List.
+ * @param aPool Threads.
+ * @param aValue Value to find.
+ * @return Iterator to the first item with the value, end() if there is none.
+ */
+template<typename TList, typename TValue>
+auto parallelFind(const TList& aList, CDoublyLinkedListThreadPool& aPool, const TValue& aValue)
+{
+    return parallelFindIf(aList, aPool, [&aValue](const auto& aItem) { return aItem == aValue; });
+}
+
+/**
+ * @brief Counts values of segments which satisfy predicate.
+ * @param aSegments Segments of the list.
+ * @param aPool Threads.
+ * @param aPredicate Predicate, must be safe to call for different values at once.
+ * @return Number of values which satisfy predicate.
+ */
+template<typename TIterator, typename TPredicate>
+std::size_t parallelCountIf(const CDoublyLinkedListSegments<TIterator>& aSegments,
+                            CDoublyLinkedListThreadPool& aPool,
+                            TPredicate aPredicate)
+{
+    std::vector<std::size_t> counts(aSegments.size(), 0u);
+    aPool.run(aSegments.size(), [&aSegments, &aPredicate, &counts](const std::size_t aSegment)
+    {
+        TIterator iterator = aSegments.first(aSegment);
+        std::size_t count = 0u;
+        for (std::size_t i = aSegments.items(aSegment); i > 0u; i--, ++iterator)
+        {
+            if (aPredicate(*iterator))
+            {
+                count++;
+            }
+        }
+        counts[aSegment] = count;
+    });
+
+    std::size_t count = 0u;
+    for (const std::size_t segmentCount : counts)
+    {
+        count += segmentCount;
+    }
+    return count;
+}
+
+/**
+ * @see parallelCountIf(const CDoublyLinkedListSegments<TIterator>&, CDoublyLinkedListThreadPool&, TPredicate)
+ */
+template<typename TList, typename TPredicate>
+std::size_t parallelCountIf(const TList& aList, CDoublyLinkedListThreadPool& aPool, TPredicate aPredicate)
+{
+    return parallelCountIf(CDoublyLinkedListSegments(aList), aPool, std::move(aPredicate));
+}
+
+#endif
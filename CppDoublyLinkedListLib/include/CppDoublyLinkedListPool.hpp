@@ -0,0 +1,603 @@
+#ifndef CPP_DOUBLY_LINKED_LIST_POOL_HPP_
+#define CPP_DOUBLY_LINKED_LIST_POOL_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Slab allocator for fixed size nodes. Nodes are carved out of large blocks
+ * and released nodes are kept on a free list for reuse, so the global heap is only
+ * touched when a new block is needed.
+ * Pools can be joined: joined pools keep their own free lists, but their blocks belong
+ * to all of them, so a node of one pool may be released to another one. Blocks are returned
+ * when the last of the joined pools is destroyed.
+ * The pool is not thread safe, and joined pools must not be used from different threads at once.
+ */
+class CDoublyLinkedListNodePool
+{
+public:
+
+    /*----------------------------------------------------------------------
+                            Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CDoublyLinkedListNodePool(const std::size_t aNodeSize, const std::size_t aNodeAlignment)
+        : mNodeSize(roundUp(aNodeSize < sizeof(CFreeNode) ? sizeof(CFreeNode) : aNodeSize,
+                            aNodeAlignment < alignof(CFreeNode) ? alignof(CFreeNode) : aNodeAlignment))
+        , mNodeAlignment(aNodeAlignment < alignof(CFreeNode) ? alignof(CFreeNode) : aNodeAlignment)
+        , mHeaderSize(roundUp(sizeof(CBlock), mNodeAlignment))
+        , mFreeList(nullptr)
+        , mCursor(nullptr)
+        , mEnd(nullptr)
+        , mNextBlockNodes(cFirstBlockNodes)
+        , mOwner(std::make_shared<CBlockOwner>())
+    {}
+
+    CDoublyLinkedListNodePool(const CDoublyLinkedListNodePool&) = delete;
+
+    CDoublyLinkedListNodePool& operator=(const CDoublyLinkedListNodePool&) = delete;
+
+    ~CDoublyLinkedListNodePool() = default;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns memory for one node.
+     * Complexity: O(1) - amortized, a new block is allocated only when the current one is used up.
+     * @return Pointer to uninitialized node memory.
+     */
+    void* allocate()
+    {
+        if (mFreeList != nullptr)
+        {
+            CFreeNode* node = mFreeList;
+            mFreeList = node->mNext;
+            return node;
+        }
+
+        if (mCursor == mEnd)
+        {
+            grow();
+        }
+
+        void* node = mCursor;
+        mCursor += mNodeSize;
+        return node;
+    }
+
+    /**
+     * @brief Returns memory for given number of nodes placed one after another, mNodeSize bytes apart.
+     * Nodes are taken from the current block or, if it is too small, from a new block.
+     * Each node may be released on its own with deallocate().
+     * Complexity: O(1) - plus moving rest of the current block to the free list when a new block is needed.
+     * @param aCount Number of nodes. Must not be 0.
+     * @return Pointer to uninitialized memory of the first node.
+     */
+    void* allocateBatch(const std::size_t aCount)
+    {
+        if (static_cast<std::size_t>(mEnd - mCursor) < aCount * mNodeSize)
+        {
+            while (mCursor != mEnd)
+            {
+                deallocate(mCursor);
+                mCursor += mNodeSize;
+            }
+            grow(aCount);
+        }
+
+        void* nodes = mCursor;
+        mCursor += aCount * mNodeSize;
+        return nodes;
+    }
+
+    /**
+     * @brief Puts node back on the free list.
+     * Complexity: O(1)
+     * @param aNode Node returned by allocate() or allocateBatch().
+     */
+    void deallocate(void* const aNode) noexcept
+    {
+        CFreeNode* node = static_cast<CFreeNode*>(aNode);
+        node->mNext = mFreeList;
+        mFreeList = node;
+    }
+
+    /**
+     * @brief Checks if pool can serve an object of given size and alignment.
+     */
+    bool fits(const std::size_t aSize, const std::size_t aAlignment) const
+    {
+        return (aSize <= mNodeSize) && (aAlignment <= mNodeAlignment);
+    }
+
+    /**
+     * @brief Returns size of one node, which is the distance between nodes returned by allocateBatch().
+     */
+    std::size_t nodeSize() const
+    {
+        return mNodeSize;
+    }
+
+    /**
+     * @brief Joins blocks of this pool and of the other one, and of all pools joined with them before.
+     * Nodes of each pool may be released to any of them afterwards.
+     * Complexity: O(1) - amortized, see owner().
+     * @param aOther Other pool.
+     */
+    void join(CDoublyLinkedListNodePool& aOther)
+    {
+        CBlockOwner& owner = this->owner();
+        CBlockOwner& other = aOther.owner();
+        if (&owner == &other)
+        {
+            return;
+        }
+        if (other.mFirst != nullptr)
+        {
+            other.mLast->mNext = owner.mFirst;
+            if (owner.mFirst == nullptr)
+            {
+                owner.mLast = other.mLast;
+            }
+            owner.mFirst = other.mFirst;
+            other.mFirst = nullptr;
+            other.mLast = nullptr;
+        }
+        other.mJoined = mOwner;
+        aOther.mOwner = mOwner;
+    }
+
+    /**
+     * @brief Checks if nodes of this pool may be released to the other one, which is the case for joined pools.
+     */
+    bool isJoined(const CDoublyLinkedListNodePool& aOther) const
+    {
+        return (this == &aOther) || (&owner() == &aOther.owner());
+    }
+
+private:
+
+    /**
+     * @brief Header placed at the beginning of each block.
+     */
+    struct CBlock
+    {
+        CBlock* mNext;
+    };
+
+    /**
+     * @brief Owner of blocks of joined pools. The owner of a pool which was joined to another one
+     * gives its blocks away and refers to the owner of the other pool instead.
+     */
+    struct CBlockOwner
+    {
+        CBlockOwner() = default;
+
+        CBlockOwner(const CBlockOwner&) = delete;
+
+        CBlockOwner& operator=(const CBlockOwner&) = delete;
+
+        ~CBlockOwner()
+        {
+            while (mFirst != nullptr)
+            {
+                CBlock* next = mFirst->mNext;
+                ::operator delete(mFirst);
+                mFirst = next;
+            }
+        }
+
+        /**
+         * @brief Blocks, the newest one first.
+         */
+        CBlock* mFirst = nullptr;
+        CBlock* mLast = nullptr;
+
+        /**
+         * @brief Owner which took the blocks over, null while this owner holds them.
+         */
+        std::shared_ptr<CBlockOwner> mJoined;
+    };
+
+    /**
+     * @brief Released node. Link is stored in the node memory itself.
+     */
+    struct CFreeNode
+    {
+        CFreeNode* mNext;
+    };
+
+    /**
+     * @brief Number of nodes in the first block.
+     */
+    static const std::size_t cFirstBlockNodes = 32u;
+
+    /**
+     * @brief Maximal number of nodes in one block. Blocks grow geometrically up to this size.
+     */
+    static const std::size_t cMaxBlockNodes = 4096u;
+
+    static std::size_t roundUp(const std::size_t aValue, const std::size_t aAlignment)
+    {
+        return (aValue + aAlignment - 1u) / aAlignment * aAlignment;
+    }
+
+    /**
+     * @brief Allocates new block and makes it current.
+     * @param aMinNodes Minimal number of nodes in the block.
+     */
+    void grow(const std::size_t aMinNodes = 1u)
+    {
+        const std::size_t nodes = (aMinNodes > mNextBlockNodes) ? aMinNodes : mNextBlockNodes;
+        CBlock* block = static_cast<CBlock*>(::operator new(mHeaderSize + nodes * mNodeSize));
+        CBlockOwner& owner = this->owner();
+        block->mNext = owner.mFirst;
+        owner.mFirst = block;
+        if (owner.mLast == nullptr)
+        {
+            owner.mLast = block;
+        }
+
+        mCursor = reinterpret_cast<char*>(block) + mHeaderSize;
+        mEnd = mCursor + nodes * mNodeSize;
+
+        if (mNextBlockNodes < cMaxBlockNodes)
+        {
+            mNextBlockNodes *= 2u;
+        }
+    }
+
+    /**
+     * @brief Returns the owner which holds the blocks and moves the pool to it, so a chain
+     * of joined owners is walked only once.
+     */
+    CBlockOwner& owner() const
+    {
+        while (mOwner->mJoined)
+        {
+            mOwner = mOwner->mJoined;
+        }
+        return *mOwner;
+    }
+
+    const std::size_t mNodeSize;
+    const std::size_t mNodeAlignment;
+    const std::size_t mHeaderSize;
+    CFreeNode* mFreeList;
+    char* mCursor;
+    char* mEnd;
+    std::size_t mNextBlockNodes;
+
+    /**
+     * @brief Owner of blocks, shared with joined pools.
+     */
+    mutable std::shared_ptr<CBlockOwner> mOwner;
+};
+
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Allocator which serves single objects from a CDoublyLinkedListNodePool.
+ * Copies of the allocator share the pool, so memory allocated by one copy can be released by another.
+ * The pool is created on the first allocation. Requests for more than one object go to the global heap.
+ * Copy construction of a container gives a fresh allocator, so a copied list never shares
+ * the (not thread safe) pool with its source.
+ * join() joins the pools of two allocators, which compare equal afterwards. CDoublyLinkedList joins
+ * the pools of lists whose items it relinks from one list to the other, so such lists are bound
+ * to one thread at a time together.
+ * @tparam T Type of allocated objects.
+ */
+template<typename T>
+class CDoublyLinkedListPoolAllocator
+{
+    template<typename U>
+    friend class CDoublyLinkedListPoolAllocator;
+
+    static_assert(alignof(T) <= alignof(std::max_align_t), "Over-aligned types are not supported by the pool");
+
+public:
+
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    /*----------------------------------------------------------------------
+                            Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CDoublyLinkedListPoolAllocator() noexcept = default;
+
+    CDoublyLinkedListPoolAllocator(const CDoublyLinkedListPoolAllocator&) noexcept = default;
+
+    template<typename U>
+    CDoublyLinkedListPoolAllocator(const CDoublyLinkedListPoolAllocator<U>& aOther) noexcept
+        : mPool(aOther.mPool)
+    {}
+
+    ~CDoublyLinkedListPoolAllocator() = default;
+
+    CDoublyLinkedListPoolAllocator& operator=(const CDoublyLinkedListPoolAllocator&) noexcept = default;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    T* allocate(const std::size_t aCount)
+    {
+        if (aCount == 1u)
+        {
+            if (!mPool)
+            {
+                mPool = std::make_shared<CDoublyLinkedListNodePool>(sizeof(T), alignof(T));
+            }
+            if (mPool->fits(sizeof(T), alignof(T)))
+            {
+                return static_cast<T*>(mPool->allocate());
+            }
+        }
+        return static_cast<T*>(::operator new(aCount * sizeof(T)));
+    }
+
+    /**
+     * @brief Allocates given number of objects placed one after another, each of them
+     * has to be released on its own with deallocate(ptr, 1).
+     * Complexity: O(1) - see CDoublyLinkedListNodePool::allocateBatch().
+     * @param aCount Number of objects. Must not be 0.
+     * @return Pointer to the first object or null if the pool can't serve objects of this type in a batch.
+     */
+    T* allocateBatch(const std::size_t aCount)
+    {
+        if (!mPool)
+        {
+            mPool = std::make_shared<CDoublyLinkedListNodePool>(sizeof(T), alignof(T));
+        }
+        if (mPool->fits(sizeof(T), alignof(T)) && (mPool->nodeSize() == sizeof(T)))
+        {
+            return static_cast<T*>(mPool->allocateBatch(aCount));
+        }
+        return nullptr;
+    }
+
+    void deallocate(T* const aPtr, const std::size_t aCount) noexcept
+    {
+        if ((aCount == 1u) && mPool && mPool->fits(sizeof(T), alignof(T)))
+        {
+            mPool->deallocate(aPtr);
+        }
+        else
+        {
+            ::operator delete(aPtr);
+        }
+    }
+
+    CDoublyLinkedListPoolAllocator select_on_container_copy_construction() const
+    {
+        return CDoublyLinkedListPoolAllocator();
+    }
+
+    /**
+     * @brief Joins pools of this allocator and the other one, see CDoublyLinkedListNodePool::join().
+     * Both allocators and their copies compare equal afterwards.
+     * Complexity: O(1)
+     * @param aOther Other allocator.
+     */
+    template<typename U>
+    void join(CDoublyLinkedListPoolAllocator<U>& aOther)
+    {
+        if (!mPool)
+        {
+            mPool = std::make_shared<CDoublyLinkedListNodePool>(sizeof(T), alignof(T));
+        }
+        if (!aOther.mPool)
+        {
+            aOther.mPool = mPool;
+        }
+        mPool->join(*aOther.mPool);
+    }
+
+    template<typename U>
+    bool operator==(const CDoublyLinkedListPoolAllocator<U>& aOther) const noexcept
+    {
+        return (mPool == aOther.mPool) || (mPool && aOther.mPool && mPool->isJoined(*aOther.mPool));
+    }
+
+    template<typename U>
+    bool operator!=(const CDoublyLinkedListPoolAllocator<U>& aOther) const noexcept
+    {
+        return !(*this == aOther);
+    }
+
+private:
+
+    /**
+     * @brief Pool shared by all copies of the allocator.
+     */
+    std::shared_ptr<CDoublyLinkedListNodePool> mPool;
+};
+
+/**
+ * @brief Checks if allocator can allocate objects in a batch, see CDoublyLinkedListPoolAllocator::allocateBatch().
+ * @tparam TAllocator Allocator.
+ */
+template<typename TAllocator, typename = void>
+struct CHasBatchAllocation : std::false_type
+{};
+
+template<typename TAllocator>
+struct CHasBatchAllocation<TAllocator, std::void_t<decltype(std::declval<TAllocator&>().allocateBatch(std::size_t()))>>
+    : std::true_type
+{};
+
+/**
+ * @brief Checks if allocator can be joined with another one, see CDoublyLinkedListPoolAllocator::join().
+ * @tparam TAllocator Allocator.
+ */
+template<typename TAllocator, typename = void>
+struct CHasJoin : std::false_type
+{};
+
+template<typename TAllocator>
+struct CHasJoin<TAllocator, std::void_t<decltype(std::declval<TAllocator&>().join(std::declval<TAllocator&>()))>>
+    : std::true_type
+{};
+
+/**
+ * @brief Allocator with storage for N single objects inside the allocator object itself.
+ * Single objects are taken from the inline storage while it has room, further objects
+ * and requests for more than one object go to a CDoublyLinkedListPoolAllocator, whose pool
+ * is created only when the inline storage runs out. A list holding this allocator keeps
+ * its first N items inside the list object and makes no heap allocation for them.
+ *
+ * Memory of the inline storage can't outlive the allocator object, so copies of the allocator
+ * don't share it: every copy and rebound copy starts with empty storage and compares equal
+ * only to itself, and the allocator never propagates. This breaks the rule that copies
+ * compare equal, so it is meant for CDoublyLinkedList, which detects it with CHasInlineStorage
+ * and moves values instead of relinking items between lists.
+ * @tparam T Type of allocated objects.
+ * @tparam N Number of objects in the inline storage, at most 64.
+ */
+template<typename T, std::size_t N>
+class CDoublyLinkedListInlineAllocator
+{
+    static_assert((N > 0u) && (N <= 64u), "Inline storage holds 1 to 64 objects");
+
+public:
+
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::false_type;
+    using propagate_on_container_move_assignment = std::false_type;
+    using propagate_on_container_swap = std::false_type;
+    using is_always_equal = std::false_type;
+
+    template<typename U>
+    struct rebind
+    {
+        using other = CDoublyLinkedListInlineAllocator<U, N>;
+    };
+
+    /**
+     * @brief Number of objects in the inline storage.
+     */
+    static constexpr std::size_t cInlineCapacity = N;
+
+    /*----------------------------------------------------------------------
+                            Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CDoublyLinkedListInlineAllocator() noexcept
+        : mUsed(0)
+    {}
+
+    /**
+     * @brief Copy gets its own empty storage.
+     */
+    CDoublyLinkedListInlineAllocator(const CDoublyLinkedListInlineAllocator&) noexcept
+        : mUsed(0)
+    {}
+
+    template<typename U>
+    CDoublyLinkedListInlineAllocator(const CDoublyLinkedListInlineAllocator<U, N>&) noexcept
+        : mUsed(0)
+    {}
+
+    ~CDoublyLinkedListInlineAllocator() = default;
+
+    CDoublyLinkedListInlineAllocator& operator=(const CDoublyLinkedListInlineAllocator&) = delete;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    T* allocate(const std::size_t aCount)
+    {
+        if ((aCount == 1u) && (mUsed != cFull))
+        {
+            std::size_t slot = 0;
+            while ((mUsed & (std::uint64_t(1) << slot)) != 0u)
+            {
+                slot++;
+            }
+            mUsed |= (std::uint64_t(1) << slot);
+            return reinterpret_cast<T*>(mStorage + slot * sizeof(T));
+        }
+        return mSpill.allocate(aCount);
+    }
+
+    void deallocate(T* const aPtr, const std::size_t aCount) noexcept
+    {
+        const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(aPtr);
+        const std::uintptr_t storage = reinterpret_cast<std::uintptr_t>(mStorage);
+        if ((address >= storage) && (address < storage + sizeof(mStorage)))
+        {
+            mUsed &= ~(std::uint64_t(1) << ((address - storage) / sizeof(T)));
+        }
+        else
+        {
+            mSpill.deallocate(aPtr, aCount);
+        }
+    }
+
+    CDoublyLinkedListInlineAllocator select_on_container_copy_construction() const
+    {
+        return CDoublyLinkedListInlineAllocator();
+    }
+
+    template<typename U>
+    bool operator==(const CDoublyLinkedListInlineAllocator<U, N>& aOther) const noexcept
+    {
+        return (static_cast<const void*>(this) == static_cast<const void*>(&aOther));
+    }
+
+    template<typename U>
+    bool operator!=(const CDoublyLinkedListInlineAllocator<U, N>& aOther) const noexcept
+    {
+        return !(*this == aOther);
+    }
+
+private:
+
+    /**
+     * @brief Value of mUsed when all objects of the inline storage are taken.
+     */
+    static constexpr std::uint64_t cFull = (N == 64u) ? ~std::uint64_t(0) : ((std::uint64_t(1) << N) - 1u);
+
+    /**
+     * @brief Inline storage of objects.
+     */
+    alignas(T) unsigned char mStorage[N * sizeof(T)];
+
+    /**
+     * @brief Bit per object of the inline storage, set if the object is taken.
+     */
+    std::uint64_t mUsed;
+
+    /**
+     * @brief Allocator for objects which don't fit into the inline storage.
+     */
+    CDoublyLinkedListPoolAllocator<T> mSpill;
+};
+
+/**
+ * @brief Checks if allocator keeps objects inside itself, see CDoublyLinkedListInlineAllocator.
+ * Such allocator can't hand over its memory to another allocator object.
+ * @tparam TAllocator Allocator.
+ */
+template<typename TAllocator, typename = void>
+struct CHasInlineStorage : std::false_type
+{};
+
+template<typename TAllocator>
+struct CHasInlineStorage<TAllocator, std::void_t<decltype(TAllocator::cInlineCapacity)>>
+    : std::true_type
+{};
+
+#endif
@@ -0,0 +1,269 @@
+#ifndef CPP_DOUBLY_LINKED_LIST_PREFETCH_HPP_
+#define CPP_DOUBLY_LINKED_LIST_PREFETCH_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Prefetch policy of CDoublyLinkedList which issues no prefetches.
+ * Traversal follows the links only. The list pays nothing for the policy.
+ */
+struct CNoPrefetchPolicy
+{
+    static constexpr bool cEnabled = false;
+
+    /**
+     * @brief Empty base of list items.
+     */
+    struct CHint
+    {};
+
+    /**
+     * @brief Traversal state which records nothing.
+     * @tparam TNode Type of list items.
+     */
+    template<typename TNode>
+    class CTrail
+    {
+    public:
+
+        void step(TNode* const) noexcept {}
+    };
+
+    /**
+     * @brief Jump state of list which keeps nothing.
+     * @tparam TNode Type of list items.
+     */
+    template<typename TNode>
+    class CJumps
+    {
+    public:
+
+        void linkedBack(TNode* const, const uintmax_t) noexcept {}
+        void linkedFront(TNode* const, const uintmax_t) noexcept {}
+        static void linkedBetween(TNode* const) noexcept {}
+        void unlinkingBack(const TNode* const) noexcept {}
+        void unlinkingFront(const TNode* const) noexcept {}
+        void forget(const TNode* const) noexcept {}
+        void reset() noexcept {}
+    };
+
+    static void prefetch(const CHint&) noexcept {}
+};
+
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+// /////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Prefetch policy of CDoublyLinkedList which keeps a jump pointer in every item.
+ * The jump points TDistance items ahead, and forward traversal prefetches the target of the jump
+ * of the current item. TDistance cache misses are then in flight at once instead of one,
+ * which hides memory latency on lists that don't fit in cache and whose items are scattered.
+ *
+ * Jumps are set while the list is built: pushes at either end set the jump which reaches the new item,
+ * or the jump of the new item, through a pointer the list keeps TDistance items from that end.
+ * Copies, sort(), merge() and compact() set the jumps of all items they link. An item inserted
+ * in the middle takes the jump of its predecessor. Erases don't maintain jumps, so they may reach
+ * a few items too far or too near, or a freed item: jumps are hints only, they are never dereferenced,
+ * just prefetched, and a prefetch of a stale or freed address is harmless.
+ * Every forward traversal (iterators, copies, comparison, clearing, contains() and find()) uses them.
+ * Const methods don't write jumps. Each item costs one extra pointer, the list two.
+ * @tparam TDistance Number of items a jump reaches ahead.
+ */
+template<std::size_t TDistance = 16u>
+struct CJumpPrefetchPolicy
+{
+    static_assert(TDistance > 1u, "Jump has to reach beyond the next item");
+
+    static constexpr bool cEnabled = true;
+
+    /**
+     * @brief Base of list items with the jump pointer.
+     */
+    struct CHint
+    {
+        /**
+         * @brief Item TDistance items ahead when the jump was set, may be stale.
+         */
+        const void* mJump = nullptr;
+    };
+
+    /**
+     * @brief Traversal state which refreshes jumps. Remembers the last TDistance items
+     * and points the jump of the oldest one to the current item.
+     * @tparam TNode Type of list items.
+     */
+    template<typename TNode>
+    class CTrail
+    {
+    public:
+
+        /**
+         * @brief Prefetches ahead of item and refreshes jump which reaches it. Items must be passed in list order.
+         * @param aNode Current item.
+         */
+        void step(TNode* const aNode) noexcept
+        {
+            prefetch(*aNode);
+            if (mRing[mPosition] != nullptr)
+            {
+                mRing[mPosition]->mJump = aNode;
+            }
+            mRing[mPosition] = aNode;
+            mPosition = (mPosition + 1u == TDistance) ? 0u : mPosition + 1u;
+        }
+
+    private:
+
+        /**
+         * @brief Last TDistance items, the oldest one at mPosition.
+         */
+        TNode* mRing[TDistance] = {};
+
+        /**
+         * @brief Position of the oldest item in mRing.
+         */
+        std::size_t mPosition = 0u;
+    };
+
+    /**
+     * @brief Jump state of list: the item whose jump reaches the next item linked at the end,
+     * and the item which the jump of the next item linked at the beginning reaches.
+     * Both are kept TDistance items from their end while items are pushed and popped there.
+     * @tparam TNode Type of list items, with mPrevious and mNext.
+     */
+    template<typename TNode>
+    class CJumps
+    {
+    public:
+
+        /**
+         * @brief Sets the jump which reaches item linked at the end.
+         * @param aNode New last item.
+         * @param aSize Size of list with the item.
+         */
+        void linkedBack(TNode* const aNode, const uintmax_t aSize) noexcept
+        {
+            if (mBackSource == nullptr)
+            {
+                if (aSize <= TDistance)
+                {
+                    return;
+                }
+                mBackSource = aNode;
+                for (std::size_t i = 0; i < TDistance; ++i)
+                {
+                    mBackSource = mBackSource->mPrevious;
+                }
+            }
+            mBackSource->mJump = aNode;
+            mBackSource = mBackSource->mNext;
+        }
+
+        /**
+         * @brief Sets the jump of item linked at the beginning.
+         * @param aNode New first item.
+         * @param aSize Size of list with the item.
+         */
+        void linkedFront(TNode* const aNode, const uintmax_t aSize) noexcept
+        {
+            if (mFrontTarget == nullptr)
+            {
+                if (aSize <= TDistance)
+                {
+                    return;
+                }
+                mFrontTarget = aNode;
+                for (std::size_t i = 0; i < TDistance; ++i)
+                {
+                    mFrontTarget = mFrontTarget->mNext;
+                }
+            }
+            aNode->mJump = mFrontTarget;
+            mFrontTarget = mFrontTarget->mPrevious;
+        }
+
+        /**
+         * @brief Gives item linked in the middle the jump of its predecessor, which reaches one item less far.
+         * @param aNode New item, it has a predecessor.
+         */
+        static void linkedBetween(TNode* const aNode) noexcept
+        {
+            aNode->mJump = aNode->mPrevious->mJump;
+        }
+
+        /**
+         * @brief Keeps the distance from the end when the last item is going to be unlinked.
+         * @param aNode Last item, still linked.
+         */
+        void unlinkingBack(const TNode* const aNode) noexcept
+        {
+            forget(aNode);
+            if (mBackSource != nullptr)
+            {
+                mBackSource = mBackSource->mPrevious;
+            }
+        }
+
+        /**
+         * @brief Keeps the distance from the beginning when the first item is going to be unlinked.
+         * @param aNode First item, still linked.
+         */
+        void unlinkingFront(const TNode* const aNode) noexcept
+        {
+            forget(aNode);
+            if (mFrontTarget != nullptr)
+            {
+                mFrontTarget = mFrontTarget->mNext;
+            }
+        }
+
+        /**
+         * @brief Drops pointers to item which leaves the list.
+         */
+        void forget(const TNode* const aNode) noexcept
+        {
+            if (mBackSource == aNode)
+            {
+                mBackSource = nullptr;
+            }
+            if (mFrontTarget == aNode)
+            {
+                mFrontTarget = nullptr;
+            }
+        }
+
+        /**
+         * @brief Drops both pointers, they are found again by the next push at their end.
+         */
+        void reset() noexcept
+        {
+            mBackSource = nullptr;
+            mFrontTarget = nullptr;
+        }
+
+    private:
+
+        TNode* mBackSource = nullptr;
+        TNode* mFrontTarget = nullptr;
+    };
+
+    /**
+     * @brief Prefetches the target of jump of item.
+     * @param aHint Item.
+     */
+    static void prefetch(const CHint& aHint) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(aHint.mJump);
+#else
+        static_cast<void>(aHint);
+#endif
+    }
+};
+
+#endif
@@ -0,0 +1,528 @@
+#ifndef CPP_DOUBLY_LINKED_LIST_SERIALIZATION_HPP_
+#define CPP_DOUBLY_LINKED_LIST_SERIALIZATION_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <memory>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#include "CppDoublyLinkedList.hpp"
+
+/**
+ * @brief Binary encoding of values of type T for serialize() and deserialize().
+ * Trivially copyable values are stored as their bytes, so whole chunks of them are written and read at once.
+ * Other types need a specialization with cBulk = false and
+ * template<typename TOutput> static void write(TOutput&, const T&) and
+ * template<typename TInput> static T read(TInput&), which use write(const void*, size) and read(void*, size)
+ * of the buffered output and input. std::string is provided.
+ * @tparam T Type of values.
+ */
+template<typename T, typename = void>
+struct CDoublyLinkedListCodec;
+
+template<typename T>
+struct CDoublyLinkedListCodec<T, std::enable_if_t<std::is_trivially_copyable<T>::value>>
+{
+    static constexpr bool cBulk = true;
+};
+
+template<>
+struct CDoublyLinkedListCodec<std::string>
+{
+    static constexpr bool cBulk = false;
+
+    /**
+     * @brief Writes length and characters of string.
+     */
+    template<typename TOutput>
+    static void write(TOutput& aOutput, const std::string& aValue)
+    {
+        const std::uint64_t length = aValue.size();
+        aOutput.write(&length, sizeof(length));
+        aOutput.write(aValue.data(), aValue.size());
+    }
+
+    /**
+     * @brief Reads string written by write().
+     */
+    template<typename TInput>
+    static std::string read(TInput& aInput)
+    {
+        std::uint64_t length = 0;
+        aInput.read(&length, sizeof(length));
+        std::string value;
+        // grows with the data, so a damaged length can't allocate much more than the input holds
+        while (value.size() < length)
+        {
+            const std::size_t chunk = static_cast<std::size_t>(std::min<std::uint64_t>(length - value.size(), 1u << 16));
+            const std::size_t size = value.size();
+            value.resize(size + chunk);
+            aInput.read(&value[size], chunk);
+        }
+        return value;
+    }
+};
+
+/**
+ * @brief Buffered binary output and input over std::ostream, std::istream or POSIX file descriptors.
+ * Errors are thrown as std::runtime_error.
+ */
+namespace DoublyLinkedListSerialization
+{
+
+/**
+ * @brief Version of the format written by serialize().
+ *
+ * The format is a header followed by values:
+ * magic "CDLL", uint16 version, uint16 byte order mark 0x0102 in native order, uint32 flags,
+ * uint32 size of value (0 for values with their own encoding), uint64 number of values.
+ * Values are in list order: bytes of trivially copyable values, CDoublyLinkedListCodec<T>::write() of others.
+ * Numbers are in native byte order, a file written on a machine of other order is rejected.
+ */
+static constexpr std::uint16_t cVersion = 1u;
+static constexpr char cMagic[4] = {'C', 'D', 'L', 'L'};
+static constexpr std::uint16_t cByteOrderMark = 0x0102u;
+
+/**
+ * @brief Flag of header: values are stored as their bytes.
+ */
+static constexpr std::uint32_t cBulkFlag = 1u;
+
+/**
+ * @brief Size of buffers, and the number of values deserialize() allocates in one batch is about this many bytes.
+ */
+static constexpr std::size_t cBufferBytes = 1u << 16;
+
+/**
+ * @brief Header of the format.
+ */
+struct CHeader
+{
+    char mMagic[4];
+    std::uint16_t mVersion;
+    std::uint16_t mByteOrderMark;
+    std::uint32_t mFlags;
+    std::uint32_t mValueSize;
+    std::uint64_t mCount;
+};
+
+static_assert(sizeof(CHeader) == 24u, "Header has to have no padding");
+
+/**
+ * @brief Sink which writes to std::ostream.
+ */
+class CStreamSink
+{
+public:
+
+    explicit CStreamSink(std::ostream& aStream)
+        : mStream(aStream)
+    {}
+
+    void write(const char* const aData, const std::size_t aSize)
+    {
+        if (!mStream.write(aData, static_cast<std::streamsize>(aSize)))
+        {
+            throw std::runtime_error("Writing of list to stream failed");
+        }
+    }
+
+private:
+
+    std::ostream& mStream;
+};
+
+/**
+ * @brief Source which reads from std::istream. The stream buffers by itself and must not be read
+ * beyond the list, so the input doesn't read ahead.
+ */
+class CStreamSource
+{
+public:
+
+    static constexpr bool cReadAhead = false;
+
+    explicit CStreamSource(std::istream& aStream)
+        : mStream(aStream)
+    {}
+
+    std::size_t read(char* const aData, const std::size_t aSize)
+    {
+        mStream.read(aData, static_cast<std::streamsize>(aSize));
+        if (mStream.bad())
+        {
+            throw std::runtime_error("Reading of list from stream failed");
+        }
+        return static_cast<std::size_t>(mStream.gcount());
+    }
+
+private:
+
+    std::istream& mStream;
+};
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * @brief Sink which writes to file descriptor.
+ */
+class CFileSink
+{
+public:
+
+    explicit CFileSink(const int aFd)
+        : mFd(aFd)
+    {}
+
+    void write(const char* aData, std::size_t aSize)
+    {
+        while (aSize > 0u)
+        {
+            const ssize_t written = ::write(mFd, aData, aSize);
+            if (written < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                throw std::runtime_error("Writing of list to file failed: " + std::string(std::strerror(errno)));
+            }
+            aData += written;
+            aSize -= static_cast<std::size_t>(written);
+        }
+    }
+
+private:
+
+    const int mFd;
+};
+
+/**
+ * @brief Source which reads from file descriptor.
+ */
+class CFileSource
+{
+public:
+
+    static constexpr bool cReadAhead = true;
+
+    explicit CFileSource(const int aFd)
+        : mFd(aFd)
+    {}
+
+    std::size_t read(char* const aData, const std::size_t aSize)
+    {
+        for (;;)
+        {
+            const ssize_t count = ::read(mFd, aData, aSize);
+            if (count >= 0)
+            {
+                return static_cast<std::size_t>(count);
+            }
+            if (errno != EINTR)
+            {
+                throw std::runtime_error("Reading of list from file failed: " + std::string(std::strerror(errno)));
+            }
+        }
+    }
+
+private:
+
+    const int mFd;
+};
+
+#endif
+
+/**
+ * @brief Output which collects small writes in a buffer and passes large ones straight to the sink.
+ * @tparam TSink Sink.
+ */
+template<typename TSink>
+class COutput
+{
+public:
+
+    explicit COutput(TSink aSink)
+        : mSink(aSink)
+        , mBuffer(new char[cBufferBytes])
+        , mUsed(0u)
+    {}
+
+    /**
+     * @brief Writes bytes.
+     */
+    void write(const void* const aData, const std::size_t aSize)
+    {
+        if (mUsed + aSize > cBufferBytes)
+        {
+            flush();
+        }
+        if (aSize >= cBufferBytes)
+        {
+            mSink.write(static_cast<const char*>(aData), aSize);
+            return;
+        }
+        std::memcpy(mBuffer.get() + mUsed, aData, aSize);
+        mUsed += aSize;
+    }
+
+    /**
+     * @brief Passes buffered bytes to the sink.
+     */
+    void flush()
+    {
+        if (mUsed > 0u)
+        {
+            mSink.write(mBuffer.get(), mUsed);
+            mUsed = 0u;
+        }
+    }
+
+private:
+
+    TSink mSink;
+    std::unique_ptr<char[]> mBuffer;
+    std::size_t mUsed;
+};
+
+/**
+ * @brief Input which reads ahead into a buffer if the source allows it, large reads go straight to the source.
+ * Reads past the end throw.
+ * @tparam TSource Source.
+ */
+template<typename TSource>
+class CInput
+{
+public:
+
+    explicit CInput(TSource aSource)
+        : mSource(aSource)
+        , mBuffer(TSource::cReadAhead ? new char[cBufferBytes] : nullptr)
+        , mPosition(0u)
+        , mEnd(0u)
+    {}
+
+    /**
+     * @brief Reads bytes.
+     */
+    void read(void* const aData, const std::size_t aSize)
+    {
+        char* data = static_cast<char*>(aData);
+        std::size_t size = aSize;
+        if constexpr (TSource::cReadAhead)
+        {
+            const std::size_t buffered = std::min(size, mEnd - mPosition);
+            std::memcpy(data, mBuffer.get() + mPosition, buffered);
+            mPosition += buffered;
+            data += buffered;
+            size -= buffered;
+            if ((size > 0u) && (size < cBufferBytes))
+            {
+                mPosition = 0u;
+                mEnd = 0u;
+                while (mEnd < size)
+                {
+                    mEnd += readSome(mBuffer.get() + mEnd, cBufferBytes - mEnd);
+                }
+                std::memcpy(data, mBuffer.get(), size);
+                mPosition = size;
+                return;
+            }
+        }
+        while (size > 0u)
+        {
+            const std::size_t count = readSome(data, size);
+            data += count;
+            size -= count;
+        }
+    }
+
+private:
+
+    /**
+     * @brief Reads at least one byte.
+     */
+    std::size_t readSome(char* const aData, const std::size_t aSize)
+    {
+        const std::size_t count = mSource.read(aData, aSize);
+        if (count == 0u)
+        {
+            throw std::runtime_error("List data is truncated");
+        }
+        return count;
+    }
+
+    TSource mSource;
+    std::unique_ptr<char[]> mBuffer;
+    std::size_t mPosition;
+    std::size_t mEnd;
+};
+
+/**
+ * @brief Writes header and values of list.
+ */
+template<typename TList, typename TSink>
+void write(const TList& aList, TSink aSink)
+{
+    using T = typename std::decay<decltype(*aList.begin())>::type;
+    using Codec = CDoublyLinkedListCodec<T>;
+
+    CHeader header = {};
+    std::memcpy(header.mMagic, cMagic, sizeof(cMagic));
+    header.mVersion = cVersion;
+    header.mByteOrderMark = cByteOrderMark;
+    header.mFlags = Codec::cBulk ? cBulkFlag : 0u;
+    header.mValueSize = Codec::cBulk ? static_cast<std::uint32_t>(sizeof(T)) : 0u;
+    header.mCount = aList.size();
+
+    COutput<TSink> output(aSink);
+    output.write(&header, sizeof(header));
+    for (const T& value : aList)
+    {
+        if constexpr (Codec::cBulk)
+        {
+            output.write(&value, sizeof(T));
+        }
+        else
+        {
+            Codec::write(output, value);
+        }
+    }
+    output.flush();
+}
+
+/**
+ * @brief Reads header and values and appends them to list. Values are collected in chunks
+ * and every chunk is added with one batch allocation of items.
+ */
+template<typename TList, typename TSource>
+void read(TList& aList, TSource aSource)
+{
+    using T = typename std::decay<decltype(*aList.begin())>::type;
+    using Codec = CDoublyLinkedListCodec<T>;
+
+    CInput<TSource> input(aSource);
+    CHeader header;
+    input.read(&header, sizeof(header));
+    if (std::memcmp(header.mMagic, cMagic, sizeof(cMagic)) != 0)
+    {
+        throw std::runtime_error("Data is not a serialized list");
+    }
+    if (header.mVersion != cVersion)
+    {
+        throw std::runtime_error("Unsupported version of serialized list: " + std::to_string(header.mVersion));
+    }
+    if (header.mByteOrderMark != cByteOrderMark)
+    {
+        throw std::runtime_error("Serialized list has other byte order");
+    }
+    if ((header.mFlags != (Codec::cBulk ? cBulkFlag : 0u))
+        || (header.mValueSize != (Codec::cBulk ? sizeof(T) : 0u)))
+    {
+        throw std::runtime_error("Serialized list holds values of other type");
+    }
+
+    TList values(aList.get_allocator());
+    std::uint64_t remaining = header.mCount;
+    if constexpr (Codec::cBulk)
+    {
+        const std::size_t chunkValues = std::max<std::size_t>(cBufferBytes / sizeof(T), 1u);
+        std::unique_ptr<typename std::aligned_storage<sizeof(T), alignof(T)>::type[]> chunk(
+            new typename std::aligned_storage<sizeof(T), alignof(T)>::type[chunkValues]);
+        const T* const first = reinterpret_cast<const T*>(chunk.get());
+        while (remaining > 0u)
+        {
+            const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, chunkValues));
+            input.read(chunk.get(), count * sizeof(T));
+            values.pushBack(first, first + count);
+            remaining -= count;
+        }
+    }
+    else
+    {
+        std::vector<T> chunk;
+        while (remaining > 0u)
+        {
+            const std::size_t count = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, 1024u));
+            chunk.clear();
+            for (std::size_t i = 0; i < count; i++)
+            {
+                chunk.push_back(Codec::read(input));
+            }
+            values.pushBack(std::make_move_iterator(chunk.begin()), std::make_move_iterator(chunk.end()));
+            remaining -= count;
+        }
+    }
+    aList.append(std::move(values));
+}
+
+} // namespace DoublyLinkedListSerialization
+
+/**
+ * @brief Writes list to stream in the binary format described at DoublyLinkedListSerialization::cVersion.
+ * Complexity: O(n)
+ * @param aList List.
+ * @param aStream Binary stream.
+ */
+template<typename T, typename TAllocator, typename TLookupPolicy, typename TPrefetchPolicy>
+void serialize(const CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aList, std::ostream& aStream)
+{
+    DoublyLinkedListSerialization::write(aList, DoublyLinkedListSerialization::CStreamSink(aStream));
+}
+
+/**
+ * @brief Reads list written by serialize() and appends its values to the end of list.
+ * Items are allocated in batches. The list is not changed if the call throws.
+ * Complexity: O(m) - m is the number of read values.
+ * @param aList List.
+ * @param aStream Binary stream.
+ */
+template<typename T, typename TAllocator, typename TLookupPolicy, typename TPrefetchPolicy>
+void deserialize(CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aList, std::istream& aStream)
+{
+    DoublyLinkedListSerialization::read(aList, DoublyLinkedListSerialization::CStreamSource(aStream));
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * @brief Writes list to file descriptor, @see serialize(const CDoublyLinkedList&, std::ostream&).
+ * @param aList List.
+ * @param aFd Open file descriptor, written from its current position.
+ */
+template<typename T, typename TAllocator, typename TLookupPolicy, typename TPrefetchPolicy>
+void serialize(const CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aList, const int aFd)
+{
+    DoublyLinkedListSerialization::write(aList, DoublyLinkedListSerialization::CFileSink(aFd));
+}
+
+/**
+ * @brief Reads list from file descriptor, @see deserialize(CDoublyLinkedList&, std::istream&).
+ * The descriptor may be read ahead beyond the end of the list.
+ * @param aList List.
+ * @param aFd Open file descriptor, read from its current position.
+ */
+template<typename T, typename TAllocator, typename TLookupPolicy, typename TPrefetchPolicy>
+void deserialize(CDoublyLinkedList<T, TAllocator, TLookupPolicy, TPrefetchPolicy>& aList, const int aFd)
+{
+    DoublyLinkedListSerialization::read(aList, DoublyLinkedListSerialization::CFileSource(aFd));
+}
+
+#endif
+
+#endif
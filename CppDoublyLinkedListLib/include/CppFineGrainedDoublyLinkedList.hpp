@@ -0,0 +1,547 @@
+#ifndef CPP_FINE_GRAINED_DOUBLY_LINKED_LIST_HPP_
+#define CPP_FINE_GRAINED_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+
+/**
+ * @brief Thread-safe Doubly Linked List with a lock in every item. Threads working on different parts
+ * of the list do not wait for each other: insert locks the two items around the new one, erase
+ * the erased item and its two neighbours, and traversal holds one lock at a time.
+ *
+ * Locks are always taken from the beginning towards the end of list. A lock on the left side
+ * is only tried while holding one on the right, otherwise all locks are dropped and taken again
+ * in order, so the list cannot deadlock.
+ *
+ * Iterators are thread-safe handles: an item stays allocated while an iterator refers to it, even
+ * if another thread erases it. An erased item keeps its neighbours allocated too, so an iterator
+ * on it can still move on - it skips erased items. Values are never changed after insert
+ * and can be read through an iterator without lock.
+ * @tparam T Type of items.
+ */
+template<typename T>
+class CFineGrainedDoublyLinkedList
+{
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Links and lock of an item. The list begins and ends with a sentinel which holds only links.
+     */
+    struct CFineGrainedLink
+    {
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CFineGrainedLink()
+            : mPrevious(nullptr)
+            , mNext(nullptr)
+            , mRemoved(false)
+            , mReferences(1u)
+            , mDying(nullptr)
+        {}
+
+        /**
+         * @brief Lock for links and removed flag.
+         */
+        std::mutex mMutex;
+
+        /**
+         * @brief Pointer to previous link. Frozen once the item is removed.
+         */
+        CFineGrainedLink* mPrevious;
+
+        /**
+         * @brief Pointer to next link. Frozen once the item is removed.
+         */
+        CFineGrainedLink* mNext;
+
+        /**
+         * @brief true after item has been erased. Written under lock.
+         */
+        std::atomic<bool> mRemoved;
+
+        /**
+         * @brief One reference of the list while item is linked, one per iterator
+         * and one per erased neighbour which still points to the item.
+         */
+        std::atomic<std::size_t> mReferences;
+
+        /**
+         * @brief Next item to free, used while freeing a chain of items.
+         */
+        CFineGrainedLink* mDying;
+    };
+
+    /**
+     * @brief List item. Holds value.
+     */
+    struct CFineGrainedDoublyLinkedListItem : CFineGrainedLink
+    {
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        template<typename... TArgs>
+        explicit CFineGrainedDoublyLinkedListItem(TArgs&&... aArgs)
+            : mValue(std::forward<TArgs>(aArgs)...)
+        {}
+
+        /**
+         * @brief Value.
+         */
+        const T mValue;
+    };
+
+    using Link = CFineGrainedLink;
+    using Item = CFineGrainedDoublyLinkedListItem;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for FineGrainedDoublyLinked container. Keeps its item allocated.
+     * An iterator can be shared between threads only if it is not modified.
+     */
+    class CFineGrainedDoublyLinkedListIterator
+    {
+        friend class CFineGrainedDoublyLinkedList;
+
+        /**
+         * @brief List of item.
+         */
+        const CFineGrainedDoublyLinkedList* mList;
+
+        /**
+         * @brief Pointer to data, referenced by iterator.
+         */
+        Link* mPtr;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Takes over reference which caller already holds.
+         */
+        CFineGrainedDoublyLinkedListIterator(const CFineGrainedDoublyLinkedList* aList, Link* aPtr)
+            : mList(aList)
+            , mPtr(aPtr)
+        {}
+
+    public:
+
+        CFineGrainedDoublyLinkedListIterator(const CFineGrainedDoublyLinkedListIterator& aObj)
+            : mList(aObj.mList)
+            , mPtr(aObj.mPtr)
+        {
+            mPtr->mReferences.fetch_add(1u, std::memory_order_relaxed);
+        }
+
+        ~CFineGrainedDoublyLinkedListIterator()
+        {
+            mList->release(mPtr);
+        }
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        CFineGrainedDoublyLinkedListIterator& operator=(const CFineGrainedDoublyLinkedListIterator& aObj)
+        {
+            aObj.mPtr->mReferences.fetch_add(1u, std::memory_order_relaxed);
+            mList->release(mPtr);
+            mList = aObj.mList;
+            mPtr = aObj.mPtr;
+            return *this;
+        }
+
+        /**
+         * @brief Operator increment. Moves to the next item which is not erased.
+         */
+        CFineGrainedDoublyLinkedListIterator& operator ++()
+        {
+            do
+            {
+                move(&Link::mNext);
+            }
+            while ((mPtr != &mList->mTail) && mPtr->mRemoved.load());
+            return *this;
+        }
+
+        /**
+         * @brief Operator decrement. Moves to the previous item which is not erased.
+         */
+        CFineGrainedDoublyLinkedListIterator& operator --()
+        {
+            do
+            {
+                move(&Link::mPrevious);
+            }
+            while ((mPtr != &mList->mHead) && mPtr->mRemoved.load());
+            return *this;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return static_cast<const Item*>(mPtr)->mValue;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &(static_cast<const Item*>(mPtr)->mValue);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CFineGrainedDoublyLinkedListIterator& alt)const
+        {
+            return (mPtr == alt.mPtr);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CFineGrainedDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+    private:
+
+        /**
+         * @brief Steps to neighbour. Neighbour cannot be freed while the item is locked -
+         * a linked neighbour needs this lock to be unlinked and an erased item references its neighbours.
+         */
+        void move(Link* Link::* aDirection)
+        {
+            Link* neighbour;
+            {
+                std::lock_guard<std::mutex> lock(mPtr->mMutex);
+                neighbour = mPtr->*aDirection;
+                neighbour->mReferences.fetch_add(1u, std::memory_order_relaxed);
+            }
+            mList->release(mPtr);
+            mPtr = neighbour;
+        }
+    };
+
+    using DIterator = CFineGrainedDoublyLinkedListIterator;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CFineGrainedDoublyLinkedList()
+        : mSize(0u)
+    {
+        mHead.mNext = &mTail;
+        mTail.mPrevious = &mHead;
+    }
+
+    CFineGrainedDoublyLinkedList(const CFineGrainedDoublyLinkedList&) = delete;
+
+    /**
+     * @brief Frees all items. No other thread and no iterator may use the list any more.
+     */
+    ~CFineGrainedDoublyLinkedList()
+    {
+        Link* link = mHead.mNext;
+        while (link != &mTail)
+        {
+            Link* next = link->mNext;
+            delete static_cast<Item*>(link);
+            link = next;
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CFineGrainedDoublyLinkedList& operator=(const CFineGrainedDoublyLinkedList&) = delete;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items. The result may be outdated by the time it is returned.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mSize.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Indicates if the list empty. The result may be outdated by the time it is returned.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (size() == 0);
+    }
+
+    /**
+     * @brief Adds value to the end of list.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        insert(end(), aValue);
+    }
+
+    /**
+     * @brief Adds value to the beginning of list. Locks the head and the first item, so the value
+     * is first at the moment it is linked, also when another thread inserts at the front meanwhile.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     */
+    void pushFront(const T& aValue)
+    {
+        Item* item = new Item(aValue);
+        {
+            // the first item can't be unlinked or get another item before it while the head is locked
+            std::lock_guard<std::mutex> headLock(mHead.mMutex);
+            Link* next = mHead.mNext;
+            std::lock_guard<std::mutex> nextLock(next->mMutex);
+            link(&mHead, next, item);
+        }
+        release(item);
+    }
+
+    /**
+     * @brief Inserts value before position. Locks only position and the item before it.
+     * Complexity: O(1)
+     * @param aPosition Position, end() appends.
+     * @param aValue Value to add.
+     * @return Iterator to the new item or end() if position has been erased meanwhile - nothing is inserted then.
+     */
+    DIterator insert(const DIterator& aPosition, const T& aValue)
+    {
+        Item* item = new Item(aValue);
+        if (!linkItem(aPosition.mPtr, item))
+        {
+            delete item;
+            return end();
+        }
+        return DIterator(this, item);
+    }
+
+    /**
+     * @brief Erases item at position. Locks only the item and its neighbours.
+     * The iterator stays valid and moves on to the items which follow it at the time of erase.
+     * Complexity: O(1)
+     * @param aPosition Position of item.
+     * @return true if item was erased, false if another thread erased it before.
+     */
+    bool erase(const DIterator& aPosition)
+    {
+        Link* const item = aPosition.mPtr;
+        if ((item == &mHead) || (item == &mTail))
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> itemLock(item->mMutex);
+        if (item->mRemoved.load())
+        {
+            return false;
+        }
+        Link* previous = item->mPrevious;
+        std::unique_lock<std::mutex> previousLock(previous->mMutex, std::try_to_lock);
+        if (!previousLock.owns_lock())
+        {
+            // take locks again in list order
+            previous->mReferences.fetch_add(1u, std::memory_order_relaxed);
+            itemLock.unlock();
+            previousLock = std::unique_lock<std::mutex>(previous->mMutex);
+            itemLock.lock();
+            const bool valid = !item->mRemoved.load() && (item->mPrevious == previous);
+            if (!valid)
+            {
+                itemLock.unlock();
+                previousLock.unlock();
+                release(previous);
+                return erase(aPosition);
+            }
+            release(previous);
+        }
+        Link* next = item->mNext;
+        std::lock_guard<std::mutex> nextLock(next->mMutex);
+
+        // erased item keeps its neighbours alive, the reference of list is dropped below
+        previous->mReferences.fetch_add(1u, std::memory_order_relaxed);
+        next->mReferences.fetch_add(1u, std::memory_order_relaxed);
+        item->mRemoved.store(true);
+        previous->mNext = next;
+        next->mPrevious = previous;
+        mSize.fetch_sub(1u, std::memory_order_relaxed);
+
+        itemLock.unlock();
+        release(item);
+        return true;
+    }
+
+    /**
+     * @brief Checks if value is in the list. Walks the list hand over hand, holding at most two locks.
+     * Complexity: O(n)
+     * @param aValue Value to search.
+     * @return true if value is found, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        Link* const head = const_cast<Link*>(&mHead);
+        std::unique_lock<std::mutex> lock(head->mMutex);
+        for (Link* link = head->mNext; link != &mTail; link = link->mNext)
+        {
+            std::unique_lock<std::mutex> nextLock(link->mMutex);
+            lock.swap(nextLock);
+            nextLock.unlock();
+            if (static_cast<const Item*>(link)->mValue == aValue)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns iterator to the first item.
+     */
+    DIterator begin() const
+    {
+        Link* const head = const_cast<Link*>(&mHead);
+        std::lock_guard<std::mutex> lock(head->mMutex);
+        head->mNext->mReferences.fetch_add(1u, std::memory_order_relaxed);
+        return DIterator(this, head->mNext);
+    }
+
+    /**
+     * @brief Returns iterator behind the last item.
+     */
+    DIterator end() const
+    {
+        return DIterator(this, const_cast<Link*>(&mTail));
+    }
+
+private:
+
+    /**
+     * @brief Sentinel before the first item.
+     */
+    Link mHead;
+
+    /**
+     * @brief Sentinel behind the last item.
+     */
+    Link mTail;
+
+    /**
+     * @brief Number of items.
+     */
+    std::atomic<std::size_t> mSize;
+
+    /**
+     * @brief Links new item before given item. On success the item holds the reference of list
+     * and one for caller.
+     * @return true if item is linked, false if the position has been erased.
+     */
+    bool linkItem(Link* aPosition, Item* aItem)
+    {
+        if (aPosition == &mHead)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> positionLock(aPosition->mMutex);
+        if (aPosition->mRemoved.load())
+        {
+            return false;
+        }
+        Link* previous = aPosition->mPrevious;
+        std::unique_lock<std::mutex> previousLock(previous->mMutex, std::try_to_lock);
+        if (!previousLock.owns_lock())
+        {
+            // take locks again in list order
+            previous->mReferences.fetch_add(1u, std::memory_order_relaxed);
+            positionLock.unlock();
+            previousLock = std::unique_lock<std::mutex>(previous->mMutex);
+            positionLock.lock();
+            const bool valid = !aPosition->mRemoved.load() && (aPosition->mPrevious == previous);
+            if (!valid)
+            {
+                positionLock.unlock();
+                previousLock.unlock();
+                release(previous);
+                return linkItem(aPosition, aItem);
+            }
+            release(previous);
+        }
+
+        link(previous, aPosition, aItem);
+        return true;
+    }
+
+    /**
+     * @brief Links new item between two neighbours, both locked by caller. The item holds
+     * the reference of list and one for caller.
+     */
+    void link(Link* aPrevious, Link* aNext, Item* aItem)
+    {
+        aItem->mReferences.store(2u, std::memory_order_relaxed);
+        aItem->mPrevious = aPrevious;
+        aItem->mNext = aNext;
+        aPrevious->mNext = aItem;
+        aNext->mPrevious = aItem;
+        mSize.fetch_add(1u, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Drops reference to item. Frees items which are not referenced any more,
+     * together with erased neighbours referenced only by them.
+     */
+    void release(Link* aLink) const
+    {
+        Link* dying = nullptr;
+        auto drop = [this, &dying](Link* aDropped)
+        {
+            if ((aDropped != &mHead) && (aDropped != &mTail)
+                && (aDropped->mReferences.fetch_sub(1u, std::memory_order_acq_rel) == 1u))
+            {
+                aDropped->mDying = dying;
+                dying = aDropped;
+            }
+        };
+
+        drop(aLink);
+        while (dying != nullptr)
+        {
+            Link* link = dying;
+            dying = link->mDying;
+            drop(link->mPrevious);
+            drop(link->mNext);
+            delete static_cast<Item*>(link);
+        }
+    }
+};
+
+#endif
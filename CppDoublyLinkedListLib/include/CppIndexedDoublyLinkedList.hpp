@@ -0,0 +1,852 @@
+#ifndef CPP_INDEXED_DOUBLY_LINKED_LIST_HPP_
+#define CPP_INDEXED_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Doubly Linked List with items in one contiguous array (arena), linked by 32-bit indices
+ * instead of pointers. Links take 8 bytes per item instead of 16 and neighbouring items
+ * usually share cache lines. Removed items go to a free list inside the arena and are reused
+ * by later pushes. The arena grows by doubling, like std::vector; items keep their index,
+ * so iterators stay valid when the arena grows. The whole arena is one allocation, which is freed
+ * at once, and lists of trivially copyable values are copied with one memcpy.
+ * It has the push/pop/iterate/get interface of CDoublyLinkedList.
+ * @tparam T Type of items. Has to be move constructible.
+ * @tparam TAllocator Allocator of the arena.
+ */
+template<typename T, typename TAllocator = std::allocator<T>>
+class CIndexedDoublyLinkedList
+{
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief List item. Value is constructed only while the item is in the list.
+     */
+    struct CIndexedDoublyLinkedListItem
+    {
+        /**
+         * @brief Index of previous item, cNull for the first item.
+         */
+        uint32_t mPrevious;
+
+        /**
+         * @brief Index of next item, cNull for the last item. Next free item while the item is free.
+         */
+        uint32_t mNext;
+
+        /**
+         * @brief Storage for value.
+         */
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type mValue;
+    };
+
+    using Item = CIndexedDoublyLinkedListItem;
+
+    /**
+     * @brief Index meaning no item.
+     */
+    static const uint32_t cNull = UINT32_MAX;
+
+    /**
+     * @brief Capacity of arena after the first allocation.
+     */
+    static const uint32_t cMinCapacity = 8u;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for IndexedDoublyLinked container. Holds index of item and the list,
+     * so it is not invalidated when the arena grows.
+     */
+    class CIndexedDoublyLinkedListIterator
+    {
+        /**
+         * @brief List of item.
+         */
+        const CIndexedDoublyLinkedList* mList;
+
+        /**
+         * @brief Index of item, cNull for end().
+         */
+        uint32_t mIndex;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CIndexedDoublyLinkedListIterator()
+            : mList(nullptr)
+            , mIndex(cNull)
+        {}
+
+        CIndexedDoublyLinkedListIterator(const CIndexedDoublyLinkedList* aList, uint32_t aIndex)
+            : mList(aList)
+            , mIndex(aIndex)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        CIndexedDoublyLinkedListIterator& operator ++()
+        {
+            mIndex = mList->mItems[mIndex].mNext;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CIndexedDoublyLinkedListIterator operator ++(int)
+        {
+            CIndexedDoublyLinkedListIterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement. Works from end() too.
+         */
+        CIndexedDoublyLinkedListIterator& operator --()
+        {
+            mIndex = (mIndex == cNull) ? mList->mTail : mList->mItems[mIndex].mPrevious;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CIndexedDoublyLinkedListIterator operator --(int)
+        {
+            CIndexedDoublyLinkedListIterator it(*this);
+            --(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return valueOf(mList->mItems[mIndex]);
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &valueOf(mList->mItems[mIndex]);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CIndexedDoublyLinkedListIterator& alt)const
+        {
+            return (mIndex == alt.mIndex);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CIndexedDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return **this;
+        }
+    };
+
+    using DIterator = CIndexedDoublyLinkedListIterator;
+    using DReverseIterator = std::reverse_iterator<CIndexedDoublyLinkedListIterator>;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CIndexedDoublyLinkedList()
+        : CIndexedDoublyLinkedList(TAllocator())
+    {}
+
+    explicit CIndexedDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+        , mItems(nullptr)
+        , mCapacity(0)
+        , mUsed(0)
+        , mFirstFree(cNull)
+        , mBegin(cNull)
+        , mTail(cNull)
+        , mSize(0)
+    {}
+
+    /**
+     * @brief Copy constructor. Trivially copyable values are copied with the arena in one memcpy,
+     * other values are copied in list order into a compact arena.
+     * Complexity: O(n)
+     */
+    CIndexedDoublyLinkedList(const CIndexedDoublyLinkedList& aObj)
+        : CIndexedDoublyLinkedList(TAllocator(ItemTraits::select_on_container_copy_construction(aObj.mAllocator)))
+    {
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            if (aObj.mUsed != 0)
+            {
+                mItems = ItemTraits::allocate(mAllocator, aObj.mUsed);
+                std::memcpy(static_cast<void*>(mItems), aObj.mItems, aObj.mUsed * sizeof(Item));
+                mCapacity = aObj.mUsed;
+                mUsed = aObj.mUsed;
+                mFirstFree = aObj.mFirstFree;
+                mBegin = aObj.mBegin;
+                mTail = aObj.mTail;
+                mSize = aObj.mSize;
+            }
+        }
+        else
+        {
+            try
+            {
+                reserve(aObj.mSize);
+                for (const T& value : aObj)
+                {
+                    pushBack(value);
+                }
+            }
+            catch (...)
+            {
+                ClearList();
+                throw;
+            }
+        }
+    }
+
+    CIndexedDoublyLinkedList(CIndexedDoublyLinkedList&& aObj) noexcept
+        : mAllocator(std::move(aObj.mAllocator))
+        , mItems(aObj.mItems)
+        , mCapacity(aObj.mCapacity)
+        , mUsed(aObj.mUsed)
+        , mFirstFree(aObj.mFirstFree)
+        , mBegin(aObj.mBegin)
+        , mTail(aObj.mTail)
+        , mSize(aObj.mSize)
+    {
+        aObj.IniEmptyList();
+    }
+
+    ~CIndexedDoublyLinkedList()
+    {
+        ClearList();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CIndexedDoublyLinkedList& operator=(const CIndexedDoublyLinkedList& aObj)
+    {
+        if (this != &aObj)
+        {
+            clear();
+            for (const T& value : aObj)
+            {
+                pushBack(value);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment. Takes over the arena of the other list.
+     * Complexity: O(1) if allocator propagates or both allocators are equal,
+     * otherwise O(n) - values are moved into the arena of this list.
+     */
+    CIndexedDoublyLinkedList& operator=(CIndexedDoublyLinkedList&& aObj)
+        noexcept(ItemTraits::propagate_on_container_move_assignment::value || ItemTraits::is_always_equal::value)
+    {
+        if (this != &aObj)
+        {
+            if constexpr (!ItemTraits::propagate_on_container_move_assignment::value)
+            {
+                if (mAllocator != aObj.mAllocator)
+                {
+                    clear();
+                    reserve(aObj.mSize);
+                    for (uint32_t index = aObj.mBegin; index != cNull; index = aObj.mItems[index].mNext)
+                    {
+                        pushBack(std::move(valueOf(aObj.mItems[index])));
+                    }
+                    aObj.ClearList();
+                    return *this;
+                }
+            }
+            ClearList();
+            if constexpr (ItemTraits::propagate_on_container_move_assignment::value)
+            {
+                mAllocator = std::move(aObj.mAllocator);
+            }
+            mItems = aObj.mItems;
+            mCapacity = aObj.mCapacity;
+            mUsed = aObj.mUsed;
+            mFirstFree = aObj.mFirstFree;
+            mBegin = aObj.mBegin;
+            mTail = aObj.mTail;
+            mSize = aObj.mSize;
+            aObj.IniEmptyList();
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Compares lists
+     */
+    bool operator==(const CIndexedDoublyLinkedList& aObj) const
+    {
+        if (mSize != aObj.mSize)
+        {
+            return false;
+        }
+        for (DIterator thisIt = begin(), aObjIt = aObj.begin(); thisIt != end(); ++thisIt, ++aObjIt)
+        {
+            if (*thisIt != *aObjIt)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compare operator
+     */
+    bool operator!=(const CIndexedDoublyLinkedList& aObj) const
+    {
+        return !(*this == aObj);
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Returns number of items the arena holds without growing.
+     * Complexity: O(1)
+     */
+    uintmax_t capacity() const
+    {
+        return mCapacity;
+    }
+
+    /**
+     * @brief Grows the arena to hold at least given number of items.
+     * Complexity: O(n) if the arena grows, otherwise O(1)
+     * @param aCapacity Number of items.
+     */
+    void reserve(const uintmax_t aCapacity)
+    {
+        if (aCapacity > mCapacity)
+        {
+            if (aCapacity >= cNull)
+            {
+                throw std::length_error("Too many items for 32-bit indices");
+            }
+            reallocate(static_cast<uint32_t>(aCapacity));
+        }
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1) amortized
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        emplaceBack(aValue);
+    }
+
+    /**
+     * @brief Adds value to list. The value is moved into the list.
+     * Complexity: O(1) amortized
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value in place at the end of the list.
+     * Complexity: O(1) amortized
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceBack(TArgs&&... aArgs)
+    {
+        const uint32_t index = createItem(std::forward<TArgs>(aArgs)...);
+        Item& item = mItems[index];
+        item.mPrevious = mTail;
+        item.mNext = cNull;
+        if (mTail != cNull)
+        {
+            mItems[mTail].mNext = index;
+        }
+        else
+        {
+            mBegin = index;
+        }
+        mTail = index;
+        mSize++;
+        return valueOf(item);
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(1) amortized
+     * @param aValue Value.
+     */
+    void pushFront(const T& aValue)
+    {
+        emplaceFront(aValue);
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list. The value is moved into the list.
+     * Complexity: O(1) amortized
+     * @param aValue Value.
+     */
+    void pushFront(T&& aValue)
+    {
+        emplaceFront(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value in place at the beginning of the list.
+     * Complexity: O(1) amortized
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceFront(TArgs&&... aArgs)
+    {
+        const uint32_t index = createItem(std::forward<TArgs>(aArgs)...);
+        Item& item = mItems[index];
+        item.mPrevious = cNull;
+        item.mNext = mBegin;
+        if (mBegin != cNull)
+        {
+            mItems[mBegin].mPrevious = index;
+        }
+        else
+        {
+            mTail = index;
+        }
+        mBegin = index;
+        mSize++;
+        return valueOf(item);
+    }
+
+    /**
+     * @brief Removes last item from list. The value is moved out of the list.
+     * Complexity: O(1)
+     * @return Last item from list.
+     */
+    T popBack()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        const uint32_t index = mTail;
+        T returnItem = std::move(valueOf(mItems[index]));
+        mTail = mItems[index].mPrevious;
+        if (mTail != cNull)
+        {
+            mItems[mTail].mNext = cNull;
+        }
+        else
+        {
+            mBegin = cNull;
+        }
+        destroyItem(index);
+        return returnItem;
+    }
+
+    /**
+     * @brief Remove the first element from the list. The value is moved out of the list.
+     * Complexity: O(1)
+     * @return The first item from list.
+     */
+    T popFront()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        const uint32_t index = mBegin;
+        T returnItem = std::move(valueOf(mItems[index]));
+        mBegin = mItems[index].mNext;
+        if (mBegin != cNull)
+        {
+            mItems[mBegin].mPrevious = cNull;
+        }
+        else
+        {
+            mTail = cNull;
+        }
+        destroyItem(index);
+        return returnItem;
+    }
+
+    /**
+     * @brief Returns value at given position.
+     * Complexity: O(n) - the list is walked from the nearer end.
+     * @param aIndex Position of value.
+     * @return Pointer to value or null if the position is out of the list.
+     */
+    const T* get(const uintmax_t aIndex) const
+    {
+        if (aIndex >= mSize)
+        {
+            return nullptr;
+        }
+        uint32_t index;
+        if (aIndex < mSize / 2u)
+        {
+            index = mBegin;
+            for (uintmax_t i = 0; i < aIndex; ++i)
+            {
+                index = mItems[index].mNext;
+            }
+        }
+        else
+        {
+            index = mTail;
+            for (uintmax_t i = mSize - 1u; i > aIndex; --i)
+            {
+                index = mItems[index].mPrevious;
+            }
+        }
+        return &valueOf(mItems[index]);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        for (uint32_t index = mBegin; index != cNull; index = mItems[index].mNext)
+        {
+            if (valueOf(mItems[index]) == aValue)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Removes all items. The arena is kept for reuse.
+     * Complexity: O(n), O(1) for trivially destructible values.
+     */
+    void clear()
+    {
+        destroyValues();
+        mUsed = 0;
+        mFirstFree = cNull;
+        mBegin = cNull;
+        mTail = cNull;
+        mSize = 0;
+    }
+
+    /**
+     * @brief Returns iterator to the first item.
+     */
+    DIterator begin() const
+    {
+        return DIterator(this, mBegin);
+    }
+
+    /**
+     * @brief Returns iterator behind the last item. Can be decremented.
+     */
+    DIterator end() const
+    {
+        return DIterator(this, cNull);
+    }
+
+    /**
+     * @brief Returns reverse iterator to the last item.
+     */
+    DReverseIterator rbegin() const
+    {
+        return DReverseIterator(end());
+    }
+
+    /**
+     * @brief Returns reverse iterator before the first item.
+     */
+    DReverseIterator rend() const
+    {
+        return DReverseIterator(begin());
+    }
+
+    /**
+     * @brief Returns allocator of the list.
+     */
+    TAllocator get_allocator() const
+    {
+        return TAllocator(mAllocator);
+    }
+
+private:
+
+    using ItemAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Item>;
+    using ItemTraits = std::allocator_traits<ItemAllocator>;
+
+    /**
+     * @brief Allocator of arena.
+     */
+    ItemAllocator mAllocator;
+
+    /**
+     * @brief Arena of items.
+     */
+    Item* mItems;
+
+    /**
+     * @brief Number of items in arena.
+     */
+    uint32_t mCapacity;
+
+    /**
+     * @brief Number of items at the beginning of arena which were ever used, the rest was never touched.
+     */
+    uint32_t mUsed;
+
+    /**
+     * @brief Index of the first free item below mUsed, cNull if there isn't any.
+     */
+    uint32_t mFirstFree;
+
+    /**
+     * @brief Index of the first item of the list.
+     */
+    uint32_t mBegin;
+
+    /**
+     * @brief Index of the last item of the list.
+     */
+    uint32_t mTail;
+
+    /**
+     * @brief Number of items in the list.
+     */
+    uintmax_t mSize;
+
+    /**
+     * @brief Returns value of item.
+     */
+    static T& valueOf(Item& aItem)
+    {
+        return *std::launder(reinterpret_cast<T*>(&aItem.mValue));
+    }
+
+    /**
+     * @brief Returns value of item.
+     */
+    static const T& valueOf(const Item& aItem)
+    {
+        return *std::launder(reinterpret_cast<const T*>(&aItem.mValue));
+    }
+
+    /**
+     * @brief Takes free item, grows the arena if needed, and constructs value in it. Links are left to the caller.
+     * @return Index of item.
+     */
+    template<typename... TArgs>
+    uint32_t createItem(TArgs&&... aArgs)
+    {
+        uint32_t index = mFirstFree;
+        if (index == cNull)
+        {
+            if (mUsed == mCapacity)
+            {
+                if (mCapacity == cNull - 1u)
+                {
+                    throw std::length_error("Too many items for 32-bit indices");
+                }
+                const uint32_t capacity = (mCapacity < cMinCapacity) ? cMinCapacity
+                    : ((mCapacity < cNull / 2u) ? 2u * mCapacity : cNull - 1u);
+                reallocate(capacity);
+            }
+            index = mUsed;
+            ::new (static_cast<void*>(&mItems[index].mValue)) T(std::forward<TArgs>(aArgs)...);
+            mUsed++;
+        }
+        else
+        {
+            ::new (static_cast<void*>(&mItems[index].mValue)) T(std::forward<TArgs>(aArgs)...);
+            mFirstFree = mItems[index].mNext;
+        }
+        return index;
+    }
+
+    /**
+     * @brief Destroys value of unlinked item and puts the item to the free list.
+     */
+    void destroyItem(const uint32_t aIndex)
+    {
+        valueOf(mItems[aIndex]).~T();
+        mItems[aIndex].mNext = mFirstFree;
+        mFirstFree = aIndex;
+        mSize--;
+    }
+
+    /**
+     * @brief Moves items to new arena of given capacity. Indices of items don't change.
+     * Nothing changes if moving of a value throws.
+     */
+    void reallocate(const uint32_t aCapacity)
+    {
+        Item* items = ItemTraits::allocate(mAllocator, aCapacity);
+        if constexpr (std::is_trivially_copyable<T>::value)
+        {
+            if (mUsed != 0)
+            {
+                std::memcpy(static_cast<void*>(items), mItems, mUsed * sizeof(Item));
+            }
+        }
+        else
+        {
+            for (uint32_t index = 0; index < mUsed; ++index)
+            {
+                items[index].mPrevious = mItems[index].mPrevious;
+                items[index].mNext = mItems[index].mNext;
+            }
+            uint32_t index = mBegin;
+            try
+            {
+                for (; index != cNull; index = mItems[index].mNext)
+                {
+                    ::new (static_cast<void*>(&items[index].mValue)) T(std::move_if_noexcept(valueOf(mItems[index])));
+                }
+            }
+            catch (...)
+            {
+                for (uint32_t moved = mBegin; moved != index; moved = mItems[moved].mNext)
+                {
+                    valueOf(items[moved]).~T();
+                }
+                ItemTraits::deallocate(mAllocator, items, aCapacity);
+                throw;
+            }
+            destroyValues();
+        }
+        if (mItems != nullptr)
+        {
+            ItemTraits::deallocate(mAllocator, mItems, mCapacity);
+        }
+        mItems = items;
+        mCapacity = aCapacity;
+    }
+
+    /**
+     * @brief Destroys values of all items in the list, links stay untouched.
+     */
+    void destroyValues()
+    {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            for (uint32_t index = mBegin; index != cNull; index = mItems[index].mNext)
+            {
+                valueOf(mItems[index]).~T();
+            }
+        }
+    }
+
+    /**
+     * @brief Method for initialization empty List
+     */
+    void IniEmptyList()
+    {
+        mItems = nullptr;
+        mCapacity = 0;
+        mUsed = 0;
+        mFirstFree = cNull;
+        mBegin = cNull;
+        mTail = cNull;
+        mSize = 0;
+    }
+
+    /**
+     * @brief Method which at all clear List. The arena is freed at once.
+     */
+    void ClearList()
+    {
+        if (mItems != nullptr)
+        {
+            destroyValues();
+            ItemTraits::deallocate(mAllocator, mItems, mCapacity);
+        }
+        IniEmptyList();
+    }
+};
+
+#endif
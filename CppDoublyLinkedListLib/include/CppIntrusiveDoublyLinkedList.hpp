@@ -0,0 +1,496 @@
+#ifndef CPP_INTRUSIVE_DOUBLY_LINKED_LIST_HPP_
+#define CPP_INTRUSIVE_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+/**
+ * @brief Links of an object in CIntrusiveDoublyLinkedList. The object embeds the hook as a member,
+ * one hook per list the object can be in at the same time.
+ * @tparam T Type of object which embeds the hook.
+ */
+template<typename T>
+struct CDoublyLinkedListHook
+{
+    /*----------------------------------------------------------------------
+                            Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CDoublyLinkedListHook() noexcept
+        : mPrevious(nullptr)
+        , mNext(nullptr)
+    {}
+
+    /**
+     * @brief Copy of an object is not linked.
+     */
+    CDoublyLinkedListHook(const CDoublyLinkedListHook&) noexcept
+        : CDoublyLinkedListHook()
+    {}
+
+    /**
+     * @brief Assignment keeps links of the object.
+     */
+    CDoublyLinkedListHook& operator=(const CDoublyLinkedListHook&) noexcept
+    {
+        return *this;
+    }
+
+    /**
+     * @brief Pointer to previous object.
+     */
+    T* mPrevious;
+
+    /**
+     * @brief Pointer to next object.
+     */
+    T* mNext;
+};
+
+/**
+ * @brief Intrusive Doubly Linked List. Links objects which the list does not own through a hook embedded
+ * in them, so no operation allocates and all of them are noexcept. Any object can be unlinked
+ * in O(1) given only a reference to it. Objects must stay alive while they are linked.
+ *
+ * Usage:
+ *   struct CJob { int mId; CDoublyLinkedListHook<CJob> mHook; };
+ *   CIntrusiveDoublyLinkedList<CJob, &CJob::mHook> jobs;
+ * @tparam T Type of objects.
+ * @tparam THook Hook member of T used by this list.
+ */
+template<typename T, CDoublyLinkedListHook<T> T::* THook>
+class CIntrusiveDoublyLinkedList
+{
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for IntrusiveDoublyLinked container. Gives access to the linked objects.
+     */
+    class CIntrusiveDoublyLinkedListIterator
+    {
+        /**
+         * @brief Pointer to object.
+         */
+        T* mPtr;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = T*;
+        using reference = T&;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        explicit CIntrusiveDoublyLinkedListIterator(T* aPtr) noexcept
+            : mPtr(aPtr)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator add
+         */
+        CIntrusiveDoublyLinkedListIterator operator +(const int aDiffIndex)const noexcept
+        {
+            T* arg = mPtr;
+            for (int i = 0; i < aDiffIndex; i++)
+            {
+                arg = (arg->*THook).mNext;
+            }
+            return CIntrusiveDoublyLinkedListIterator(arg);
+        }
+
+        /**
+         * @brief Operator sub
+         */
+        CIntrusiveDoublyLinkedListIterator operator -(const int aDiffIndex)const noexcept
+        {
+            T* arg = mPtr;
+            for (int i = 0; i < aDiffIndex; i++)
+            {
+                arg = (arg->*THook).mPrevious;
+            }
+            return CIntrusiveDoublyLinkedListIterator(arg);
+        }
+
+        /**
+         * @brief Operator increment
+         */
+        CIntrusiveDoublyLinkedListIterator& operator ++() noexcept
+        {
+            mPtr = (mPtr->*THook).mNext;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CIntrusiveDoublyLinkedListIterator operator ++(int) noexcept
+        {
+            CIntrusiveDoublyLinkedListIterator it(mPtr);
+            mPtr = (mPtr->*THook).mNext;
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement
+         */
+        CIntrusiveDoublyLinkedListIterator& operator --() noexcept
+        {
+            mPtr = (mPtr->*THook).mPrevious;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CIntrusiveDoublyLinkedListIterator operator --(int) noexcept
+        {
+            CIntrusiveDoublyLinkedListIterator it(mPtr);
+            mPtr = (mPtr->*THook).mPrevious;
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        T& operator*()const noexcept
+        {
+            return *mPtr;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        T* operator->()const noexcept
+        {
+            return mPtr;
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CIntrusiveDoublyLinkedListIterator& alt)const noexcept
+        {
+            return (mPtr == alt.mPtr);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CIntrusiveDoublyLinkedListIterator& alt)const noexcept
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return object of iterator;
+         */
+        T& getValueItem()const noexcept
+        {
+            return *mPtr;
+        }
+    };
+
+    using DIterator = CIntrusiveDoublyLinkedListIterator;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CIntrusiveDoublyLinkedList() noexcept
+        : mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+    {}
+
+    CIntrusiveDoublyLinkedList(const CIntrusiveDoublyLinkedList&) = delete;
+
+    /**
+     * @brief Takes over objects of other list, which becomes empty.
+     */
+    CIntrusiveDoublyLinkedList(CIntrusiveDoublyLinkedList&& aObj) noexcept
+        : mBegin(aObj.mBegin)
+        , mTail(aObj.mTail)
+        , mSize(aObj.mSize)
+    {
+        aObj.IniEmptyList();
+    }
+
+    /**
+     * @brief Unlinks all objects.
+     */
+    ~CIntrusiveDoublyLinkedList()
+    {
+        clear();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CIntrusiveDoublyLinkedList& operator=(const CIntrusiveDoublyLinkedList&) = delete;
+
+    /**
+     * @brief Unlinks own objects and takes over objects of other list.
+     */
+    CIntrusiveDoublyLinkedList& operator=(CIntrusiveDoublyLinkedList&& aObj) noexcept
+    {
+        if (this != &aObj)
+        {
+            clear();
+            mBegin = aObj.mBegin;
+            mTail = aObj.mTail;
+            mSize = aObj.mSize;
+            aObj.IniEmptyList();
+        }
+        return *this;
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of objects.
+     * Complexity: O(1)
+     * @return Number of objects.
+     */
+    uintmax_t size() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const noexcept
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Links object to the end of list. Object must not be linked by this hook.
+     * Complexity: O(1)
+     * @param aValue Object to link.
+     */
+    void pushBack(T& aValue) noexcept
+    {
+        linkBefore(nullptr, aValue);
+    }
+
+    /**
+     * @brief Links object to the beginning of list. Object must not be linked by this hook.
+     * Complexity: O(1)
+     * @param aValue Object to link.
+     */
+    void pushFront(T& aValue) noexcept
+    {
+        linkBefore(mBegin, aValue);
+    }
+
+    /**
+     * @brief Links object before position. Object must not be linked by this hook.
+     * Complexity: O(1)
+     * @param aPosition Position, end() links to the end of list.
+     * @param aValue Object to link.
+     * @return Iterator to the object.
+     */
+    DIterator insert(const DIterator& aPosition, T& aValue) noexcept
+    {
+        linkBefore(aPosition.operator->(), aValue);
+        return DIterator(&aValue);
+    }
+
+    /**
+     * @brief Unlinks the last object. The list must not be empty.
+     * Complexity: O(1)
+     * @return Unlinked object.
+     */
+    T& popBack() noexcept
+    {
+        assert(mTail != nullptr);
+        T& value = *mTail;
+        unlink(value);
+        return value;
+    }
+
+    /**
+     * @brief Unlinks the first object. The list must not be empty.
+     * Complexity: O(1)
+     * @return Unlinked object.
+     */
+    T& popFront() noexcept
+    {
+        assert(mBegin != nullptr);
+        T& value = *mBegin;
+        unlink(value);
+        return value;
+    }
+
+    /**
+     * @brief Unlinks object from any position. Object must be linked in this list.
+     * Complexity: O(1)
+     * @param aValue Object to unlink.
+     */
+    void unlink(T& aValue) noexcept
+    {
+        CDoublyLinkedListHook<T>& hook = aValue.*THook;
+        if (hook.mPrevious != nullptr)
+        {
+            (hook.mPrevious->*THook).mNext = hook.mNext;
+        }
+        else
+        {
+            mBegin = hook.mNext;
+        }
+        if (hook.mNext != nullptr)
+        {
+            (hook.mNext->*THook).mPrevious = hook.mPrevious;
+        }
+        else
+        {
+            mTail = hook.mPrevious;
+        }
+        hook.mPrevious = nullptr;
+        hook.mNext = nullptr;
+        mSize--;
+    }
+
+    /**
+     * @brief Returns iterator to object linked in this list.
+     * Complexity: O(1)
+     */
+    DIterator iteratorTo(T& aValue) const noexcept
+    {
+        return DIterator(&aValue);
+    }
+
+    /**
+     * @brief Unlinks all objects.
+     * Complexity: O(n)
+     */
+    void clear() noexcept
+    {
+        T* item = mBegin;
+        while (item != nullptr)
+        {
+            CDoublyLinkedListHook<T>& hook = item->*THook;
+            item = hook.mNext;
+            hook.mPrevious = nullptr;
+            hook.mNext = nullptr;
+        }
+        IniEmptyList();
+    }
+
+    /**
+     * @brief Swaps objects of lists.
+     */
+    void swap(CIntrusiveDoublyLinkedList& aObj) noexcept
+    {
+        std::swap(mBegin, aObj.mBegin);
+        std::swap(mTail, aObj.mTail);
+        std::swap(mSize, aObj.mSize);
+    }
+
+    /**
+     * @brief Returns iterator to the first object.
+     */
+    DIterator begin() const noexcept
+    {
+        return DIterator(mBegin);
+    }
+
+    /**
+     * @brief Returns iterator behind the last object.
+     */
+    DIterator end() const noexcept
+    {
+        return DIterator(nullptr);
+    }
+
+private:
+
+    /**
+     * @brief Pointer to the first object.
+     */
+    T* mBegin;
+
+    /**
+     * @brief Pointer to the last object.
+     */
+    T* mTail;
+
+    /**
+     * @brief Number of objects.
+     */
+    uintmax_t mSize;
+
+    /**
+     * @brief Links object before given object, null links to the end.
+     */
+    void linkBefore(T* aPosition, T& aValue) noexcept
+    {
+        CDoublyLinkedListHook<T>& hook = aValue.*THook;
+        assert((hook.mPrevious == nullptr) && (hook.mNext == nullptr) && (mBegin != &aValue));
+        T* previous = (aPosition != nullptr) ? (aPosition->*THook).mPrevious : mTail;
+        hook.mPrevious = previous;
+        hook.mNext = aPosition;
+        if (previous != nullptr)
+        {
+            (previous->*THook).mNext = &aValue;
+        }
+        else
+        {
+            mBegin = &aValue;
+        }
+        if (aPosition != nullptr)
+        {
+            (aPosition->*THook).mPrevious = &aValue;
+        }
+        else
+        {
+            mTail = &aValue;
+        }
+        mSize++;
+    }
+
+    /**
+     * @brief Method for initialization empty List
+     */
+    void IniEmptyList() noexcept
+    {
+        mBegin = nullptr;
+        mTail = nullptr;
+        mSize = 0;
+    }
+};
+
+/**
+ * @brief Swaps objects of lists.
+ */
+template<typename T, CDoublyLinkedListHook<T> T::* THook>
+void swap(CIntrusiveDoublyLinkedList<T, THook>& aLeft, CIntrusiveDoublyLinkedList<T, THook>& aRight) noexcept
+{
+    aLeft.swap(aRight);
+}
+
+#endif
@@ -0,0 +1,845 @@
+#ifndef CPP_MAPPED_DOUBLY_LINKED_LIST_HPP_
+#define CPP_MAPPED_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Doubly Linked List which lives in a memory-mapped file. Items are linked by their index
+ * in the item array of the file, which is an offset relative to the beginning of the mapping,
+ * so the file is valid wherever it is mapped. Opening an existing file only maps it and checks
+ * its header: the list is usable at once, whatever its size.
+ *
+ * The file holds a header with the state of the list, followed by the item array. Removed items
+ * go to a free list in the file and are reused by later pushes. When the array is full,
+ * the file grows by doubling and is mapped again; iterators hold indices, so they stay valid.
+ *
+ * Changes reach the file through the page cache, sync() writes them to the disk.
+ * Changes are not atomic, so the header is marked while the file is open. A file which was not closed,
+ * e.g. after a crash during a push or pop, is repaired when it is opened: the list is rebuilt
+ * from the forward links, and items not reachable from the first one are freed.
+ * Only one list object may have a file open at a time, the file is locked with flock() while it is open.
+ * It has the push/pop/iterate/get interface of CDoublyLinkedList. POSIX only.
+ * @tparam T Type of items. Has to be trivially copyable, values are stored as their bytes.
+ */
+template<typename T>
+class CMappedDoublyLinkedList
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Values of mapped list have to be trivially copyable");
+    static_assert(alignof(T) <= 64u, "Values of mapped list can be aligned to 64 bytes at most");
+
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Header at the beginning of the file, holds the state of the list.
+     */
+    struct alignas(64) CMappedDoublyLinkedListHeader
+    {
+        /**
+         * @brief Identification of the file: magic "CDLM", version of the layout, size and alignment of values.
+         */
+        char mMagic[4];
+        uint32_t mVersion;
+        uint32_t mValueSize;
+        uint32_t mValueAlign;
+
+        /**
+         * @brief Number of items in the file and number of items at the beginning of the array which were ever used.
+         */
+        uint64_t mCapacity;
+        uint64_t mUsed;
+
+        /**
+         * @brief Index of the first free item below mUsed, cNull if there isn't any.
+         */
+        uint64_t mFirstFree;
+
+        /**
+         * @brief Indices of the first and the last item of the list, and the number of items.
+         */
+        uint64_t mBegin;
+        uint64_t mTail;
+        uint64_t mSize;
+
+        /**
+         * @brief Set while a list has the file open, the file wasn't closed if it is set on opening.
+         */
+        uint32_t mOpen;
+    };
+
+    /**
+     * @brief List item in the file.
+     */
+    struct CMappedDoublyLinkedListItem
+    {
+        /**
+         * @brief Index of previous item, cNull for the first item.
+         */
+        uint64_t mPrevious;
+
+        /**
+         * @brief Index of next item, cNull for the last item. Next free item while the item is free.
+         */
+        uint64_t mNext;
+
+        T mValue;
+    };
+
+    using Header = CMappedDoublyLinkedListHeader;
+    using Item = CMappedDoublyLinkedListItem;
+
+    /**
+     * @brief Index meaning no item.
+     */
+    static const uint64_t cNull = UINT64_MAX;
+
+    /**
+     * @brief Capacity of a new file.
+     */
+    static const uint64_t cMinCapacity = 64u;
+
+    /**
+     * @brief Version of the layout of file.
+     */
+    static const uint32_t cVersion = 2u;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for MappedDoublyLinked container. Holds index of item and the list,
+     * so it is not invalidated when the file is mapped again.
+     */
+    class CMappedDoublyLinkedListIterator
+    {
+        /**
+         * @brief List of item.
+         */
+        const CMappedDoublyLinkedList* mList;
+
+        /**
+         * @brief Index of item, cNull for end().
+         */
+        uint64_t mIndex;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CMappedDoublyLinkedListIterator()
+            : mList(nullptr)
+            , mIndex(cNull)
+        {}
+
+        CMappedDoublyLinkedListIterator(const CMappedDoublyLinkedList* aList, uint64_t aIndex)
+            : mList(aList)
+            , mIndex(aIndex)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        CMappedDoublyLinkedListIterator& operator ++()
+        {
+            mIndex = mList->mItems[mIndex].mNext;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CMappedDoublyLinkedListIterator operator ++(int)
+        {
+            CMappedDoublyLinkedListIterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement. Works from end() too.
+         */
+        CMappedDoublyLinkedListIterator& operator --()
+        {
+            mIndex = (mIndex == cNull) ? mList->mHeader->mTail : mList->mItems[mIndex].mPrevious;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CMappedDoublyLinkedListIterator operator --(int)
+        {
+            CMappedDoublyLinkedListIterator it(*this);
+            --(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return mList->mItems[mIndex].mValue;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &(mList->mItems[mIndex].mValue);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CMappedDoublyLinkedListIterator& alt)const
+        {
+            return (mIndex == alt.mIndex);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CMappedDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return **this;
+        }
+    };
+
+    using DIterator = CMappedDoublyLinkedListIterator;
+    using DReverseIterator = std::reverse_iterator<CMappedDoublyLinkedListIterator>;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Opens the list in file, the file is created with an empty list if it doesn't exist or is empty.
+     * Complexity: O(1), O(n) if the file wasn't closed and is repaired.
+     * @param aPath Path of file.
+     * @throw std::runtime_error if the file can't be opened or mapped, is open by another list,
+     * holds something else than a list of T, or is damaged.
+     */
+    explicit CMappedDoublyLinkedList(const std::string& aPath)
+        : mFd(::open(aPath.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644))
+        , mMapping(nullptr)
+        , mMappingSize(0)
+        , mHeader(nullptr)
+        , mItems(nullptr)
+    {
+        if (mFd < 0)
+        {
+            throwError("Opening of list file " + aPath + " failed");
+        }
+        try
+        {
+            if (::flock(mFd, LOCK_EX | LOCK_NB) != 0)
+            {
+                if (errno == EWOULDBLOCK)
+                {
+                    throw std::runtime_error("List file " + aPath + " is open by another list");
+                }
+                throwError("Locking of list file " + aPath + " failed");
+            }
+            struct stat status;
+            if (::fstat(mFd, &status) != 0)
+            {
+                throwError("Reading size of list file failed");
+            }
+            if (status.st_size == 0)
+            {
+                resizeFile(fileSize(cMinCapacity));
+                map(fileSize(cMinCapacity));
+                std::memcpy(mHeader->mMagic, cMagic, sizeof(cMagic));
+                mHeader->mVersion = cVersion;
+                mHeader->mValueSize = sizeof(T);
+                mHeader->mValueAlign = alignof(T);
+                mHeader->mCapacity = cMinCapacity;
+                mHeader->mUsed = 0;
+                mHeader->mFirstFree = cNull;
+                mHeader->mBegin = cNull;
+                mHeader->mTail = cNull;
+                mHeader->mSize = 0;
+                mHeader->mOpen = 0;
+            }
+            else
+            {
+                const uint64_t size = static_cast<uint64_t>(status.st_size);
+                if (size < sizeof(Header))
+                {
+                    throw std::runtime_error("List file " + aPath + " is truncated");
+                }
+                map(size);
+                if ((std::memcmp(mHeader->mMagic, cMagic, sizeof(cMagic)) != 0) || (mHeader->mVersion != cVersion))
+                {
+                    throw std::runtime_error("File " + aPath + " doesn't hold a list of this version");
+                }
+                if ((mHeader->mValueSize != sizeof(T)) || (mHeader->mValueAlign != alignof(T)))
+                {
+                    throw std::runtime_error("List file " + aPath + " holds values of other type");
+                }
+                if ((mHeader->mCapacity == 0) || (mHeader->mCapacity > (UINT64_MAX - sizeof(Header)) / sizeof(Item))
+                    || (size < fileSize(mHeader->mCapacity)))
+                {
+                    throw std::runtime_error("List file " + aPath + " is truncated");
+                }
+                checkHeader(aPath);
+                if (mHeader->mOpen != 0)
+                {
+                    repair(aPath);
+                }
+            }
+            mHeader->mOpen = 1u;
+        }
+        catch (...)
+        {
+            unmap();
+            ::close(mFd);
+            throw;
+        }
+    }
+
+    CMappedDoublyLinkedList(const CMappedDoublyLinkedList&) = delete;
+
+    CMappedDoublyLinkedList(CMappedDoublyLinkedList&& aObj) noexcept
+        : mFd(aObj.mFd)
+        , mMapping(aObj.mMapping)
+        , mMappingSize(aObj.mMappingSize)
+        , mHeader(aObj.mHeader)
+        , mItems(aObj.mItems)
+    {
+        aObj.mFd = -1;
+        aObj.mMapping = nullptr;
+        aObj.mMappingSize = 0;
+        aObj.mHeader = nullptr;
+        aObj.mItems = nullptr;
+    }
+
+    /**
+     * @brief Unmaps and closes the file. The list stays in the file.
+     */
+    ~CMappedDoublyLinkedList()
+    {
+        if (mHeader != nullptr)
+        {
+            mHeader->mOpen = 0;
+        }
+        unmap();
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CMappedDoublyLinkedList& operator=(const CMappedDoublyLinkedList&) = delete;
+
+    CMappedDoublyLinkedList& operator=(CMappedDoublyLinkedList&& aObj) noexcept
+    {
+        std::swap(mFd, aObj.mFd);
+        std::swap(mMapping, aObj.mMapping);
+        std::swap(mMappingSize, aObj.mMappingSize);
+        std::swap(mHeader, aObj.mHeader);
+        std::swap(mItems, aObj.mItems);
+        return *this;
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mHeader->mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mHeader->mSize == 0);
+    }
+
+    /**
+     * @brief Returns number of items the file holds without growing.
+     * Complexity: O(1)
+     */
+    uintmax_t capacity() const
+    {
+        return mHeader->mCapacity;
+    }
+
+    /**
+     * @brief Grows the file to hold at least given number of items.
+     * Complexity: O(1) - the file is extended and mapped again, pages are not touched.
+     * @param aCapacity Number of items.
+     */
+    void reserve(const uintmax_t aCapacity)
+    {
+        if (aCapacity > mHeader->mCapacity)
+        {
+            grow(aCapacity);
+        }
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1) amortized
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        const uint64_t index = createItem(aValue);
+        Item& item = mItems[index];
+        item.mPrevious = mHeader->mTail;
+        item.mNext = cNull;
+        if (mHeader->mTail != cNull)
+        {
+            mItems[mHeader->mTail].mNext = index;
+        }
+        else
+        {
+            mHeader->mBegin = index;
+        }
+        mHeader->mTail = index;
+        mHeader->mSize++;
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(1) amortized
+     * @param aValue Value.
+     */
+    void pushFront(const T& aValue)
+    {
+        const uint64_t index = createItem(aValue);
+        Item& item = mItems[index];
+        item.mPrevious = cNull;
+        item.mNext = mHeader->mBegin;
+        if (mHeader->mBegin != cNull)
+        {
+            mItems[mHeader->mBegin].mPrevious = index;
+        }
+        else
+        {
+            mHeader->mTail = index;
+        }
+        mHeader->mBegin = index;
+        mHeader->mSize++;
+    }
+
+    /**
+     * @brief Removes last item from list.
+     * Complexity: O(1)
+     * @return Last item from list.
+     */
+    T popBack()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        const uint64_t index = mHeader->mTail;
+        const T returnItem = mItems[index].mValue;
+        mHeader->mTail = mItems[index].mPrevious;
+        if (mHeader->mTail != cNull)
+        {
+            mItems[mHeader->mTail].mNext = cNull;
+        }
+        else
+        {
+            mHeader->mBegin = cNull;
+        }
+        destroyItem(index);
+        return returnItem;
+    }
+
+    /**
+     * @brief Remove the first element from the list.
+     * Complexity: O(1)
+     * @return The first item from list.
+     */
+    T popFront()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        const uint64_t index = mHeader->mBegin;
+        const T returnItem = mItems[index].mValue;
+        mHeader->mBegin = mItems[index].mNext;
+        if (mHeader->mBegin != cNull)
+        {
+            mItems[mHeader->mBegin].mPrevious = cNull;
+        }
+        else
+        {
+            mHeader->mTail = cNull;
+        }
+        destroyItem(index);
+        return returnItem;
+    }
+
+    /**
+     * @brief Returns value at given position.
+     * Complexity: O(n) - the list is walked from the nearer end.
+     * @param aIndex Position of value.
+     * @return Pointer to value or null if the position is out of the list. Valid until the file grows.
+     */
+    const T* get(const uintmax_t aIndex) const
+    {
+        if (aIndex >= mHeader->mSize)
+        {
+            return nullptr;
+        }
+        uint64_t index;
+        if (aIndex < mHeader->mSize / 2u)
+        {
+            index = mHeader->mBegin;
+            for (uintmax_t i = 0; i < aIndex; ++i)
+            {
+                index = mItems[index].mNext;
+            }
+        }
+        else
+        {
+            index = mHeader->mTail;
+            for (uintmax_t i = mHeader->mSize - 1u; i > aIndex; --i)
+            {
+                index = mItems[index].mPrevious;
+            }
+        }
+        return &(mItems[index].mValue);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        for (uint64_t index = mHeader->mBegin; index != cNull; index = mItems[index].mNext)
+        {
+            if (mItems[index].mValue == aValue)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Removes all items. The file keeps its size.
+     * Complexity: O(1)
+     */
+    void clear()
+    {
+        mHeader->mUsed = 0;
+        mHeader->mFirstFree = cNull;
+        mHeader->mBegin = cNull;
+        mHeader->mTail = cNull;
+        mHeader->mSize = 0;
+    }
+
+    /**
+     * @brief Writes changes of the list to the disk and waits for it.
+     */
+    void sync()
+    {
+        if (::msync(mMapping, mMappingSize, MS_SYNC) != 0)
+        {
+            throwError("Synchronization of list file failed");
+        }
+    }
+
+    /**
+     * @brief Returns iterator to the first item.
+     */
+    DIterator begin() const
+    {
+        return DIterator(this, mHeader->mBegin);
+    }
+
+    /**
+     * @brief Returns iterator behind the last item. Can be decremented.
+     */
+    DIterator end() const
+    {
+        return DIterator(this, cNull);
+    }
+
+    /**
+     * @brief Returns reverse iterator to the last item.
+     */
+    DReverseIterator rbegin() const
+    {
+        return DReverseIterator(end());
+    }
+
+    /**
+     * @brief Returns reverse iterator before the first item.
+     */
+    DReverseIterator rend() const
+    {
+        return DReverseIterator(begin());
+    }
+
+private:
+
+    static constexpr char cMagic[4] = {'C', 'D', 'L', 'M'};
+
+    /**
+     * @brief Descriptor of the file.
+     */
+    int mFd;
+
+    /**
+     * @brief Mapping of the whole file and its size.
+     */
+    void* mMapping;
+    uint64_t mMappingSize;
+
+    /**
+     * @brief Header and item array in the mapping.
+     */
+    Header* mHeader;
+    Item* mItems;
+
+    /**
+     * @brief Returns size of file with given number of items.
+     */
+    static uint64_t fileSize(const uint64_t aCapacity)
+    {
+        return sizeof(Header) + aCapacity * sizeof(Item);
+    }
+
+    /**
+     * @brief Throws std::runtime_error with message and description of errno.
+     */
+    [[noreturn]] static void throwError(const std::string& aMessage)
+    {
+        throw std::runtime_error(aMessage + ": " + std::strerror(errno));
+    }
+
+    /**
+     * @brief Checks that the state in header is within the item array.
+     * @throw std::runtime_error if it isn't.
+     */
+    void checkHeader(const std::string& aPath) const
+    {
+        const uint64_t used = mHeader->mUsed;
+        const auto isValid = [used](const uint64_t aIndex)
+        {
+            return (aIndex == cNull) || (aIndex < used);
+        };
+        if ((used > mHeader->mCapacity) || (mHeader->mSize > used) || !isValid(mHeader->mBegin)
+            || !isValid(mHeader->mTail) || !isValid(mHeader->mFirstFree))
+        {
+            throw std::runtime_error("List file " + aPath + " is damaged");
+        }
+    }
+
+    /**
+     * @brief Rebuilds the list of a file which wasn't closed. The forward links from the first item are trusted,
+     * backward links, the last item and the size are set from them, and all other items are freed.
+     * Complexity: O(n)
+     * @throw std::runtime_error if the forward links leave the item array or form a cycle.
+     */
+    void repair(const std::string& aPath)
+    {
+        const uint64_t used = mHeader->mUsed;
+        std::vector<bool> linked(used, false);
+        uint64_t previous = cNull;
+        uint64_t size = 0;
+        for (uint64_t index = mHeader->mBegin; index != cNull; index = mItems[index].mNext)
+        {
+            if ((index >= used) || linked[index])
+            {
+                throw std::runtime_error("List file " + aPath + " is damaged");
+            }
+            linked[index] = true;
+            mItems[index].mPrevious = previous;
+            previous = index;
+            size++;
+        }
+        mHeader->mTail = previous;
+        mHeader->mSize = size;
+
+        mHeader->mFirstFree = cNull;
+        for (uint64_t index = used; index-- > 0;)
+        {
+            if (!linked[index])
+            {
+                mItems[index].mNext = mHeader->mFirstFree;
+                mHeader->mFirstFree = index;
+            }
+        }
+    }
+
+    /**
+     * @brief Maps given size of the file.
+     */
+    void map(const uint64_t aSize)
+    {
+        void* mapping = ::mmap(nullptr, aSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throwError("Mapping of list file failed");
+        }
+        mMapping = mapping;
+        mMappingSize = aSize;
+        mHeader = static_cast<Header*>(mapping);
+        mItems = reinterpret_cast<Item*>(static_cast<char*>(mapping) + sizeof(Header));
+    }
+
+    /**
+     * @brief Unmaps the file if it is mapped.
+     */
+    void unmap() noexcept
+    {
+        if (mMapping != nullptr)
+        {
+            ::munmap(mMapping, mMappingSize);
+            mMapping = nullptr;
+            mHeader = nullptr;
+            mItems = nullptr;
+        }
+    }
+
+    /**
+     * @brief Sets size of the file.
+     */
+    void resizeFile(const uint64_t aSize)
+    {
+        while (::ftruncate(mFd, static_cast<off_t>(aSize)) != 0)
+        {
+            if (errno != EINTR)
+            {
+                throwError("Growing of list file failed");
+            }
+        }
+    }
+
+    /**
+     * @brief Grows the file to hold given number of items and maps it again.
+     * The list is unchanged if the call throws.
+     */
+    void grow(const uint64_t aCapacity)
+    {
+        if (aCapacity > (UINT64_MAX - sizeof(Header)) / sizeof(Item))
+        {
+            throw std::length_error("Too many items for list file");
+        }
+        const uint64_t oldSize = mMappingSize;
+        resizeFile(fileSize(aCapacity));
+        void* mapping = ::mmap(nullptr, fileSize(aCapacity), PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            const int error = errno;
+            resizeFile(oldSize);
+            errno = error;
+            throwError("Mapping of list file failed");
+        }
+        unmap();
+        mMapping = mapping;
+        mMappingSize = fileSize(aCapacity);
+        mHeader = static_cast<Header*>(mapping);
+        mItems = reinterpret_cast<Item*>(static_cast<char*>(mapping) + sizeof(Header));
+        mHeader->mCapacity = aCapacity;
+    }
+
+    /**
+     * @brief Takes free item, grows the file if needed, and stores value in it. Links are left to the caller.
+     * @param aValue Value, may be in the mapping, which is replaced when the file grows.
+     * @return Index of item.
+     */
+    uint64_t createItem(const T& aValue)
+    {
+        const T value = aValue;
+        uint64_t index = mHeader->mFirstFree;
+        if (index == cNull)
+        {
+            if (mHeader->mUsed == mHeader->mCapacity)
+            {
+                grow(2u * mHeader->mCapacity);
+            }
+            index = mHeader->mUsed;
+            mHeader->mUsed++;
+        }
+        else
+        {
+            mHeader->mFirstFree = mItems[index].mNext;
+        }
+        mItems[index].mValue = value;
+        return index;
+    }
+
+    /**
+     * @brief Puts unlinked item to the free list.
+     */
+    void destroyItem(const uint64_t aIndex)
+    {
+        mItems[aIndex].mNext = mHeader->mFirstFree;
+        mHeader->mFirstFree = aIndex;
+        mHeader->mSize--;
+    }
+};
+
+#endif
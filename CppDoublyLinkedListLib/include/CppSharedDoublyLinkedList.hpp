@@ -0,0 +1,1091 @@
+#ifndef CPP_SHARED_DOUBLY_LINKED_LIST_HPP_
+#define CPP_SHARED_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @brief Layout of the shared memory of CSharedDoublyLinkedList. Every process which opens the list
+ * has to be built with the same layout.
+ */
+namespace DoublyLinkedListShared
+{
+
+/**
+ * @brief Index meaning no item.
+ */
+static constexpr uint64_t cNull = UINT64_MAX;
+
+/**
+ * @brief Version of the layout.
+ */
+static constexpr uint32_t cVersion = 2u;
+
+/**
+ * @brief Identification of the shared memory.
+ */
+static constexpr char cMagic[4] = {'C', 'D', 'L', 'S'};
+
+/**
+ * @brief Number of slots of the registry of processes which hold items.
+ */
+static constexpr uint32_t cMaxOwners = 64u;
+
+/**
+ * @brief Slot which counts items of processes which found no free slot, their owners are unknown.
+ */
+static constexpr uint32_t cOverflow = cMaxOwners;
+
+/**
+ * @brief Slot meaning no slot.
+ */
+static constexpr uint32_t cNoSlot = UINT32_MAX;
+
+/**
+ * @brief State of item. Allocated and popped items belong to the process in mOwner.
+ */
+enum EItemState : uint32_t
+{
+    cFree = 0u,
+    cAllocated = 1u,
+    cQueued = 2u,
+    cPopped = 3u
+};
+
+/**
+ * @brief Links and state of item.
+ */
+struct CLinks
+{
+    /**
+     * @brief Index of previous item, cNull for the first item.
+     */
+    uint64_t mPrevious;
+
+    /**
+     * @brief Index of next item, cNull for the last item. Next free item while the item is free.
+     */
+    uint64_t mNext;
+
+    uint32_t mState;
+
+    /**
+     * @brief Process which holds allocated or popped item, and its slot in the registry of owners.
+     */
+    int32_t mOwner;
+    uint32_t mOwnerSlot;
+    uint32_t mReserved;
+};
+
+/**
+ * @brief Slot of the registry of owners: process and the number of items it holds.
+ * The slot is free while the process holds no item.
+ */
+struct COwner
+{
+    int32_t mPid;
+    uint32_t mReserved;
+    uint64_t mHeld;
+};
+
+/**
+ * @brief State of the list.
+ */
+struct CState
+{
+    uint64_t mBegin;
+    uint64_t mTail;
+    uint64_t mSize;
+    uint64_t mFirstFree;
+};
+
+/**
+ * @brief Undo record of the change in progress. A change touches the state, at most two items
+ * and at most one slot of the registry of owners; their old values are saved before the change,
+ * so the change can be rolled back when its process dies in the middle of it.
+ */
+struct CJournal
+{
+    uint64_t mActive;
+    CState mState;
+    uint64_t mIndices[2];
+    CLinks mLinks[2];
+    uint32_t mOwnerSlot;
+    uint32_t mReserved;
+    COwner mOwner;
+};
+
+/**
+ * @brief Header at the beginning of the shared memory.
+ */
+struct alignas(64) CHeader
+{
+    /**
+     * @brief Identification: magic "CDLS", version of the layout, size and alignment of values.
+     */
+    char mMagic[4];
+    uint32_t mVersion;
+    uint32_t mValueSize;
+    uint32_t mValueAlign;
+
+    /**
+     * @brief Number of items, fixed at creation.
+     */
+    uint64_t mCapacity;
+
+    /**
+     * @brief Set when the header has been initialized.
+     */
+    std::atomic<uint32_t> mReady;
+
+    /**
+     * @brief Robust process-shared mutex guarding everything below, and conditions for waiting on it.
+     */
+    pthread_mutex_t mMutex;
+    pthread_cond_t mNotEmpty;
+    pthread_cond_t mNotFull;
+
+    CState mState;
+    CJournal mJournal;
+
+    /**
+     * @brief Registry of processes which hold items, and the overflow slot cOverflow.
+     * Items are looked through for items of dead processes only when a registered process is gone.
+     */
+    COwner mOwners[cMaxOwners + 1u];
+};
+
+/**
+ * @brief Item in the shared memory.
+ */
+template<typename T>
+struct CItem
+{
+    CLinks mLinks;
+    T mValue;
+};
+
+} // namespace DoublyLinkedListShared
+
+/**
+ * @brief Doubly Linked List in POSIX shared memory, used as a queue between processes of one host.
+ * Processes open the list by name. Values are not copied: a producer allocates an item,
+ * writes the value in place and pushes the item to the back. A consumer pops the item from the front,
+ * reads the value in place and releases the item.
+ *
+ * Items are linked by their index, so processes may map the memory at different addresses.
+ * The number of items is fixed when the list is created, allocate() waits while all items are in use.
+ * All changes are made under a robust process-shared mutex, and each change is journaled first:
+ * when a process dies holding the mutex, the next process rolls its change back.
+ * Items held by processes which no longer exist are reclaimed. Allocated items are freed
+ * and popped items are queued at the front again, so a value is delivered at least once.
+ * Reclaiming runs when the mutex of a dead process is taken over, when a wait lasts cReclaimInterval,
+ * and on reclaim(). A dead child process is recognized only after it has been waited for.
+ * Processes which hold items are registered in the header with the number of items they hold,
+ * so reclaiming checks the registry and looks through the items only when a registered process is gone.
+ * Items of processes beyond DoublyLinkedListShared::cMaxOwners are counted together, and while
+ * there are any, reclaiming looks through all items.
+ *
+ * Initialization is guarded by flock() on the shared memory. Memory left uninitialized by a process
+ * which died while creating the list is initialized again by the next process which opens it.
+ *
+ * A process forked after opening the list has to open the list again. POSIX only.
+ * @tparam T Type of values. Has to be trivially copyable, values are stored as their bytes.
+ */
+template<typename T>
+class CSharedDoublyLinkedList
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Values of shared list have to be trivially copyable");
+    static_assert(alignof(T) <= 64u, "Values of shared list can be aligned to 64 bytes at most");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Shared list needs lock-free atomics");
+
+    using Header = DoublyLinkedListShared::CHeader;
+    using Links = DoublyLinkedListShared::CLinks;
+    using Item = DoublyLinkedListShared::CItem<T>;
+
+    static constexpr uint64_t cNull = DoublyLinkedListShared::cNull;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Period after which a waiting process looks for items of dead processes.
+     */
+    static constexpr std::chrono::milliseconds cReclaimInterval{100};
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Opens the list of given name, the list is created if it doesn't exist or was not initialized.
+     * Complexity: O(1) for an existing list, O(aCapacity) for a new one.
+     * @param aName Name of shared memory, "/name".
+     * @param aCapacity Number of items of a new list. An existing list keeps its capacity.
+     * @throw std::runtime_error if the shared memory can't be opened or holds something else than a list of T.
+     */
+    CSharedDoublyLinkedList(const std::string& aName, const uintmax_t aCapacity)
+        : mFd(-1)
+        , mMapping(nullptr)
+        , mMappingSize(0)
+        , mHeader(nullptr)
+        , mItems(nullptr)
+        , mPid(static_cast<int32_t>(::getpid()))
+        , mSlot(0u)
+    {
+        if ((aCapacity == 0) || (aCapacity > (UINT64_MAX - sizeof(Header)) / sizeof(Item)))
+        {
+            throw std::length_error("Invalid capacity of shared list");
+        }
+        mFd = ::shm_open(aName.c_str(), O_RDWR | O_CREAT, 0600);
+        if (mFd < 0)
+        {
+            throwError("Opening of shared list " + aName + " failed", errno);
+        }
+        try
+        {
+            // the lock of a process which dies is released, so initialization left half done is redone
+            while (::flock(mFd, LOCK_EX) != 0)
+            {
+                if (errno != EINTR)
+                {
+                    throwError("Locking of shared list " + aName + " failed", errno);
+                }
+            }
+            try
+            {
+                if (initialized())
+                {
+                    open(aName);
+                }
+                else
+                {
+                    create(aCapacity);
+                }
+            }
+            catch (...)
+            {
+                ::flock(mFd, LOCK_UN);
+                throw;
+            }
+            ::flock(mFd, LOCK_UN);
+        }
+        catch (...)
+        {
+            unmap();
+            ::close(mFd);
+            throw;
+        }
+    }
+
+    CSharedDoublyLinkedList(const CSharedDoublyLinkedList&) = delete;
+
+    CSharedDoublyLinkedList(CSharedDoublyLinkedList&& aObj) noexcept
+        : mFd(aObj.mFd)
+        , mMapping(aObj.mMapping)
+        , mMappingSize(aObj.mMappingSize)
+        , mHeader(aObj.mHeader)
+        , mItems(aObj.mItems)
+        , mPid(aObj.mPid)
+        , mSlot(aObj.mSlot)
+    {
+        aObj.mFd = -1;
+        aObj.mMapping = nullptr;
+        aObj.mMappingSize = 0;
+        aObj.mHeader = nullptr;
+        aObj.mItems = nullptr;
+    }
+
+    /**
+     * @brief Unmaps the list. The list stays in the shared memory until unlink().
+     * Items held by this process stay held while the process lives.
+     */
+    ~CSharedDoublyLinkedList()
+    {
+        unmap();
+        if (mFd >= 0)
+        {
+            ::close(mFd);
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CSharedDoublyLinkedList& operator=(const CSharedDoublyLinkedList&) = delete;
+
+    CSharedDoublyLinkedList& operator=(CSharedDoublyLinkedList&& aObj) noexcept
+    {
+        std::swap(mFd, aObj.mFd);
+        std::swap(mMapping, aObj.mMapping);
+        std::swap(mMappingSize, aObj.mMappingSize);
+        std::swap(mHeader, aObj.mHeader);
+        std::swap(mItems, aObj.mItems);
+        std::swap(mPid, aObj.mPid);
+        std::swap(mSlot, aObj.mSlot);
+        return *this;
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Removes the name of shared list. Processes which have the list open can still use it.
+     * @param aName Name of shared memory.
+     * @return true if the name was removed, false if it didn't exist.
+     */
+    static bool unlink(const std::string& aName)
+    {
+        if (::shm_unlink(aName.c_str()) == 0)
+        {
+            return true;
+        }
+        if (errno != ENOENT)
+        {
+            throwError("Removing of shared list " + aName + " failed", errno);
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns a number of queued items.
+     * Complexity: O(1)
+     */
+    uintmax_t size() const
+    {
+        CLock lock(*this);
+        return mHeader->mState.mSize;
+    }
+
+    /**
+     * @brief Indicates if no item is queued.
+     * Complexity: O(1)
+     */
+    bool empty() const
+    {
+        return (size() == 0);
+    }
+
+    /**
+     * @brief Returns number of items of the list.
+     * Complexity: O(1)
+     */
+    uintmax_t capacity() const
+    {
+        return mHeader->mCapacity;
+    }
+
+    /**
+     * @brief Takes a free item, waits while there isn't any.
+     * Complexity: O(1)
+     * @return Value of item, to be written and passed to pushBack() or release().
+     */
+    T* allocate()
+    {
+        return allocate(nullptr);
+    }
+
+    /**
+     * @brief Takes a free item, waits at most given time while there isn't any.
+     * Complexity: O(1)
+     * @param aTimeout Longest wait, zero for no wait.
+     * @return Value of item, to be written and passed to pushBack() or release(). Null on timeout.
+     */
+    T* allocate(const std::chrono::nanoseconds aTimeout)
+    {
+        const timespec deadline = deadlineAfter(aTimeout);
+        return allocate(&deadline);
+    }
+
+    /**
+     * @brief Queues allocated item at the end of list. The item no longer belongs to the process.
+     * Complexity: O(1)
+     * @param aValue Value from allocate() of this process.
+     * @throw std::invalid_argument if the value isn't an item allocated by this process.
+     */
+    void pushBack(T* aValue)
+    {
+        CLock lock(*this);
+        const uint64_t index = indexOf(aValue);
+        if (mItems[index].mLinks.mState != DoublyLinkedListShared::cAllocated)
+        {
+            throw std::invalid_argument("Item of shared list is not allocated");
+        }
+        linkBack(index);
+        ::pthread_cond_signal(&mHeader->mNotEmpty);
+    }
+
+    /**
+     * @brief Copies value to a free item and queues it at the end of list. Waits while there isn't a free item.
+     * Complexity: O(1)
+     * @param aValue Value.
+     */
+    void pushBack(const T& aValue)
+    {
+        T* value = allocate();
+        *value = aValue;
+        pushBack(value);
+    }
+
+    /**
+     * @brief Takes the first item from the list, waits while the list is empty.
+     * Complexity: O(1)
+     * @return Value of item, belongs to the process until release().
+     */
+    T* popFront()
+    {
+        return popFront(nullptr);
+    }
+
+    /**
+     * @brief Takes the first item from the list, waits at most given time while the list is empty.
+     * Complexity: O(1)
+     * @param aTimeout Longest wait, zero for no wait.
+     * @return Value of item, belongs to the process until release(). Null on timeout.
+     */
+    T* popFront(const std::chrono::nanoseconds aTimeout)
+    {
+        const timespec deadline = deadlineAfter(aTimeout);
+        return popFront(&deadline);
+    }
+
+    /**
+     * @brief Returns popped or allocated item to the free items.
+     * Complexity: O(1)
+     * @param aValue Value from popFront() or allocate() of this process.
+     * @throw std::invalid_argument if the value isn't an item held by this process.
+     */
+    void release(T* aValue)
+    {
+        CLock lock(*this);
+        putFree(indexOf(aValue));
+        ::pthread_cond_signal(&mHeader->mNotFull);
+    }
+
+    /**
+     * @brief Frees items allocated by processes which no longer exist, and queues items they have popped
+     * at the front again.
+     * Complexity: O(capacity) if a process which held items is gone, otherwise O(1) - the registry of owners is checked.
+     * @return Number of reclaimed items.
+     */
+    uintmax_t reclaim()
+    {
+        CLock lock(*this);
+        return reclaimDeadOwners();
+    }
+
+private:
+
+    /**
+     * @brief Holds the mutex of list, recovers the list if the previous holder died.
+     */
+    class CLock
+    {
+    public:
+        explicit CLock(const CSharedDoublyLinkedList& aList)
+            : mList(aList)
+        {
+            mList.lock();
+        }
+
+        ~CLock()
+        {
+            ::pthread_mutex_unlock(&mList.mHeader->mMutex);
+        }
+
+        CLock(const CLock&) = delete;
+        CLock& operator=(const CLock&) = delete;
+
+    private:
+        const CSharedDoublyLinkedList& mList;
+    };
+
+    /**
+     * @brief Descriptor of the shared memory.
+     */
+    int mFd;
+
+    /**
+     * @brief Mapping of the shared memory and its size.
+     */
+    void* mMapping;
+    uint64_t mMappingSize;
+
+    /**
+     * @brief Header and item array in the mapping.
+     */
+    Header* mHeader;
+    Item* mItems;
+
+    /**
+     * @brief This process, owner of items it holds.
+     */
+    int32_t mPid;
+
+    /**
+     * @brief Slot of the registry where this process was found last, checked first.
+     */
+    mutable uint32_t mSlot;
+
+    /**
+     * @brief Returns size of shared memory with given number of items.
+     */
+    static uint64_t memorySize(const uint64_t aCapacity)
+    {
+        return sizeof(Header) + aCapacity * sizeof(Item);
+    }
+
+    /**
+     * @brief Throws std::runtime_error with message and description of error number.
+     */
+    [[noreturn]] static void throwError(const std::string& aMessage, const int aError)
+    {
+        throw std::runtime_error(aMessage + ": " + std::strerror(aError));
+    }
+
+    /**
+     * @brief Returns time of monotonic clock after given timeout.
+     */
+    static timespec deadlineAfter(const std::chrono::nanoseconds aTimeout)
+    {
+        timespec deadline;
+        ::clock_gettime(CLOCK_MONOTONIC, &deadline);
+        const long long nanoseconds = deadline.tv_nsec + aTimeout.count() % 1000000000;
+        deadline.tv_sec += static_cast<time_t>(aTimeout.count() / 1000000000 + nanoseconds / 1000000000);
+        deadline.tv_nsec = static_cast<long>(nanoseconds % 1000000000);
+        return deadline;
+    }
+
+    /**
+     * @brief Indicates if the first time is earlier than the second one.
+     */
+    static bool earlier(const timespec& aFirst, const timespec& aSecond)
+    {
+        return (aFirst.tv_sec < aSecond.tv_sec) || ((aFirst.tv_sec == aSecond.tv_sec) && (aFirst.tv_nsec < aSecond.tv_nsec));
+    }
+
+    /**
+     * @brief Indicates if process exists. A zombie process still exists.
+     */
+    static bool isAlive(const int32_t aPid)
+    {
+        return (::kill(aPid, 0) == 0) || (errno != ESRCH);
+    }
+
+    /**
+     * @brief Maps given size of the shared memory.
+     */
+    void map(const uint64_t aSize)
+    {
+        void* mapping = ::mmap(nullptr, aSize, PROT_READ | PROT_WRITE, MAP_SHARED, mFd, 0);
+        if (mapping == MAP_FAILED)
+        {
+            throwError("Mapping of shared list failed", errno);
+        }
+        mMapping = mapping;
+        mMappingSize = aSize;
+        mHeader = static_cast<Header*>(mapping);
+        mItems = reinterpret_cast<Item*>(static_cast<char*>(mapping) + sizeof(Header));
+    }
+
+    /**
+     * @brief Unmaps the shared memory if it is mapped.
+     */
+    void unmap() noexcept
+    {
+        if (mMapping != nullptr)
+        {
+            ::munmap(mMapping, mMappingSize);
+            mMapping = nullptr;
+            mHeader = nullptr;
+            mItems = nullptr;
+        }
+    }
+
+    /**
+     * @brief Indicates if the shared memory holds an initialized header. The initialization lock has to be held.
+     */
+    bool initialized()
+    {
+        struct stat status;
+        if (::fstat(mFd, &status) != 0)
+        {
+            throwError("Reading size of shared list failed", errno);
+        }
+        if (static_cast<uint64_t>(status.st_size) < sizeof(Header))
+        {
+            return false;
+        }
+        map(sizeof(Header));
+        const bool ready = (mHeader->mReady.load(std::memory_order_acquire) != 0u);
+        unmap();
+        return ready;
+    }
+
+    /**
+     * @brief Sizes and initializes shared memory, all items are free. Content left by a creator
+     * which died is cleared. The initialization lock has to be held.
+     */
+    void create(const uint64_t aCapacity)
+    {
+        for (const uint64_t size : {uint64_t(0), memorySize(aCapacity)})
+        {
+            while (::ftruncate(mFd, static_cast<off_t>(size)) != 0)
+            {
+                if (errno != EINTR)
+                {
+                    throwError("Sizing of shared list failed", errno);
+                }
+            }
+        }
+        map(memorySize(aCapacity));
+        std::memcpy(mHeader->mMagic, DoublyLinkedListShared::cMagic, sizeof(DoublyLinkedListShared::cMagic));
+        mHeader->mVersion = DoublyLinkedListShared::cVersion;
+        mHeader->mValueSize = sizeof(T);
+        mHeader->mValueAlign = alignof(T);
+        mHeader->mCapacity = aCapacity;
+
+        pthread_mutexattr_t mutexAttributes;
+        ::pthread_mutexattr_init(&mutexAttributes);
+        ::pthread_mutexattr_setpshared(&mutexAttributes, PTHREAD_PROCESS_SHARED);
+        ::pthread_mutexattr_setrobust(&mutexAttributes, PTHREAD_MUTEX_ROBUST);
+        const int mutexResult = ::pthread_mutex_init(&mHeader->mMutex, &mutexAttributes);
+        ::pthread_mutexattr_destroy(&mutexAttributes);
+        if (mutexResult != 0)
+        {
+            throwError("Initialization of shared list mutex failed", mutexResult);
+        }
+        pthread_condattr_t conditionAttributes;
+        ::pthread_condattr_init(&conditionAttributes);
+        ::pthread_condattr_setpshared(&conditionAttributes, PTHREAD_PROCESS_SHARED);
+        ::pthread_condattr_setclock(&conditionAttributes, CLOCK_MONOTONIC);
+        ::pthread_cond_init(&mHeader->mNotEmpty, &conditionAttributes);
+        ::pthread_cond_init(&mHeader->mNotFull, &conditionAttributes);
+        ::pthread_condattr_destroy(&conditionAttributes);
+
+        mHeader->mState = {cNull, cNull, 0u, 0u};
+        mHeader->mJournal.mActive = 0u;
+        for (DoublyLinkedListShared::COwner& owner : mHeader->mOwners)
+        {
+            owner = {0, 0u, 0u};
+        }
+        for (uint64_t index = 0; index < aCapacity; ++index)
+        {
+            mItems[index].mLinks = {cNull, (index + 1u < aCapacity) ? index + 1u : cNull, DoublyLinkedListShared::cFree, 0,
+                                    DoublyLinkedListShared::cNoSlot, 0u};
+        }
+        mHeader->mReady.store(1u, std::memory_order_release);
+    }
+
+    /**
+     * @brief Maps initialized shared memory and checks it. The initialization lock has to be held.
+     */
+    void open(const std::string& aName)
+    {
+        map(sizeof(Header));
+        if ((std::memcmp(mHeader->mMagic, DoublyLinkedListShared::cMagic, sizeof(DoublyLinkedListShared::cMagic)) != 0)
+            || (mHeader->mVersion != DoublyLinkedListShared::cVersion))
+        {
+            throw std::runtime_error("Shared memory " + aName + " doesn't hold a list of this version");
+        }
+        if ((mHeader->mValueSize != sizeof(T)) || (mHeader->mValueAlign != alignof(T)))
+        {
+            throw std::runtime_error("Shared list " + aName + " holds values of other type");
+        }
+        const uint64_t size = memorySize(mHeader->mCapacity);
+        struct stat status;
+        if ((::fstat(mFd, &status) != 0) || (static_cast<uint64_t>(status.st_size) < size))
+        {
+            throw std::runtime_error("Shared list " + aName + " is truncated");
+        }
+        unmap();
+        map(size);
+    }
+
+    /**
+     * @brief Locks the mutex, recovers the list if the previous holder died.
+     */
+    void lock() const
+    {
+        const int result = ::pthread_mutex_lock(&mHeader->mMutex);
+        if (result == EOWNERDEAD)
+        {
+            makeConsistent();
+        }
+        else if (result != 0)
+        {
+            throwError("Locking of shared list failed", result);
+        }
+    }
+
+    /**
+     * @brief Rolls back change of dead holder of the mutex, reclaims its items and marks the mutex usable.
+     */
+    void makeConsistent() const
+    {
+        DoublyLinkedListShared::CJournal& journal = mHeader->mJournal;
+        if (journal.mActive != 0u)
+        {
+            mHeader->mState = journal.mState;
+            for (unsigned int i = 0; i < 2u; ++i)
+            {
+                if (journal.mIndices[i] != cNull)
+                {
+                    mItems[journal.mIndices[i]].mLinks = journal.mLinks[i];
+                }
+            }
+            if (journal.mOwnerSlot != DoublyLinkedListShared::cNoSlot)
+            {
+                mHeader->mOwners[journal.mOwnerSlot] = journal.mOwner;
+            }
+            journal.mActive = 0u;
+        }
+        reclaimDeadOwners();
+        ::pthread_mutex_consistent(&mHeader->mMutex);
+    }
+
+    /**
+     * @brief Waits on condition until predicate holds or deadline passes. The mutex has to be held.
+     * Looks for items of dead processes every cReclaimInterval.
+     * @return Value of predicate.
+     */
+    template<typename TPredicate>
+    bool wait(pthread_cond_t& aCondition, TPredicate aReady, const timespec* aDeadline) const
+    {
+        while (!aReady())
+        {
+            timespec wakeup = deadlineAfter(cReclaimInterval);
+            if ((aDeadline != nullptr) && earlier(*aDeadline, wakeup))
+            {
+                wakeup = *aDeadline;
+            }
+            const int result = ::pthread_cond_timedwait(&aCondition, &mHeader->mMutex, &wakeup);
+            if (result == EOWNERDEAD)
+            {
+                makeConsistent();
+            }
+            else if (result == ETIMEDOUT)
+            {
+                if ((aDeadline != nullptr) && !earlier(deadlineAfter(std::chrono::nanoseconds(0)), *aDeadline))
+                {
+                    return aReady();
+                }
+                reclaimDeadOwners();
+            }
+            else if (result != 0)
+            {
+                throwError("Waiting on shared list failed", result);
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Takes a free item, waits until deadline while there isn't any.
+     */
+    T* allocate(const timespec* aDeadline)
+    {
+        CLock lock(*this);
+        if (!wait(mHeader->mNotFull, [this]() { return mHeader->mState.mFirstFree != cNull; }, aDeadline))
+        {
+            return nullptr;
+        }
+        return &mItems[takeFree()].mValue;
+    }
+
+    /**
+     * @brief Takes the first item, waits until deadline while the list is empty.
+     */
+    T* popFront(const timespec* aDeadline)
+    {
+        CLock lock(*this);
+        if (!wait(mHeader->mNotEmpty, [this]() { return mHeader->mState.mBegin != cNull; }, aDeadline))
+        {
+            return nullptr;
+        }
+        return &mItems[unlinkFront()].mValue;
+    }
+
+    /**
+     * @brief Returns index of item held by this process.
+     * @throw std::invalid_argument if the value isn't an item held by this process.
+     */
+    uint64_t indexOf(const T* aValue) const
+    {
+        const uintptr_t first = reinterpret_cast<uintptr_t>(&mItems[0].mValue);
+        const uintptr_t value = reinterpret_cast<uintptr_t>(aValue);
+        if ((value < first) || ((value - first) % sizeof(Item) != 0u) || ((value - first) / sizeof(Item) >= mHeader->mCapacity))
+        {
+            throw std::invalid_argument("Value is not an item of the shared list");
+        }
+        const uint64_t index = (value - first) / sizeof(Item);
+        const Links& links = mItems[index].mLinks;
+        if ((links.mOwner != mPid)
+            || ((links.mState != DoublyLinkedListShared::cAllocated) && (links.mState != DoublyLinkedListShared::cPopped)))
+        {
+            throw std::invalid_argument("Item of shared list is not held by this process");
+        }
+        return index;
+    }
+
+    /**
+     * @brief Saves state, links of given items and given slot of the registry to the journal before a change.
+     */
+    void beginChange(const uint64_t aFirst, const uint64_t aSecond, const uint32_t aSlot) const
+    {
+        DoublyLinkedListShared::CJournal& journal = mHeader->mJournal;
+        journal.mState = mHeader->mState;
+        journal.mIndices[0] = aFirst;
+        journal.mIndices[1] = aSecond;
+        if (aFirst != cNull)
+        {
+            journal.mLinks[0] = mItems[aFirst].mLinks;
+        }
+        if (aSecond != cNull)
+        {
+            journal.mLinks[1] = mItems[aSecond].mLinks;
+        }
+        journal.mOwnerSlot = aSlot;
+        if (aSlot != DoublyLinkedListShared::cNoSlot)
+        {
+            journal.mOwner = mHeader->mOwners[aSlot];
+        }
+        // stores of a dead process stay in memory, only their order in program matters
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        journal.mActive = 1u;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+    }
+
+    /**
+     * @brief Marks the change as complete.
+     */
+    void endChange() const
+    {
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        mHeader->mJournal.mActive = 0u;
+    }
+
+    /**
+     * @brief Returns slot of the registry for this process: its own slot, a free one or cOverflow.
+     * A free slot isn't taken until a change counts an item in it.
+     */
+    uint32_t ownSlot() const
+    {
+        const DoublyLinkedListShared::COwner* owners = mHeader->mOwners;
+        if ((owners[mSlot].mHeld != 0u) && (owners[mSlot].mPid == mPid))
+        {
+            return mSlot;
+        }
+        uint32_t free = DoublyLinkedListShared::cOverflow;
+        for (uint32_t slot = 0; slot < DoublyLinkedListShared::cMaxOwners; ++slot)
+        {
+            if (owners[slot].mHeld == 0u)
+            {
+                if (free == DoublyLinkedListShared::cOverflow)
+                {
+                    free = slot;
+                }
+            }
+            else if (owners[slot].mPid == mPid)
+            {
+                mSlot = slot;
+                return slot;
+            }
+        }
+        if (free != DoublyLinkedListShared::cOverflow)
+        {
+            mSlot = free;
+        }
+        return free;
+    }
+
+    /**
+     * @brief Counts item taken by this process in given slot. Part of a change.
+     */
+    void hold(const uint64_t aIndex, const uint32_t aSlot, const uint32_t aState) const
+    {
+        DoublyLinkedListShared::COwner& owner = mHeader->mOwners[aSlot];
+        if (aSlot != DoublyLinkedListShared::cOverflow)
+        {
+            owner.mPid = mPid;
+        }
+        owner.mHeld++;
+        mItems[aIndex].mLinks = {cNull, cNull, aState, mPid, aSlot, 0u};
+    }
+
+    /**
+     * @brief Takes the first free item for this process. There has to be one.
+     */
+    uint64_t takeFree() const
+    {
+        const uint64_t index = mHeader->mState.mFirstFree;
+        const uint32_t slot = ownSlot();
+        beginChange(index, cNull, slot);
+        mHeader->mState.mFirstFree = mItems[index].mLinks.mNext;
+        hold(index, slot, DoublyLinkedListShared::cAllocated);
+        endChange();
+        return index;
+    }
+
+    /**
+     * @brief Puts held item to the free items.
+     */
+    void putFree(const uint64_t aIndex) const
+    {
+        const uint32_t slot = mItems[aIndex].mLinks.mOwnerSlot;
+        beginChange(aIndex, cNull, slot);
+        mHeader->mOwners[slot].mHeld--;
+        mItems[aIndex].mLinks = {cNull, mHeader->mState.mFirstFree, DoublyLinkedListShared::cFree, 0,
+                                 DoublyLinkedListShared::cNoSlot, 0u};
+        mHeader->mState.mFirstFree = aIndex;
+        endChange();
+    }
+
+    /**
+     * @brief Queues held item at the end of list.
+     */
+    void linkBack(const uint64_t aIndex) const
+    {
+        const uint64_t tail = mHeader->mState.mTail;
+        const uint32_t slot = mItems[aIndex].mLinks.mOwnerSlot;
+        beginChange(aIndex, tail, slot);
+        mHeader->mOwners[slot].mHeld--;
+        mItems[aIndex].mLinks = {tail, cNull, DoublyLinkedListShared::cQueued, 0, DoublyLinkedListShared::cNoSlot, 0u};
+        if (tail != cNull)
+        {
+            mItems[tail].mLinks.mNext = aIndex;
+        }
+        else
+        {
+            mHeader->mState.mBegin = aIndex;
+        }
+        mHeader->mState.mTail = aIndex;
+        mHeader->mState.mSize++;
+        endChange();
+    }
+
+    /**
+     * @brief Queues held item at the beginning of list.
+     */
+    void linkFront(const uint64_t aIndex) const
+    {
+        const uint64_t begin = mHeader->mState.mBegin;
+        const uint32_t slot = mItems[aIndex].mLinks.mOwnerSlot;
+        beginChange(aIndex, begin, slot);
+        mHeader->mOwners[slot].mHeld--;
+        mItems[aIndex].mLinks = {cNull, begin, DoublyLinkedListShared::cQueued, 0, DoublyLinkedListShared::cNoSlot, 0u};
+        if (begin != cNull)
+        {
+            mItems[begin].mLinks.mPrevious = aIndex;
+        }
+        else
+        {
+            mHeader->mState.mTail = aIndex;
+        }
+        mHeader->mState.mBegin = aIndex;
+        mHeader->mState.mSize++;
+        endChange();
+    }
+
+    /**
+     * @brief Takes the first item of list for this process. The list mustn't be empty.
+     */
+    uint64_t unlinkFront() const
+    {
+        const uint64_t index = mHeader->mState.mBegin;
+        const uint64_t next = mItems[index].mLinks.mNext;
+        const uint32_t slot = ownSlot();
+        beginChange(index, next, slot);
+        mHeader->mState.mBegin = next;
+        if (next != cNull)
+        {
+            mItems[next].mLinks.mPrevious = cNull;
+        }
+        else
+        {
+            mHeader->mState.mTail = cNull;
+        }
+        mHeader->mState.mSize--;
+        hold(index, slot, DoublyLinkedListShared::cPopped);
+        endChange();
+        return index;
+    }
+
+    /**
+     * @brief Frees allocated items of dead processes and queues their popped items at the front.
+     * Items are looked through only if a registered process is gone or items of unknown owners are held.
+     * The mutex has to be held.
+     * @return Number of reclaimed items.
+     */
+    uintmax_t reclaimDeadOwners() const
+    {
+        const DoublyLinkedListShared::COwner* owners = mHeader->mOwners;
+        bool dead[DoublyLinkedListShared::cMaxOwners] = {};
+        bool scan = (owners[DoublyLinkedListShared::cOverflow].mHeld != 0u);
+        for (uint32_t slot = 0; slot < DoublyLinkedListShared::cMaxOwners; ++slot)
+        {
+            if ((owners[slot].mHeld != 0u) && (owners[slot].mPid != mPid) && !isAlive(owners[slot].mPid))
+            {
+                dead[slot] = true;
+                scan = true;
+            }
+        }
+        if (!scan)
+        {
+            return 0u;
+        }
+
+        uintmax_t reclaimed = 0;
+        // popped items are queued at the front in reverse, so the one taken from the lowest index is first
+        for (uint64_t index = mHeader->mCapacity; index-- > 0u;)
+        {
+            const Links& links = mItems[index].mLinks;
+            if (((links.mState == DoublyLinkedListShared::cAllocated) || (links.mState == DoublyLinkedListShared::cPopped))
+                && ((links.mOwnerSlot == DoublyLinkedListShared::cOverflow)
+                    ? ((links.mOwner != mPid) && !isAlive(links.mOwner))
+                    : dead[links.mOwnerSlot]))
+            {
+                if (links.mState == DoublyLinkedListShared::cPopped)
+                {
+                    linkFront(index);
+                }
+                else
+                {
+                    putFree(index);
+                }
+                reclaimed++;
+            }
+        }
+        if (reclaimed != 0u)
+        {
+            ::pthread_cond_broadcast(&mHeader->mNotEmpty);
+            ::pthread_cond_broadcast(&mHeader->mNotFull);
+        }
+        return reclaimed;
+    }
+};
+
+#endif
@@ -0,0 +1,1113 @@
+#ifndef CPP_SKIP_DOUBLY_LINKED_LIST_HPP_
+#define CPP_SKIP_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "CppDoublyLinkedListPool.hpp"
+
+/**
+ * @brief Doubly Linked List with an indexable skip list layer. Some items carry a tower of express links,
+ * every express link stores its span - the number of items it skips. Positional access descends
+ * the express lanes, so get, insert and eraseAt take O(log n) expected time,
+ * pushBack takes O(1) expected time and pushFront O(height of the skip list).
+ * It has the sequence interface of CDoublyLinkedList: pushes and emplaces at both ends, pops, get, insert,
+ * eraseAt, contains, forward and reverse iteration, copy and move. Lookup policies, splice, sort and merge
+ * of CDoublyLinkedList are not offered, they would have to rebuild the express lanes.
+ * @tparam T Type of items.
+ * @tparam TAllocator Allocator of items.
+ */
+template<typename T, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+class CSkipDoublyLinkedList
+{
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+    class CSkipDoublyLinkedListItem;
+
+    /**
+     * @brief Express link of a tower.
+     */
+    struct CSkipLink
+    {
+        /**
+         * @brief Next item which has a link at the same level, null at the end of the lane.
+         */
+        CSkipDoublyLinkedListItem* mNext;
+
+        /**
+         * @brief Number of level-0 steps to mNext. Meaningless if mNext is null.
+         */
+        uintmax_t mSpan;
+    };
+
+    /**
+     * @brief List item. Holds value, level-0 links and optional tower of express links.
+     */
+    class CSkipDoublyLinkedListItem
+    {
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        template<typename... TArgs>
+        explicit CSkipDoublyLinkedListItem(TArgs&&... aArgs)
+            : mPrevious(nullptr)
+            , mNext(nullptr)
+            , mLinks(nullptr)
+            , mHeight(0)
+            , mValue(std::forward<TArgs>(aArgs)...)
+        {}
+
+        /**
+         * @brief Pointer to previous Item.
+         */
+        CSkipDoublyLinkedListItem* mPrevious;
+
+        /**
+         * @brief Pointer to next item.
+         */
+        CSkipDoublyLinkedListItem* mNext;
+
+        /**
+         * @brief Express links for levels 1..mHeight, null if the item has no tower.
+         */
+        CSkipLink* mLinks;
+
+        /**
+         * @brief Height of tower.
+         */
+        std::size_t mHeight;
+
+        /**
+         * @brief Value.
+         */
+        T mValue;
+    };
+
+    using Item = CSkipDoublyLinkedListItem;
+
+    /**
+     * @brief Maximal height of towers. With promotion probability 1/4 it is enough for 4^16 items.
+     */
+    static const std::size_t cMaxLevel = 16u;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for SkipDoublyLinked container. Moves along level-0 links.
+     */
+    class CSkipDoublyLinkedListIterator
+    {
+        /**
+         * @brief Pointer to data.
+         */
+        const Item* mPtr;
+
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        explicit CSkipDoublyLinkedListIterator(const Item* aPtr)
+            : mPtr(aPtr)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        CSkipDoublyLinkedListIterator& operator ++()
+        {
+            mPtr = mPtr->mNext;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CSkipDoublyLinkedListIterator operator ++(int)
+        {
+            CSkipDoublyLinkedListIterator it(mPtr);
+            mPtr = mPtr->mNext;
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement
+         */
+        CSkipDoublyLinkedListIterator& operator --()
+        {
+            mPtr = mPtr->mPrevious;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CSkipDoublyLinkedListIterator operator --(int)
+        {
+            CSkipDoublyLinkedListIterator it(mPtr);
+            mPtr = mPtr->mPrevious;
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return mPtr->mValue;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &(mPtr->mValue);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CSkipDoublyLinkedListIterator& alt)const
+        {
+            return (mPtr == alt.mPtr);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CSkipDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return mPtr->mValue;
+        }
+    };
+
+    /**
+     * @brief Reverse iterator for SkipDoublyLinked container. Moves along level-0 links from the end.
+     */
+    class CReverseSkipDoublyLinkedListIterator
+    {
+        /**
+         * @brief Pointer to data.
+         */
+        const Item* mPtr;
+
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        explicit CReverseSkipDoublyLinkedListIterator(const Item* aPtr)
+            : mPtr(aPtr)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        CReverseSkipDoublyLinkedListIterator& operator ++()
+        {
+            mPtr = mPtr->mPrevious;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CReverseSkipDoublyLinkedListIterator operator ++(int)
+        {
+            CReverseSkipDoublyLinkedListIterator it(mPtr);
+            mPtr = mPtr->mPrevious;
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement
+         */
+        CReverseSkipDoublyLinkedListIterator& operator --()
+        {
+            mPtr = mPtr->mNext;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CReverseSkipDoublyLinkedListIterator operator --(int)
+        {
+            CReverseSkipDoublyLinkedListIterator it(mPtr);
+            mPtr = mPtr->mNext;
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return mPtr->mValue;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &(mPtr->mValue);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CReverseSkipDoublyLinkedListIterator& alt)const
+        {
+            return (mPtr == alt.mPtr);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CReverseSkipDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return mPtr->mValue;
+        }
+    };
+
+    using DIterator = CSkipDoublyLinkedListIterator;
+    using DReverseIterator = CReverseSkipDoublyLinkedListIterator;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CSkipDoublyLinkedList()
+        : CSkipDoublyLinkedList(TAllocator())
+    {}
+
+    explicit CSkipDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+        , mLinkAllocator(aAllocator)
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+        , mLevel(0)
+        , mRandom(0x9E3779B97F4A7C15ull)
+    {
+        IniEmptyList();
+    }
+
+    CSkipDoublyLinkedList(const CSkipDoublyLinkedList& aObj)
+        : CSkipDoublyLinkedList(TAllocator(ItemTraits::select_on_container_copy_construction(aObj.mAllocator)))
+    {
+        for (const Item* item = aObj.mBegin; item != nullptr; item = item->mNext)
+        {
+            pushBack(item->mValue);
+        }
+    }
+
+    /**
+     * @brief Move constructor. Takes over items and express lanes of the other list.
+     * Complexity: O(height of the skip list)
+     */
+    CSkipDoublyLinkedList(CSkipDoublyLinkedList&& aObj) noexcept
+        : mAllocator(std::move(aObj.mAllocator))
+        , mLinkAllocator(std::move(aObj.mLinkAllocator))
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+        , mLevel(0)
+        , mRandom(aObj.mRandom)
+    {
+        IniEmptyList();
+        takeItems(aObj);
+    }
+
+    ~CSkipDoublyLinkedList()
+    {
+        ClearList();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CSkipDoublyLinkedList& operator=(const CSkipDoublyLinkedList& aObj)
+    {
+        if (this != &aObj)
+        {
+            ClearList();
+            for (const Item* item = aObj.mBegin; item != nullptr; item = item->mNext)
+            {
+                pushBack(item->mValue);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Move assignment. Takes over items of the other list.
+     * Complexity: O(n) to clear this list, plus O(height of the skip list) if allocator propagates
+     * or both allocators are equal, otherwise O(m) - values are moved into items allocated by this list.
+     */
+    CSkipDoublyLinkedList& operator=(CSkipDoublyLinkedList&& aObj)
+        noexcept(ItemTraits::propagate_on_container_move_assignment::value || ItemTraits::is_always_equal::value)
+    {
+        if (this == &aObj)
+        {
+            return *this;
+        }
+
+        ClearList();
+        if constexpr (ItemTraits::propagate_on_container_move_assignment::value)
+        {
+            mAllocator = std::move(aObj.mAllocator);
+            mLinkAllocator = std::move(aObj.mLinkAllocator);
+        }
+        else if ((mAllocator != aObj.mAllocator) || (mLinkAllocator != aObj.mLinkAllocator))
+        {
+            for (Item* item = aObj.mBegin; item != nullptr; item = item->mNext)
+            {
+                emplaceBack(std::move(item->mValue));
+            }
+            aObj.ClearList();
+            return *this;
+        }
+        takeItems(aObj);
+        return *this;
+    }
+
+    /**
+     * @brief Compares lists
+     */
+    bool operator==(const CSkipDoublyLinkedList& aObj) const
+    {
+        if (mSize != aObj.mSize)
+        {
+            return false;
+        }
+        for (const Item *thisItem = mBegin, *aObjItem = aObj.mBegin; thisItem != nullptr;
+             thisItem = thisItem->mNext, aObjItem = aObjItem->mNext)
+        {
+            if (thisItem->mValue != aObjItem->mValue)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compare operator
+     */
+    bool operator!=(const CSkipDoublyLinkedList& aObj) const
+    {
+        return !(*this == aObj);
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1) expected - only the lanes of the new tower are touched.
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        emplaceBack(aValue);
+    }
+
+    /**
+     * @brief Adds value to list, the value is moved into the new item.
+     * Complexity: O(1) expected
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value at the end of list from given arguments.
+     * Complexity: O(1) expected - only the lanes of the new tower are touched.
+     * @param aArgs Arguments of the constructor of T.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceBack(TArgs&&... aArgs)
+    {
+        Item* item = createItem(std::forward<TArgs>(aArgs)...);
+        const uintmax_t position = mSize + 1u;
+
+        item->mPrevious = mTail;
+        if (mTail != nullptr)
+        {
+            mTail->mNext = item;
+        }
+        else
+        {
+            mBegin = item;
+        }
+        mTail = item;
+        mSize++;
+
+        raiseLevel(item->mHeight);
+        for (std::size_t level = 1; level <= item->mHeight; level++)
+        {
+            item->mLinks[level - 1u].mNext = nullptr;
+            item->mLinks[level - 1u].mSpan = 0;
+
+            CSkipLink& lastLink = link(mLast[level], level);
+            lastLink.mNext = item;
+            lastLink.mSpan = position - mLastPosition[level];
+            mLast[level] = item;
+            mLastPosition[level] = position;
+        }
+        return item->mValue;
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(height of the skip list) - spans of the head lanes grow.
+     * @param aValue Value.
+     */
+    void pushFront(const T& aValue)
+    {
+        emplaceFront(aValue);
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list, the value is moved into the item.
+     * Complexity: O(height of the skip list)
+     * @param aValue Value.
+     */
+    void pushFront(T&& aValue)
+    {
+        emplaceFront(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value at the beginning of list from given arguments.
+     * Complexity: O(height of the skip list) - spans of the head lanes grow.
+     * @param aArgs Arguments of the constructor of T.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceFront(TArgs&&... aArgs)
+    {
+        return insertAt(0, std::forward<TArgs>(aArgs)...);
+    }
+
+    /**
+     * @brief Removes last item from list.
+     * Complexity: O(log n) expected - predecessors of the tower are searched.
+     * @return Last item from list.
+     */
+    T popBack()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return eraseAt(mSize - 1u);
+    }
+
+    /**
+     * @brief Remove the first element from the list.
+     * Complexity: O(height of the skip list)
+     * @return The first item from list.
+     */
+    T popFront()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return eraseAt(0);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        for (const Item* item = mBegin; item != nullptr; item = item->mNext)
+        {
+            if (item->mValue == aValue)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get pointer to the value at given position.
+     * Complexity: O(log n) expected
+     * @param aIndex Position of value.
+     * @return Pointer to value or null if there isn't value at given position.
+     */
+    const T* get(const uintmax_t aIndex) const
+    {
+        if (aIndex >= mSize)
+        {
+            return nullptr;
+        }
+
+        const uintmax_t target = aIndex + 1u;
+        Item* item = nullptr;
+        uintmax_t position = 0;
+        for (std::size_t level = mLevel; level > 0; level--)
+        {
+            const CSkipLink* next = &link(item, level);
+            while ((next->mNext != nullptr) && (position + next->mSpan <= target))
+            {
+                position += next->mSpan;
+                item = next->mNext;
+                next = &link(item, level);
+            }
+        }
+        return &(walk(item, target - position)->mValue);
+    }
+
+    /**
+     * @brief Inserts value at given position.
+     * Complexity: O(log n) expected
+     * @param aIndex Position of value. Must be lower than size, 0 inserts also into an empty list.
+     * @param aValue Value to insert.
+     */
+    void insert(const uintmax_t aIndex, const T& aValue)
+    {
+        if ((aIndex == 0) || (aIndex < mSize))
+        {
+            insertAt(aIndex, aValue);
+        }
+    }
+
+    /**
+     * @brief Inserts value at given position, the value is moved into the new item.
+     * Complexity: O(log n) expected
+     * @param aIndex Position of value. Must be lower than size, 0 inserts also into an empty list.
+     * @param aValue Value to insert.
+     */
+    void insert(const uintmax_t aIndex, T&& aValue)
+    {
+        if ((aIndex == 0) || (aIndex < mSize))
+        {
+            insertAt(aIndex, std::move(aValue));
+        }
+    }
+
+    /**
+     * @brief Removes value at given position.
+     * Complexity: O(log n) expected
+     * @param aIndex Position of value. Must be lower than size.
+     * @return Removed value.
+     */
+    T eraseAt(const uintmax_t aIndex)
+    {
+        if (aIndex >= mSize)
+        {
+            throw std::out_of_range("Try to delete item out of List");
+        }
+
+        const uintmax_t target = aIndex + 1u;
+        Item* update[cMaxLevel + 1u];
+        uintmax_t rank[cMaxLevel + 1u];
+        findPredecessors(target, update, rank);
+
+        Item* item = walk(update[1], target - rank[1]);
+
+        for (std::size_t level = 1; level <= mLevel; level++)
+        {
+            CSkipLink& previousLink = link(update[level], level);
+            if (level <= item->mHeight)
+            {
+                CSkipLink& itemLink = item->mLinks[level - 1u];
+                previousLink.mNext = itemLink.mNext;
+                previousLink.mSpan += itemLink.mSpan - 1u;
+                if (mLast[level] == item)
+                {
+                    mLast[level] = update[level];
+                    mLastPosition[level] = rank[level];
+                }
+                else
+                {
+                    mLastPosition[level]--;
+                }
+            }
+            else
+            {
+                if (previousLink.mNext != nullptr)
+                {
+                    previousLink.mSpan--;
+                }
+                if (mLastPosition[level] > target)
+                {
+                    mLastPosition[level]--;
+                }
+            }
+        }
+        while ((mLevel > 0) && (mHead[mLevel - 1u].mNext == nullptr))
+        {
+            mLast[mLevel] = nullptr;
+            mLastPosition[mLevel] = 0;
+            mLevel--;
+        }
+
+        if (item->mPrevious != nullptr)
+        {
+            item->mPrevious->mNext = item->mNext;
+        }
+        else
+        {
+            mBegin = item->mNext;
+        }
+        if (item->mNext != nullptr)
+        {
+            item->mNext->mPrevious = item->mPrevious;
+        }
+        else
+        {
+            mTail = item->mPrevious;
+        }
+        mSize--;
+
+        T returnItem = std::move(item->mValue);
+        destroyItem(item);
+        return returnItem;
+    }
+
+    /**
+     * @brief Returns an iterator that points to the beginning.
+     * @return Iterator to the beginning.
+     */
+    DIterator begin() const
+    {
+        return DIterator(mBegin);
+    }
+
+    /**
+     * @brief Returns an iterator that points to the item after the last one.
+     * @return Iterator to the item after the last one.
+     */
+    DIterator end() const
+    {
+        return DIterator(nullptr);
+    }
+
+    /**
+     * @brief Returns a reverse iterator that points to the last item.
+     * @return Reverse iterator to the last item.
+     */
+    DReverseIterator rbegin() const
+    {
+        return DReverseIterator(mTail);
+    }
+
+    /**
+     * @brief Returns a reverse iterator that points before the first item.
+     * @return Reverse iterator before the first item.
+     */
+    DReverseIterator rend() const
+    {
+        return DReverseIterator(nullptr);
+    }
+
+private:
+
+    using ItemAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Item>;
+    using ItemTraits = std::allocator_traits<ItemAllocator>;
+    using LinkAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<CSkipLink>;
+    using LinkTraits = std::allocator_traits<LinkAllocator>;
+
+    /**
+     * @brief Allocator of items.
+     */
+    ItemAllocator mAllocator;
+
+    /**
+     * @brief Allocator of towers.
+     */
+    LinkAllocator mLinkAllocator;
+
+    /**
+     * @brief Pointer to the first item of the list.
+     */
+    Item* mBegin;
+
+    /**
+     * @brief Pointer to the last item of the list.
+     */
+    Item* mTail;
+
+    /**
+     * @brief Number of items.
+     */
+    uintmax_t mSize;
+
+    /**
+     * @brief Number of express levels in use.
+     */
+    std::size_t mLevel;
+
+    /**
+     * @brief State of the generator of tower heights.
+     */
+    uint64_t mRandom;
+
+    /**
+     * @brief Express links of the head. Head is at position 0, item with index i at position i + 1.
+     */
+    CSkipLink mHead[cMaxLevel];
+
+    /**
+     * @brief Last item of every express lane, null for the head. Index 0 is unused.
+     */
+    Item* mLast[cMaxLevel + 1u];
+
+    /**
+     * @brief Positions of mLast items.
+     */
+    uintmax_t mLastPosition[cMaxLevel + 1u];
+
+    /**
+     * @brief Returns express link of item or of the head if item is null.
+     */
+    CSkipLink& link(Item* const aItem, const std::size_t aLevel)
+    {
+        return (aItem != nullptr) ? aItem->mLinks[aLevel - 1u] : mHead[aLevel - 1u];
+    }
+
+    /**
+     * @brief Returns express link of item or of the head if item is null.
+     */
+    const CSkipLink& link(const Item* const aItem, const std::size_t aLevel) const
+    {
+        return (aItem != nullptr) ? aItem->mLinks[aLevel - 1u] : mHead[aLevel - 1u];
+    }
+
+    /**
+     * @brief Moves given number of level-0 steps forward.
+     * @param aItem Start item or null for the head.
+     * @param aSteps Number of steps.
+     * @return Reached item.
+     */
+    Item* walk(Item* aItem, uintmax_t aSteps) const
+    {
+        if ((aItem == nullptr) && (aSteps > 0))
+        {
+            aItem = mBegin;
+            aSteps--;
+        }
+        for (; aSteps > 0; aSteps--)
+        {
+            aItem = aItem->mNext;
+        }
+        return aItem;
+    }
+
+    /**
+     * @brief Returns random height of tower. Every level is reached with probability 1/4.
+     */
+    std::size_t randomHeight()
+    {
+        // xorshift64
+        mRandom ^= mRandom << 13u;
+        mRandom ^= mRandom >> 7u;
+        mRandom ^= mRandom << 17u;
+
+        uint64_t bits = mRandom;
+        std::size_t height = 0;
+        while ((height < cMaxLevel) && ((bits & 3u) == 0))
+        {
+            height++;
+            bits >>= 2u;
+        }
+        return height;
+    }
+
+    /**
+     * @brief Enables express levels up to given height.
+     */
+    void raiseLevel(const std::size_t aHeight)
+    {
+        for (; mLevel < aHeight; mLevel++)
+        {
+            mHead[mLevel].mNext = nullptr;
+            mHead[mLevel].mSpan = 0;
+            mLast[mLevel + 1u] = nullptr;
+            mLastPosition[mLevel + 1u] = 0;
+        }
+    }
+
+    /**
+     * @brief Finds the last item before given position on every express level.
+     * @param aTarget Position.
+     * @param aUpdate Output, predecessor on every level, null for the head. Levels above the current
+     * height get the head.
+     * @param aRank Output, positions of predecessors.
+     */
+    void findPredecessors(const uintmax_t aTarget, Item** const aUpdate, uintmax_t* const aRank)
+    {
+        Item* item = nullptr;
+        uintmax_t position = 0;
+        for (std::size_t level = mLevel; level > 0; level--)
+        {
+            CSkipLink* next = &link(item, level);
+            while ((next->mNext != nullptr) && (position + next->mSpan < aTarget))
+            {
+                position += next->mSpan;
+                item = next->mNext;
+                next = &link(item, level);
+            }
+            aUpdate[level] = item;
+            aRank[level] = position;
+        }
+        for (std::size_t level = mLevel + 1u; level <= cMaxLevel; level++)
+        {
+            aUpdate[level] = nullptr;
+            aRank[level] = 0;
+        }
+    }
+
+    /**
+     * @brief Constructs value so it gets given index.
+     * @param aIndex Index, lower or equal to size.
+     * @param aArgs Arguments of the constructor of T.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& insertAt(const uintmax_t aIndex, TArgs&&... aArgs)
+    {
+        if (aIndex == mSize)
+        {
+            return emplaceBack(std::forward<TArgs>(aArgs)...);
+        }
+
+        const uintmax_t target = aIndex + 1u;
+        Item* update[cMaxLevel + 1u];
+        uintmax_t rank[cMaxLevel + 1u];
+        findPredecessors(target, update, rank);
+
+        Item* item = createItem(std::forward<TArgs>(aArgs)...);
+        Item* next = walk(update[1], target - rank[1]);
+        item->mNext = next;
+        item->mPrevious = next->mPrevious;
+        if (next->mPrevious != nullptr)
+        {
+            next->mPrevious->mNext = item;
+        }
+        else
+        {
+            mBegin = item;
+        }
+        next->mPrevious = item;
+        mSize++;
+
+        const std::size_t previousLevel = mLevel;
+        raiseLevel(item->mHeight);
+        for (std::size_t level = 1; level <= mLevel; level++)
+        {
+            CSkipLink& previousLink = link(update[level], level);
+            if (level <= item->mHeight)
+            {
+                CSkipLink& itemLink = item->mLinks[level - 1u];
+                itemLink.mNext = previousLink.mNext;
+                itemLink.mSpan = (previousLink.mNext != nullptr) ? rank[level] + previousLink.mSpan + 1u - target : 0;
+                previousLink.mNext = item;
+                previousLink.mSpan = target - rank[level];
+                if ((level > previousLevel) || (mLast[level] == update[level]))
+                {
+                    mLast[level] = item;
+                    mLastPosition[level] = target;
+                }
+                else
+                {
+                    mLastPosition[level]++;
+                }
+            }
+            else
+            {
+                if (previousLink.mNext != nullptr)
+                {
+                    previousLink.mSpan++;
+                }
+                if (mLastPosition[level] >= target)
+                {
+                    mLastPosition[level]++;
+                }
+            }
+        }
+        return item->mValue;
+    }
+
+    /**
+     * @brief Allocates item with a random tower.
+     * @param aArgs Arguments of the constructor of T.
+     * @return Pointer to the new item.
+     */
+    template<typename... TArgs>
+    Item* createItem(TArgs&&... aArgs)
+    {
+        const std::size_t height = randomHeight();
+        Item* item = ItemTraits::allocate(mAllocator, 1);
+        try
+        {
+            ItemTraits::construct(mAllocator, item, std::forward<TArgs>(aArgs)...);
+        }
+        catch (...)
+        {
+            ItemTraits::deallocate(mAllocator, item, 1);
+            throw;
+        }
+
+        if (height > 0)
+        {
+            try
+            {
+                item->mLinks = LinkTraits::allocate(mLinkAllocator, height);
+            }
+            catch (...)
+            {
+                destroyItem(item);
+                throw;
+            }
+            item->mHeight = height;
+        }
+        return item;
+    }
+
+    /**
+     * @brief Destroys item with its tower.
+     * @param aItem Item to destroy.
+     */
+    void destroyItem(Item* const aItem)
+    {
+        if (aItem->mLinks != nullptr)
+        {
+            LinkTraits::deallocate(mLinkAllocator, aItem->mLinks, aItem->mHeight);
+        }
+        ItemTraits::destroy(mAllocator, aItem);
+        ItemTraits::deallocate(mAllocator, aItem, 1);
+    }
+
+    /**
+     * @brief Takes over items and express lanes of other list, which is empty afterwards.
+     * This list has to be empty and its allocators have to be able to free the items.
+     * @param aObj Other list.
+     */
+    void takeItems(CSkipDoublyLinkedList& aObj) noexcept
+    {
+        mBegin = aObj.mBegin;
+        mTail = aObj.mTail;
+        mSize = aObj.mSize;
+        mLevel = aObj.mLevel;
+        for (std::size_t level = 1; level <= mLevel; level++)
+        {
+            mHead[level - 1u] = aObj.mHead[level - 1u];
+            mLast[level] = aObj.mLast[level];
+            mLastPosition[level] = aObj.mLastPosition[level];
+        }
+        aObj.IniEmptyList();
+    }
+
+    /**
+     * @brief Method for initialization empty List
+     */
+    void IniEmptyList()
+    {
+        mBegin = nullptr;
+        mTail = nullptr;
+        mSize = 0;
+        mLevel = 0;
+        for (std::size_t level = 0; level <= cMaxLevel; level++)
+        {
+            mLast[level] = nullptr;
+            mLastPosition[level] = 0;
+        }
+    }
+
+    /**
+     * @brief Method which at all clear List
+     */
+    void ClearList()
+    {
+        Item* item = mBegin;
+        while (item != nullptr)
+        {
+            Item* next = item->mNext;
+            destroyItem(item);
+            item = next;
+        }
+        IniEmptyList();
+    }
+};
+
+#endif
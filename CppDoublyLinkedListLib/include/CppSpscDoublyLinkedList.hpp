@@ -0,0 +1,345 @@
+#ifndef CPP_SPSC_DOUBLY_LINKED_LIST_HPP_
+#define CPP_SPSC_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "CppDoublyLinkedListPool.hpp"
+
+/**
+ * @brief Wait-free linked queue for exactly one producer thread and one consumer thread.
+ * The producer calls pushBack and emplaceBack, the consumer tryPopFront and popFront.
+ *
+ * The queue always holds a dummy item at the front; the consumer owns the pointer to it and moves it
+ * forward with a release store, the producer links new items behind the last one with a release store.
+ * No read-modify-write atomics are used.
+ *
+ * Consumed items are not freed: they stay linked before the dummy and form the free list of the producer,
+ * which takes them back in order. The producer refreshes its copy of the consumer position only when
+ * its free list runs out, so in steady state neither side allocates and the two sides touch
+ * a shared cache line only once per pass over the free list.
+ *
+ * Items are allocated only by the producer, so the default pool allocator needs no synchronization.
+ * @tparam T Type of items.
+ * @tparam TAllocator Allocator of items.
+ */
+template<typename T, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+class CSpscDoublyLinkedList
+{
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief List item. A queue needs no link to previous item.
+     */
+    struct CSpscDoublyLinkedListItem
+    {
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CSpscDoublyLinkedListItem()
+            : mNext(nullptr)
+        {}
+
+        /**
+         * @brief Pointer to next item.
+         */
+        std::atomic<CSpscDoublyLinkedListItem*> mNext;
+
+        /**
+         * @brief Storage for value, constructed between push and pop.
+         */
+        typename std::aligned_storage<sizeof(T), alignof(T)>::type mValue;
+    };
+
+    using Item = CSpscDoublyLinkedListItem;
+
+    /**
+     * @brief Size of cache line, fields of producer and consumer are kept apart.
+     */
+    static const std::size_t cCacheLine = 64u;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CSpscDoublyLinkedList()
+        : CSpscDoublyLinkedList(TAllocator())
+    {}
+
+    explicit CSpscDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+    {
+        Item* dummy = ItemTraits::allocate(mAllocator, 1);
+        ItemTraits::construct(mAllocator, dummy);
+        mFront.store(dummy, std::memory_order_relaxed);
+        mBack = dummy;
+        mFirstFree = dummy;
+        mFrontCopy = dummy;
+    }
+
+    CSpscDoublyLinkedList(const CSpscDoublyLinkedList&) = delete;
+
+    /**
+     * @brief Destroys remaining values. Neither thread may use the list any more.
+     */
+    ~CSpscDoublyLinkedList()
+    {
+        for (Item* item = mFront.load(std::memory_order_acquire)->mNext.load(std::memory_order_acquire);
+             item != nullptr; item = item->mNext.load(std::memory_order_relaxed))
+        {
+            valueOf(item).~T();
+        }
+        Item* item = mFirstFree;
+        while (item != nullptr)
+        {
+            Item* next = item->mNext.load(std::memory_order_relaxed);
+            ItemTraits::destroy(mAllocator, item);
+            ItemTraits::deallocate(mAllocator, item, 1);
+            item = next;
+        }
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CSpscDoublyLinkedList& operator=(const CSpscDoublyLinkedList&) = delete;
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Indicates if the list is empty. Exact for the consumer, may be outdated for the producer.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mFront.load(std::memory_order_acquire)->mNext.load(std::memory_order_acquire) == nullptr);
+    }
+
+    /**
+     * @brief Adds value to the end of list. Producer only, wait-free unless a new item has to be allocated.
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        emplaceBack(aValue);
+    }
+
+    /**
+     * @brief Adds value to the end of list. Producer only, wait-free unless a new item has to be allocated.
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+    }
+
+    /**
+     * @brief Adds values of range to the end of list. Producer only.
+     * All values become visible to the consumer at once, with a single release store.
+     * If a value throws while constructed, nothing is added.
+     * @param aFirst Beginning of range.
+     * @param aLast End of range.
+     */
+    template<typename TIterator>
+    void pushBack(TIterator aFirst, TIterator aLast)
+    {
+        if (aFirst == aLast)
+        {
+            return;
+        }
+        Item* first = createItem(*aFirst);
+        Item* last = first;
+        try
+        {
+            for (++aFirst; aFirst != aLast; ++aFirst)
+            {
+                Item* item = createItem(*aFirst);
+                last->mNext.store(item, std::memory_order_relaxed);
+                last = item;
+            }
+        }
+        catch (...)
+        {
+            for (Item* item = first; item != nullptr; )
+            {
+                Item* next = item->mNext.load(std::memory_order_relaxed);
+                valueOf(item).~T();
+                destroyItem(item);
+                item = next;
+            }
+            throw;
+        }
+        linkItems(first, last);
+    }
+
+    /**
+     * @brief Constructs value at the end of list. Producer only, wait-free unless a new item has to be allocated.
+     * @param aArgs Arguments for constructor of value.
+     */
+    template<typename... TArgs>
+    void emplaceBack(TArgs&&... aArgs)
+    {
+        Item* item = createItem(std::forward<TArgs>(aArgs)...);
+        linkItems(item, item);
+    }
+
+    /**
+     * @brief Removes the first value of list. Consumer only, wait-free.
+     * @param aValue Receives removed value, unchanged if the list is empty.
+     * @return true if a value was removed, false if the list was empty.
+     */
+    bool tryPopFront(T& aValue)
+    {
+        return (popFront(&aValue, 1u) == 1u);
+    }
+
+    /**
+     * @brief Removes up to aMax first values of list. Consumer only, wait-free.
+     * Taken items are handed back to the producer with a single release store.
+     * @param aValues Receives removed values.
+     * @param aMax Maximal number of values to remove.
+     * @return Number of removed values.
+     */
+    std::size_t popFront(T* aValues, std::size_t aMax)
+    {
+        Item* const front = mFront.load(std::memory_order_relaxed);
+        Item* dummy = front;
+        std::size_t count = 0;
+        try
+        {
+            for (; count < aMax; count++)
+            {
+                Item* next = dummy->mNext.load(std::memory_order_acquire);
+                if (next == nullptr)
+                {
+                    break;
+                }
+                T& value = valueOf(next);
+                aValues[count] = std::move(value);
+                value.~T();
+                dummy = next;
+            }
+        }
+        catch (...)
+        {
+            mFront.store(dummy, std::memory_order_release);
+            throw;
+        }
+        if (dummy != front)
+        {
+            mFront.store(dummy, std::memory_order_release);
+        }
+        return count;
+    }
+
+private:
+
+    using ItemAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Item>;
+    using ItemTraits = std::allocator_traits<ItemAllocator>;
+
+    /**
+     * @brief Allocator of items, used by producer only.
+     */
+    ItemAllocator mAllocator;
+
+    /**
+     * @brief Dummy item before the first value. Written by consumer, read by producer.
+     */
+    alignas(cCacheLine) std::atomic<Item*> mFront;
+
+    /**
+     * @brief Last item. Producer only.
+     */
+    alignas(cCacheLine) Item* mBack;
+
+    /**
+     * @brief Oldest consumed item - items from here up to mFrontCopy are free. Producer only.
+     */
+    Item* mFirstFree;
+
+    /**
+     * @brief Last value of mFront seen by producer. Producer only.
+     */
+    Item* mFrontCopy;
+
+    /**
+     * @brief Returns value of item.
+     */
+    static T& valueOf(Item* aItem)
+    {
+        return *reinterpret_cast<T*>(&aItem->mValue);
+    }
+
+    /**
+     * @brief Takes consumed item or allocates a new one and constructs value in it.
+     */
+    template<typename... TArgs>
+    Item* createItem(TArgs&&... aArgs)
+    {
+        Item* item;
+        if (mFirstFree == mFrontCopy)
+        {
+            mFrontCopy = mFront.load(std::memory_order_acquire);
+        }
+        if (mFirstFree != mFrontCopy)
+        {
+            item = mFirstFree;
+            mFirstFree = item->mNext.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            item = ItemTraits::allocate(mAllocator, 1);
+            ItemTraits::construct(mAllocator, item);
+        }
+
+        try
+        {
+            ::new (static_cast<void*>(&item->mValue)) T(std::forward<TArgs>(aArgs)...);
+        }
+        catch (...)
+        {
+            destroyItem(item);
+            throw;
+        }
+        item->mNext.store(nullptr, std::memory_order_relaxed);
+        return item;
+    }
+
+    /**
+     * @brief Frees item without value.
+     */
+    void destroyItem(Item* aItem)
+    {
+        ItemTraits::destroy(mAllocator, aItem);
+        ItemTraits::deallocate(mAllocator, aItem, 1);
+    }
+
+    /**
+     * @brief Publishes chain of items to consumer.
+     */
+    void linkItems(Item* aFirst, Item* aLast)
+    {
+        mBack->mNext.store(aFirst, std::memory_order_release);
+        mBack = aLast;
+    }
+};
+
+#endif
@@ -0,0 +1,658 @@
+#ifndef CPP_STATIC_DOUBLY_LINKED_LIST_HPP_
+#define CPP_STATIC_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Doubly Linked List with fixed capacity and storage inside the list object. It never calls
+ * an allocator and all methods are noexcept. Items are linked by indices of the smallest unsigned
+ * type which can address TCapacity items, removed items are reused through a free list.
+ * For literal types T the list is usable in constant expressions, so tables can be built at compile time.
+ *
+ * Method names follow CDoublyLinkedList, but methods which add values return false if the list
+ * is full and pop methods require a non-empty list (checked by assert), because nothing may throw.
+ * Every item holds a value all the time: values are default constructed with the list, assigned
+ * when added and, unless trivially destructible, reset to T() when removed.
+ * @tparam T Type of items. Has to be nothrow default constructible and nothrow movable.
+ * @tparam TCapacity Maximal number of items.
+ */
+template<typename T, std::size_t TCapacity>
+class CStaticDoublyLinkedList
+{
+    static_assert((TCapacity > 0u) && (TCapacity < UINT32_MAX), "Capacity has to fit 32-bit indices");
+    static_assert(std::is_nothrow_default_constructible<T>::value, "Values have to be nothrow default constructible");
+    static_assert(std::is_nothrow_move_assignable<T>::value, "Values have to be nothrow move assignable");
+    static_assert(std::is_nothrow_move_constructible<T>::value, "Values have to be nothrow move constructible");
+
+    /**
+     * @brief Type of links stored in items, the smallest which can address all items and the null index.
+     */
+    using Link = std::conditional_t<(TCapacity < UINT8_MAX), uint8_t,
+                                    std::conditional_t<(TCapacity < UINT16_MAX), uint16_t, uint32_t>>;
+
+    /**
+     * @brief Type of indices outside of items. Arithmetic on narrow types is slower, so links
+     * are widened when loaded.
+     */
+    using Index = uint32_t;
+
+    /**
+     * @brief Index meaning no item.
+     */
+    static constexpr Index cNull = std::numeric_limits<Link>::max();
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for StaticDoublyLinked container.
+     */
+    class CStaticDoublyLinkedListIterator
+    {
+        /**
+         * @brief List of item.
+         */
+        const CStaticDoublyLinkedList* mList;
+
+        /**
+         * @brief Index of item, cNull for end().
+         */
+        Index mIndex;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        constexpr CStaticDoublyLinkedListIterator() noexcept
+            : mList(nullptr)
+            , mIndex(cNull)
+        {}
+
+        constexpr CStaticDoublyLinkedListIterator(const CStaticDoublyLinkedList* aList, Index aIndex) noexcept
+            : mList(aList)
+            , mIndex(aIndex)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        constexpr CStaticDoublyLinkedListIterator& operator ++() noexcept
+        {
+            mIndex = mList->mNext[mIndex];
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        constexpr CStaticDoublyLinkedListIterator operator ++(int) noexcept
+        {
+            CStaticDoublyLinkedListIterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement. Works from end() too.
+         */
+        constexpr CStaticDoublyLinkedListIterator& operator --() noexcept
+        {
+            mIndex = (mIndex == cNull) ? mList->mTail : mList->mPrevious[mIndex];
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        constexpr CStaticDoublyLinkedListIterator operator --(int) noexcept
+        {
+            CStaticDoublyLinkedListIterator it(*this);
+            --(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        constexpr const T& operator*() const noexcept
+        {
+            return mList->mValues[mIndex];
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        constexpr const T* operator->() const noexcept
+        {
+            return &(mList->mValues[mIndex]);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        constexpr bool operator==(const CStaticDoublyLinkedListIterator& alt) const noexcept
+        {
+            return (mIndex == alt.mIndex);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        constexpr bool operator!=(const CStaticDoublyLinkedListIterator& alt) const noexcept
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        constexpr const T& getValueItem() const noexcept
+        {
+            return **this;
+        }
+    };
+
+    using DIterator = CStaticDoublyLinkedListIterator;
+    using DReverseIterator = std::reverse_iterator<CStaticDoublyLinkedListIterator>;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    constexpr CStaticDoublyLinkedList() noexcept
+        : mValues{}
+        , mPrevious{}
+        , mNext{}
+        , mBegin(cNull)
+        , mTail(cNull)
+        , mFirstFree(cNull)
+        , mUsed(0)
+        , mSize(0)
+    {}
+
+    /**
+     * @brief Creates list with given values. Values which don't fit are left out.
+     */
+    constexpr CStaticDoublyLinkedList(std::initializer_list<T> aValues) noexcept
+        : CStaticDoublyLinkedList()
+    {
+        assign(aValues);
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Compares lists
+     */
+    constexpr bool operator==(const CStaticDoublyLinkedList& aObj) const noexcept
+    {
+        if (mSize != aObj.mSize)
+        {
+            return false;
+        }
+        for (Index index = mBegin, other = aObj.mBegin; index != cNull; index = mNext[index], other = aObj.mNext[other])
+        {
+            if (!(mValues[index] == aObj.mValues[other]))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compare operator
+     */
+    constexpr bool operator!=(const CStaticDoublyLinkedList& aObj) const noexcept
+    {
+        return !(*this == aObj);
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns maximal number of items.
+     */
+    static constexpr uintmax_t capacity() noexcept
+    {
+        return TCapacity;
+    }
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    constexpr uintmax_t size() const noexcept
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    constexpr bool empty() const noexcept
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Indicates if the list holds TCapacity items.
+     * Complexity: O(1)
+     * @return true if no value can be added, otherwise false.
+     */
+    constexpr bool full() const noexcept
+    {
+        return (mSize == TCapacity);
+    }
+
+    /**
+     * @brief Replaces values of the list with given values. Values which don't fit are left out.
+     * Complexity: O(n + m)
+     * @return true if all values fit.
+     */
+    constexpr bool assign(std::initializer_list<T> aValues) noexcept
+    {
+        static_assert(std::is_nothrow_copy_assignable<T>::value, "Values have to be nothrow copy assignable");
+        while (!empty())
+        {
+            popBack();
+        }
+        for (const T& value : aValues)
+        {
+            if (!pushBack(value))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     * @return false if the list is full, the value isn't added then.
+     */
+    constexpr bool pushBack(const T& aValue) noexcept
+    {
+        static_assert(std::is_nothrow_copy_assignable<T>::value, "Values have to be nothrow copy assignable");
+        return linkBefore(cNull, aValue);
+    }
+
+    /**
+     * @brief Adds value to list. The value is moved into the list.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     * @return false if the list is full, the value isn't added then.
+     */
+    constexpr bool pushBack(T&& aValue) noexcept
+    {
+        return linkBefore(cNull, std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value and adds it at the end of the list.
+     * Complexity: O(1)
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return false if the list is full, the value isn't added then.
+     */
+    template<typename... TArgs>
+    constexpr bool emplaceBack(TArgs&&... aArgs) noexcept
+    {
+        static_assert(std::is_nothrow_constructible<T, TArgs&&...>::value, "Values have to be nothrow constructible");
+        return full() ? false : linkBefore(cNull, T(std::forward<TArgs>(aArgs)...));
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(1)
+     * @param aValue Value.
+     * @return false if the list is full, the value isn't added then.
+     */
+    constexpr bool pushFront(const T& aValue) noexcept
+    {
+        static_assert(std::is_nothrow_copy_assignable<T>::value, "Values have to be nothrow copy assignable");
+        return linkBefore(mBegin, aValue);
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list. The value is moved into the list.
+     * Complexity: O(1)
+     * @param aValue Value.
+     * @return false if the list is full, the value isn't added then.
+     */
+    constexpr bool pushFront(T&& aValue) noexcept
+    {
+        return linkBefore(mBegin, std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value and puts it at the beginning of the list.
+     * Complexity: O(1)
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return false if the list is full, the value isn't added then.
+     */
+    template<typename... TArgs>
+    constexpr bool emplaceFront(TArgs&&... aArgs) noexcept
+    {
+        static_assert(std::is_nothrow_constructible<T, TArgs&&...>::value, "Values have to be nothrow constructible");
+        return full() ? false : linkBefore(mBegin, T(std::forward<TArgs>(aArgs)...));
+    }
+
+    /**
+     * @brief Removes last item from list. The list must not be empty.
+     * Complexity: O(1)
+     * @return Last item from list.
+     */
+    constexpr T popBack() noexcept
+    {
+        assert(!empty());
+        return unlink(mTail);
+    }
+
+    /**
+     * @brief Remove the first element from the list. The list must not be empty.
+     * Complexity: O(1)
+     * @return The first item from list.
+     */
+    constexpr T popFront() noexcept
+    {
+        assert(!empty());
+        return unlink(mBegin);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    constexpr bool contains(const T& aValue) const noexcept
+    {
+        return (find(aValue) != end());
+    }
+
+    /**
+     * @brief Finds the first item holding given value.
+     * Complexity: O(n)
+     * @param aValue Value to find.
+     * @return Iterator to the item or end() if there isn't the value in the list.
+     */
+    constexpr DIterator find(const T& aValue) const noexcept
+    {
+        Index index = mBegin;
+        while ((index != cNull) && !(mValues[index] == aValue))
+        {
+            index = mNext[index];
+        }
+        return DIterator(this, index);
+    }
+
+    /**
+     * @brief Returns value at given position.
+     * Complexity: O(n) - the list is walked from the nearer end.
+     * @param aIndex Position of value.
+     * @return Pointer to value or null if the position is out of the list.
+     */
+    constexpr const T* get(const uintmax_t aIndex) const noexcept
+    {
+        if (aIndex >= mSize)
+        {
+            return nullptr;
+        }
+        return &mValues[findItem(aIndex)];
+    }
+
+    /**
+     * @brief Inserts value at given position.
+     * Complexity: O(n)
+     * @param aIndex Position of value. Must be lower than size.
+     * @param aValue Value to insert.
+     * @return false if the list is full or the position is out of the list, the value isn't added then.
+     */
+    constexpr bool insert(const uintmax_t aIndex, const T& aValue) noexcept
+    {
+        static_assert(std::is_nothrow_copy_assignable<T>::value, "Values have to be nothrow copy assignable");
+        return (aIndex < mSize) && linkBefore(findItem(aIndex), aValue);
+    }
+
+    /**
+     * @brief Inserts value at given position. The value is moved into the list.
+     * Complexity: O(n)
+     * @param aIndex Position of value. Must be lower than size.
+     * @param aValue Value to insert.
+     * @return false if the list is full or the position is out of the list, the value isn't added then.
+     */
+    constexpr bool insert(const uintmax_t aIndex, T&& aValue) noexcept
+    {
+        return (aIndex < mSize) && linkBefore(findItem(aIndex), std::move(aValue));
+    }
+
+    /**
+     * @brief Removes value at given position.
+     * Complexity: O(n)
+     * @param aIndex Position of value. Must be lower than size.
+     * @return Removed value.
+     */
+    constexpr T eraseAt(const uintmax_t aIndex) noexcept
+    {
+        assert(aIndex < mSize);
+        return unlink(findItem(aIndex));
+    }
+
+    /**
+     * @brief Returns iterator to the first item.
+     */
+    constexpr DIterator begin() const noexcept
+    {
+        return DIterator(this, mBegin);
+    }
+
+    /**
+     * @brief Returns iterator behind the last item. Can be decremented.
+     */
+    constexpr DIterator end() const noexcept
+    {
+        return DIterator(this, cNull);
+    }
+
+    /**
+     * @brief Returns reverse iterator to the last item.
+     */
+    constexpr DReverseIterator rbegin() const noexcept
+    {
+        return DReverseIterator(end());
+    }
+
+    /**
+     * @brief Returns reverse iterator before the first item.
+     */
+    constexpr DReverseIterator rend() const noexcept
+    {
+        return DReverseIterator(begin());
+    }
+
+private:
+
+    /**
+     * @brief Values of items.
+     */
+    T mValues[TCapacity];
+
+    /**
+     * @brief Index of previous item for every item.
+     */
+    Link mPrevious[TCapacity];
+
+    /**
+     * @brief Index of next item for every item, next free item for free items.
+     */
+    Link mNext[TCapacity];
+
+    /**
+     * @brief Index of the first item.
+     */
+    Index mBegin;
+
+    /**
+     * @brief Index of the last item.
+     */
+    Index mTail;
+
+    /**
+     * @brief Index of the first free item below mUsed.
+     */
+    Index mFirstFree;
+
+    /**
+     * @brief Number of items at the beginning of the storage which were ever used.
+     */
+    Index mUsed;
+
+    /**
+     * @brief Number of items in the list.
+     */
+    Index mSize;
+
+    /**
+     * @brief Returns index of item at given position, which has to be in the list.
+     */
+    constexpr Index findItem(const uintmax_t aIndex) const noexcept
+    {
+        Index index = mBegin;
+        if (aIndex < mSize / 2u)
+        {
+            for (uintmax_t i = 0; i < aIndex; ++i)
+            {
+                index = mNext[index];
+            }
+        }
+        else
+        {
+            index = mTail;
+            for (uintmax_t i = mSize - 1u; i > aIndex; --i)
+            {
+                index = mPrevious[index];
+            }
+        }
+        return index;
+    }
+
+    /**
+     * @brief Takes free item, assigns value to it and links it before given item.
+     * @param aNext Item before which the new one is linked, cNull for the end.
+     * @param aValue Value.
+     * @return false if the list is full.
+     */
+    template<typename TValue>
+    constexpr bool linkBefore(const Index aNext, TValue&& aValue) noexcept
+    {
+        if (full())
+        {
+            return false;
+        }
+        Index index = mFirstFree;
+        if (index != cNull)
+        {
+            mFirstFree = mNext[index];
+        }
+        else
+        {
+            index = mUsed++;
+        }
+
+        mValues[index] = std::forward<TValue>(aValue);
+        const Index previous = (aNext != cNull) ? mPrevious[aNext] : mTail;
+        mPrevious[index] = static_cast<Link>(previous);
+        mNext[index] = static_cast<Link>(aNext);
+        if (previous != cNull)
+        {
+            mNext[previous] = static_cast<Link>(index);
+        }
+        else
+        {
+            mBegin = index;
+        }
+        if (aNext != cNull)
+        {
+            mPrevious[aNext] = static_cast<Link>(index);
+        }
+        else
+        {
+            mTail = index;
+        }
+        mSize++;
+        return true;
+    }
+
+    /**
+     * @brief Unlinks item, puts it to the free list and returns its value.
+     */
+    constexpr T unlink(const Index aIndex) noexcept
+    {
+        const Index previous = mPrevious[aIndex];
+        const Index next = mNext[aIndex];
+        if (previous != cNull)
+        {
+            mNext[previous] = static_cast<Link>(next);
+        }
+        else
+        {
+            mBegin = next;
+        }
+        if (next != cNull)
+        {
+            mPrevious[next] = static_cast<Link>(previous);
+        }
+        else
+        {
+            mTail = previous;
+        }
+        mNext[aIndex] = static_cast<Link>(mFirstFree);
+        mFirstFree = aIndex;
+        mSize--;
+
+        T returnItem = std::move(mValues[aIndex]);
+        if constexpr (!std::is_trivially_destructible<T>::value)
+        {
+            // release resources of moved-from value
+            mValues[aIndex] = T();
+        }
+        return returnItem;
+    }
+};
+
+#endif
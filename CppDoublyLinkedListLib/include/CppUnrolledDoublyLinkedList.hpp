@@ -0,0 +1,995 @@
+#ifndef CPP_UNROLLED_DOUBLY_LINKED_LIST_HPP_
+#define CPP_UNROLLED_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+#include "CppDoublyLinkedListPool.hpp"
+
+/**
+ * @brief Unrolled Doubly Linked List. Every node holds up to TNodeCapacity items stored next to each other,
+ * so small items share the cost of the links and neighbouring items share cache lines.
+ * Full nodes are split on insert, nodes which drop below half of capacity are merged with a neighbour on remove.
+ * It has the same interface as CDoublyLinkedList.
+ * @tparam T Type of items.
+ * @tparam TNodeCapacity Maximal number of items in one node.
+ * @tparam TAllocator Allocator of nodes.
+ */
+template<typename T, std::size_t TNodeCapacity = 16u, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+class CUnrolledDoublyLinkedList
+{
+    static_assert(TNodeCapacity >= 2u, "Node has to hold at least two items");
+
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief List node. Holds array of items and pointers to next and previous node.
+     * Items [0, mCount) are constructed.
+     */
+    class CUnrolledDoublyLinkedListNode
+    {
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CUnrolledDoublyLinkedListNode(CUnrolledDoublyLinkedListNode* const aPrevious,
+                                      CUnrolledDoublyLinkedListNode* const aNext)
+            : mPrevious(aPrevious)
+            , mNext(aNext)
+            , mCount(0)
+        {}
+
+        CUnrolledDoublyLinkedListNode(const CUnrolledDoublyLinkedListNode&) = delete;
+
+        CUnrolledDoublyLinkedListNode& operator=(const CUnrolledDoublyLinkedListNode&) = delete;
+
+        ~CUnrolledDoublyLinkedListNode()
+        {
+            for (std::size_t i = 0; i < mCount; i++)
+            {
+                values()[i].~T();
+            }
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Returns pointer to the first item.
+         */
+        T* values()
+        {
+            return std::launder(reinterpret_cast<T*>(mStorage));
+        }
+
+        /**
+         * @brief Returns pointer to the first item.
+         */
+        const T* values() const
+        {
+            return std::launder(reinterpret_cast<const T*>(mStorage));
+        }
+
+        /**
+         * @brief Indicates if node can't take more items.
+         */
+        bool full() const
+        {
+            return (mCount == TNodeCapacity);
+        }
+
+        /**
+         * @brief Inserts item at given position. Items behind it are shifted.
+         * The node is unchanged if the value can't be copied, or if shifting throws and moving items back doesn't.
+         * Complexity: O(TNodeCapacity)
+         * @param aPosition Position, must be lower or equal to count.
+         * @param aValue Value.
+         */
+        void insert(const std::size_t aPosition, const T& aValue)
+        {
+            T* items = values();
+            if (aPosition == mCount)
+            {
+                new (items + mCount) T(aValue);
+                mCount++;
+                return;
+            }
+
+            T value(aValue);
+            new (items + mCount) T(std::move(items[mCount - 1u]));
+            mCount++;
+            // slot moved from, items behind it are already shifted
+            std::size_t hole = mCount - 2u;
+            try
+            {
+                for (; hole > aPosition; hole--)
+                {
+                    items[hole] = std::move(items[hole - 1u]);
+                }
+                items[aPosition] = std::move(value);
+            }
+            catch (...)
+            {
+                for (std::size_t i = hole; i + 1u < mCount; i++)
+                {
+                    items[i] = std::move(items[i + 1u]);
+                }
+                mCount--;
+                items[mCount].~T();
+                throw;
+            }
+        }
+
+        /**
+         * @brief Removes item from given position. Items behind it are shifted.
+         * Complexity: O(TNodeCapacity)
+         * @param aPosition Position, must be lower than count.
+         * @return Removed value.
+         */
+        T erase(const std::size_t aPosition)
+        {
+            T* items = values();
+            T returnItem = std::move(items[aPosition]);
+            for (std::size_t i = aPosition + 1u; i < mCount; i++)
+            {
+                items[i - 1u] = std::move(items[i]);
+            }
+            mCount--;
+            items[mCount].~T();
+            return returnItem;
+        }
+
+        /**
+         * @brief Moves items [aFrom, count) at the end of given node.
+         * @param aFrom Position of the first moved item.
+         * @param aTarget Node which takes the items. Must have enough free space.
+         */
+        void moveTail(const std::size_t aFrom, CUnrolledDoublyLinkedListNode& aTarget)
+        {
+            T* items = values();
+            T* targetItems = aTarget.values();
+            for (std::size_t i = aFrom; i < mCount; i++)
+            {
+                new (targetItems + aTarget.mCount) T(std::move(items[i]));
+                aTarget.mCount++;
+                items[i].~T();
+            }
+            mCount = aFrom;
+        }
+
+        /**
+         * @brief Pointer to previous node.
+         */
+        CUnrolledDoublyLinkedListNode* mPrevious;
+
+        /**
+         * @brief Pointer to next node.
+         */
+        CUnrolledDoublyLinkedListNode* mNext;
+
+        /**
+         * @brief Number of items in node.
+         */
+        std::size_t mCount;
+
+    private:
+
+        /**
+         * @brief Storage for items.
+         */
+        alignas(T) unsigned char mStorage[sizeof(T) * TNodeCapacity];
+    };
+
+    using Node = CUnrolledDoublyLinkedListNode;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for UnrolledDoublyLinked container. Points to node and position in the node.
+     */
+    class CUnrolledDoublyLinkedListIterator
+    {
+        /**
+         * @brief Pointer to node.
+         */
+        const Node* mNode;
+
+        /**
+         * @brief Position in node.
+         */
+        std::size_t mPosition;
+
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CUnrolledDoublyLinkedListIterator(const Node* aNode, const std::size_t aPosition)
+            : mNode(aNode)
+            , mPosition(aPosition)
+        {}
+
+        ~CUnrolledDoublyLinkedListIterator() = default;
+
+        CUnrolledDoublyLinkedListIterator(const CUnrolledDoublyLinkedListIterator&) = default;
+
+        CUnrolledDoublyLinkedListIterator& operator=(const CUnrolledDoublyLinkedListIterator&) = default;
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator add
+         */
+        CUnrolledDoublyLinkedListIterator operator +(const int aDiffIndex)const
+        {
+            CUnrolledDoublyLinkedListIterator it(*this);
+            for (int i = 0; i < aDiffIndex; i++)
+            {
+                ++it;
+            }
+            return it;
+        }
+
+        /**
+         * @brief Operator sub
+         */
+        CUnrolledDoublyLinkedListIterator operator -(const int aDiffIndex)const
+        {
+            CUnrolledDoublyLinkedListIterator it(*this);
+            for (int i = 0; i < aDiffIndex; i++)
+            {
+                --it;
+            }
+            return it;
+        }
+
+        /**
+         * @brief Operator increment
+         */
+        CUnrolledDoublyLinkedListIterator& operator ++()
+        {
+            mPosition++;
+            if (mPosition == mNode->mCount)
+            {
+                mNode = mNode->mNext;
+                mPosition = 0;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CUnrolledDoublyLinkedListIterator operator ++(int)
+        {
+            CUnrolledDoublyLinkedListIterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement
+         */
+        CUnrolledDoublyLinkedListIterator& operator --()
+        {
+            if (mPosition == 0)
+            {
+                mNode = mNode->mPrevious;
+                mPosition = (mNode != nullptr) ? mNode->mCount : 0;
+            }
+            if (mNode != nullptr)
+            {
+                mPosition--;
+            }
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CUnrolledDoublyLinkedListIterator operator --(int)
+        {
+            CUnrolledDoublyLinkedListIterator it(*this);
+            --(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return mNode->values()[mPosition];
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return mNode->values() + mPosition;
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CUnrolledDoublyLinkedListIterator& alt)const
+        {
+            return (mNode == alt.mNode) && (mPosition == alt.mPosition);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CUnrolledDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return mNode->values()[mPosition];
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+
+    /**
+     * @brief Reverse iterator for UnrolledDoublyLinked container.
+     */
+    class CReverseUnrolledDoublyLinkedListIterator
+    {
+        /**
+         * @brief Forward iterator moved in the opposite direction.
+         */
+        CUnrolledDoublyLinkedListIterator mIterator;
+
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CReverseUnrolledDoublyLinkedListIterator(const Node* aNode, const std::size_t aPosition)
+            : mIterator(aNode, aPosition)
+        {}
+
+        ~CReverseUnrolledDoublyLinkedListIterator() = default;
+
+        CReverseUnrolledDoublyLinkedListIterator(const CReverseUnrolledDoublyLinkedListIterator&) = default;
+
+        CReverseUnrolledDoublyLinkedListIterator& operator=(const CReverseUnrolledDoublyLinkedListIterator&) = default;
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator +
+         */
+        CReverseUnrolledDoublyLinkedListIterator operator +(const int aDiffIndex)const
+        {
+            CReverseUnrolledDoublyLinkedListIterator it(*this);
+            it.mIterator = mIterator - aDiffIndex;
+            return it;
+        }
+
+        /**
+         * @brief Operator -
+         */
+        CReverseUnrolledDoublyLinkedListIterator operator -(const int aDiffIndex)const
+        {
+            CReverseUnrolledDoublyLinkedListIterator it(*this);
+            it.mIterator = mIterator + aDiffIndex;
+            return it;
+        }
+
+        /**
+         * @brief Operator increment
+         */
+        CReverseUnrolledDoublyLinkedListIterator& operator ++()
+        {
+            --mIterator;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CReverseUnrolledDoublyLinkedListIterator operator ++(int)
+        {
+            CReverseUnrolledDoublyLinkedListIterator it(*this);
+            --mIterator;
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement
+         */
+        CReverseUnrolledDoublyLinkedListIterator& operator --()
+        {
+            ++mIterator;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CReverseUnrolledDoublyLinkedListIterator operator --(int)
+        {
+            CReverseUnrolledDoublyLinkedListIterator it(*this);
+            ++mIterator;
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return *mIterator;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return mIterator.operator->();
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CReverseUnrolledDoublyLinkedListIterator& alt)const
+        {
+            return (mIterator == alt.mIterator);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CReverseUnrolledDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return *mIterator;
+        }
+    };
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+
+    using DIterator = CUnrolledDoublyLinkedListIterator;
+    using DReverseIterator = CReverseUnrolledDoublyLinkedListIterator;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CUnrolledDoublyLinkedList()
+        : mAllocator()
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+    {}
+
+    explicit CUnrolledDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+    {}
+
+    CUnrolledDoublyLinkedList(const CUnrolledDoublyLinkedList& aObj)
+        : CUnrolledDoublyLinkedList(TAllocator(NodeTraits::select_on_container_copy_construction(aObj.mAllocator)))
+    {
+        for (const T& value : aObj)
+        {
+            pushBack(value);
+        }
+    }
+
+    ~CUnrolledDoublyLinkedList()
+    {
+        ClearList();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CUnrolledDoublyLinkedList& operator=(const CUnrolledDoublyLinkedList& aObj)
+    {
+        if (this == &aObj)
+        {
+            return *this;
+        }
+
+        ClearList();
+        if constexpr (NodeTraits::propagate_on_container_copy_assignment::value)
+        {
+            mAllocator = aObj.mAllocator;
+        }
+        for (const T& value : aObj)
+        {
+            pushBack(value);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Compares lists
+     */
+    bool operator==(const CUnrolledDoublyLinkedList& aObj) const
+    {
+        if (mSize != aObj.mSize)
+        {
+            return false;
+        }
+
+        DIterator thisIter = begin();
+        for (DIterator aObjIter = aObj.begin(); aObjIter != aObj.end(); ++aObjIter, ++thisIter)
+        {
+            if (*thisIter != *aObjIter)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compare operator
+     */
+    bool operator!=(const CUnrolledDoublyLinkedList& aObj) const
+    {
+        return !(*this == aObj);
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1) - a new node is allocated once per TNodeCapacity items.
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        if ((mTail == nullptr) || mTail->full())
+        {
+            createNode(mTail, nullptr, aValue);
+        }
+        else
+        {
+            mTail->insert(mTail->mCount, aValue);
+        }
+        mSize++;
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(TNodeCapacity) - items of the first node are shifted.
+     * @param aValue Value.
+     */
+    void pushFront(const T& aValue)
+    {
+        if ((mBegin == nullptr) || mBegin->full())
+        {
+            createNode(nullptr, mBegin, aValue);
+        }
+        else
+        {
+            mBegin->insert(0, aValue);
+        }
+        mSize++;
+    }
+
+    /**
+     * @brief Removes last item from list.
+     * Complexity: O(1)
+     * @return Last item from list.
+     */
+    T popBack()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return eraseFromNode(mTail, mTail->mCount - 1u);
+    }
+
+    /**
+     * @brief Remove the first element from the list.
+     * Complexity: O(TNodeCapacity) - items of the first node are shifted.
+     * @return The first item from list.
+     */
+    T popFront()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return eraseFromNode(mBegin, 0);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        for (const Node* node = mBegin; node != nullptr; node = node->mNext)
+        {
+            const T* items = node->values();
+            for (std::size_t i = 0; i < node->mCount; i++)
+            {
+                if (items[i] == aValue)
+                {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Get pointer to the value at given position.
+     * Complexity: O(n / TNodeCapacity) - whole nodes are skipped, starting from the closer end.
+     * @param aIndex Position of value.
+     * @return Pointer to value or null if there isn't value at given position.
+     */
+    const T* get(const uintmax_t aIndex) const
+    {
+        if (aIndex >= mSize)
+        {
+            return nullptr;
+        }
+
+        std::size_t position = 0;
+        const Node* node = findNode(aIndex, position);
+        return node->values() + position;
+    }
+
+    /**
+     * @brief Inserts value at given position. Full node is split in two halves.
+     * Complexity: O(n / TNodeCapacity + TNodeCapacity)
+     * @param aIndex Position of value. Must be lower than size.
+     * @param aValue Value to insert.
+     */
+    void insert(const uintmax_t aIndex, const T& aValue)
+    {
+        if (aIndex == 0)
+        {
+            pushFront(aValue);
+        }
+        else if (aIndex < mSize)
+        {
+            std::size_t position = 0;
+            Node* node = findNode(aIndex, position);
+            if (node->full())
+            {
+                const std::size_t half = TNodeCapacity / 2u;
+                Node* splitNode = createNode(node, node->mNext);
+                node->moveTail(half, *splitNode);
+                if (position >= half)
+                {
+                    node = splitNode;
+                    position -= half;
+                }
+            }
+            node->insert(position, aValue);
+            mSize++;
+        }
+    }
+
+    /**
+     * @brief Removes value at given position. Node which drops below half of capacity
+     * is merged with a neighbour if they fit into one node.
+     * Complexity: O(n / TNodeCapacity + TNodeCapacity)
+     * @param aIndex Position of value. Must be lower than size.
+     * @return Removed value.
+     */
+    T eraseAt(const uintmax_t aIndex)
+    {
+        if (aIndex >= mSize)
+        {
+            throw std::out_of_range("Try to delete item out of List");
+        }
+
+        std::size_t position = 0;
+        Node* node = findNode(aIndex, position);
+        return eraseFromNode(node, position);
+    }
+
+    /**
+     * @brief Returns a random access iterator that points to the beginning.
+     * @return Iterator to the beginning.
+     */
+    DIterator begin() const
+    {
+        return DIterator(mBegin, 0);
+    }
+
+    /**
+     * @brief Returns a random access iterator that points to the item after the last one.
+     * @return Iterator to the item after the last one.
+     */
+    DIterator end() const
+    {
+        return DIterator(nullptr, 0);
+    }
+
+    /**
+     * @brief Returns a reverse random access iterator that points to the last item.
+     * @return Reverse iterator to the last item.
+     */
+    DReverseIterator rbegin() const
+    {
+        return DReverseIterator(mTail, (mTail != nullptr) ? mTail->mCount - 1u : 0);
+    }
+
+    /**
+     * @brief Returns a reverse random access iterator that points to the item before the first one.
+     * @return Reverse iterator to the item before the first one.
+     */
+    DReverseIterator rend() const
+    {
+        return DReverseIterator(nullptr, 0);
+    }
+
+private:
+
+    using NodeAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Node>;
+    using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+    /**
+     * @brief Allocator of nodes.
+     */
+    NodeAllocator mAllocator;
+
+    /**
+     * @brief Pointer to the first node of the list.
+     */
+    Node* mBegin;
+
+    /**
+     * @brief Pointer to the last node of the list.
+     */
+    Node* mTail;
+
+    /**
+     * @brief Number of items.
+     */
+    uintmax_t mSize;
+
+    /**
+     * @brief Allocates empty node and links it between given nodes.
+     * @param aPrevious Previous node or null.
+     * @param aNext Next node or null.
+     * @return Pointer to the new node.
+     */
+    Node* createNode(Node* const aPrevious, Node* const aNext)
+    {
+        Node* node = NodeTraits::allocate(mAllocator, 1);
+        NodeTraits::construct(mAllocator, node, aPrevious, aNext);
+        linkNode(node);
+        return node;
+    }
+
+    /**
+     * @brief Allocates node holding given value and links it between given nodes.
+     * The list is unchanged if the value can't be copied.
+     * @param aPrevious Previous node or null.
+     * @param aNext Next node or null.
+     * @param aValue Value.
+     * @return Pointer to the new node.
+     */
+    Node* createNode(Node* const aPrevious, Node* const aNext, const T& aValue)
+    {
+        Node* node = NodeTraits::allocate(mAllocator, 1);
+        NodeTraits::construct(mAllocator, node, aPrevious, aNext);
+        try
+        {
+            node->insert(0, aValue);
+        }
+        catch (...)
+        {
+            NodeTraits::destroy(mAllocator, node);
+            NodeTraits::deallocate(mAllocator, node, 1);
+            throw;
+        }
+        linkNode(node);
+        return node;
+    }
+
+    /**
+     * @brief Links node between its previous and next node.
+     * @param aNode Node with set pointers to previous and next node.
+     */
+    void linkNode(Node* const aNode)
+    {
+        if (aNode->mPrevious != nullptr)
+        {
+            aNode->mPrevious->mNext = aNode;
+        }
+        else
+        {
+            mBegin = aNode;
+        }
+
+        if (aNode->mNext != nullptr)
+        {
+            aNode->mNext->mPrevious = aNode;
+        }
+        else
+        {
+            mTail = aNode;
+        }
+    }
+
+    /**
+     * @brief Unlinks node from the list and releases it.
+     * @param aNode Node to remove.
+     */
+    void destroyNode(Node* const aNode)
+    {
+        if (aNode->mPrevious != nullptr)
+        {
+            aNode->mPrevious->mNext = aNode->mNext;
+        }
+        else
+        {
+            mBegin = aNode->mNext;
+        }
+
+        if (aNode->mNext != nullptr)
+        {
+            aNode->mNext->mPrevious = aNode->mPrevious;
+        }
+        else
+        {
+            mTail = aNode->mPrevious;
+        }
+
+        NodeTraits::destroy(mAllocator, aNode);
+        NodeTraits::deallocate(mAllocator, aNode, 1);
+    }
+
+    /**
+     * @brief Finds node which holds item at given index. Starts from the closer end of the list.
+     * @param aIndex Index of item, must be lower than size.
+     * @param aPosition Output, position of item in the node.
+     * @return Node with the item.
+     */
+    Node* findNode(const uintmax_t aIndex, std::size_t& aPosition) const
+    {
+        if (aIndex < mSize / 2u)
+        {
+            uintmax_t first = 0;
+            Node* node = mBegin;
+            while (aIndex >= first + node->mCount)
+            {
+                first += node->mCount;
+                node = node->mNext;
+            }
+            aPosition = static_cast<std::size_t>(aIndex - first);
+            return node;
+        }
+
+        uintmax_t first = mSize - mTail->mCount;
+        Node* node = mTail;
+        while (aIndex < first)
+        {
+            node = node->mPrevious;
+            first -= node->mCount;
+        }
+        aPosition = static_cast<std::size_t>(aIndex - first);
+        return node;
+    }
+
+    /**
+     * @brief Removes item from node, releases node if it becomes empty
+     * or merges it with a neighbour if it becomes less than half full.
+     * @param aNode Node with item.
+     * @param aPosition Position of item in the node.
+     * @return Removed value.
+     */
+    T eraseFromNode(Node* const aNode, const std::size_t aPosition)
+    {
+        T returnItem = aNode->erase(aPosition);
+        mSize--;
+
+        if (aNode->mCount == 0)
+        {
+            destroyNode(aNode);
+        }
+        else if (aNode->mCount < TNodeCapacity / 2u)
+        {
+            if ((aNode->mNext != nullptr) && (aNode->mCount + aNode->mNext->mCount <= TNodeCapacity))
+            {
+                Node* next = aNode->mNext;
+                next->moveTail(0, *aNode);
+                destroyNode(next);
+            }
+            else if ((aNode->mPrevious != nullptr) && (aNode->mCount + aNode->mPrevious->mCount <= TNodeCapacity))
+            {
+                aNode->moveTail(0, *aNode->mPrevious);
+                destroyNode(aNode);
+            }
+        }
+        return returnItem;
+    }
+
+    /**
+     * @brief Method which at all clear List
+     */
+    void ClearList()
+    {
+        while (mBegin != nullptr)
+        {
+            destroyNode(mBegin);
+        }
+        mSize = 0;
+    }
+};
+
+#endif
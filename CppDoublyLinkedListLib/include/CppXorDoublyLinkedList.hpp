@@ -0,0 +1,591 @@
+#ifndef CPP_XOR_DOUBLY_LINKED_LIST_HPP_
+#define CPP_XOR_DOUBLY_LINKED_LIST_HPP_
+
+/*----------------------------------------------------------------------
+                                Include
+ *----------------------------------------------------------------------*/
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "CppDoublyLinkedListPool.hpp"
+
+/**
+ * @brief XOR-linked Doubly Linked List. Every item keeps one link - address of previous item XOR address
+ * of next item - instead of two pointers, which saves one pointer per item. A neighbour is found from
+ * the other neighbour, so iterators carry the previous item along and items cannot be reached
+ * from a pointer to them alone. Iteration in both directions starts from the beginning or the end.
+ * It has the push/pop/iterate interface of CDoublyLinkedList.
+ * @tparam T Type of items.
+ * @tparam TAllocator Allocator of items.
+ */
+template<typename T, typename TAllocator = CDoublyLinkedListPoolAllocator<T>>
+class CXorDoublyLinkedList
+{
+    /*----------------------------------------------------------------------
+                                Helper Classes
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief List item. Holds value and the XOR of addresses of both neighbours.
+     */
+    class CXorDoublyLinkedListItem
+    {
+    public:
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        template<typename... TArgs>
+        explicit CXorDoublyLinkedListItem(uintptr_t aLink, TArgs&&... aArgs)
+            : mLink(aLink)
+            , mValue(std::forward<TArgs>(aArgs)...)
+        {}
+
+        /**
+         * @brief Address of previous item XOR address of next item.
+         */
+        uintptr_t mLink;
+
+        /**
+         * @brief Value.
+         */
+        T mValue;
+    };
+
+    using Item = CXorDoublyLinkedListItem;
+
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+    // /////////////////////////////////////////////////////////////////////
+public:
+
+    /**
+     * @brief Iterator for XorDoublyLinked container. Moves away from the item it came from,
+     * so the same iterator walks forward from begin() and backward from rbegin().
+     */
+    class CXorDoublyLinkedListIterator
+    {
+        /**
+         * @brief Item before the current one in the direction of iteration.
+         */
+        const Item* mPrevious;
+
+        /**
+         * @brief Pointer to data.
+         */
+        const Item* mPtr;
+
+    public:
+
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T*;
+        using reference = const T&;
+
+        /*----------------------------------------------------------------------
+                                Constructors & Destructors
+         *----------------------------------------------------------------------*/
+        CXorDoublyLinkedListIterator(const Item* aPrevious, const Item* aPtr)
+            : mPrevious(aPrevious)
+            , mPtr(aPtr)
+        {}
+
+        /*----------------------------------------------------------------------
+                                Overload operators
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief Operator increment
+         */
+        CXorDoublyLinkedListIterator& operator ++()
+        {
+            const Item* next = neighbour(mPtr, mPrevious);
+            mPrevious = mPtr;
+            mPtr = next;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post increment
+         */
+        CXorDoublyLinkedListIterator operator ++(int)
+        {
+            CXorDoublyLinkedListIterator it(*this);
+            ++(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator decrement. Works from end() too.
+         */
+        CXorDoublyLinkedListIterator& operator --()
+        {
+            const Item* previous = neighbour(mPrevious, mPtr);
+            mPtr = mPrevious;
+            mPrevious = previous;
+            return *this;
+        }
+
+        /**
+         * @brief Operator post decrement
+         */
+        CXorDoublyLinkedListIterator operator --(int)
+        {
+            CXorDoublyLinkedListIterator it(*this);
+            --(*this);
+            return it;
+        }
+
+        /**
+         * @brief Operator *
+         */
+        const T& operator*()const
+        {
+            return mPtr->mValue;
+        }
+
+        /**
+         * @brief Operator ->
+         */
+        const T* operator->()const
+        {
+            return &(mPtr->mValue);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator==(const CXorDoublyLinkedListIterator& alt)const
+        {
+            return (mPtr == alt.mPtr);
+        }
+
+        /**
+         * @brief Operator compare
+         */
+        bool operator!=(const CXorDoublyLinkedListIterator& alt)const
+        {
+            return !(*this == alt);
+        }
+
+        /*----------------------------------------------------------------------
+                                        Methods
+         *----------------------------------------------------------------------*/
+
+        /**
+         * @brief return value of iterator item;
+         */
+        const T& getValueItem()const
+        {
+            return mPtr->mValue;
+        }
+    };
+
+    using DIterator = CXorDoublyLinkedListIterator;
+    using DReverseIterator = CXorDoublyLinkedListIterator;
+
+    /*----------------------------------------------------------------------
+                           Constructors & Destructors
+     *----------------------------------------------------------------------*/
+    CXorDoublyLinkedList()
+        : CXorDoublyLinkedList(TAllocator())
+    {}
+
+    explicit CXorDoublyLinkedList(const TAllocator& aAllocator)
+        : mAllocator(aAllocator)
+        , mBegin(nullptr)
+        , mTail(nullptr)
+        , mSize(0)
+    {}
+
+    CXorDoublyLinkedList(const CXorDoublyLinkedList& aObj)
+        : CXorDoublyLinkedList(TAllocator(ItemTraits::select_on_container_copy_construction(aObj.mAllocator)))
+    {
+        for (const T& value : aObj)
+        {
+            pushBack(value);
+        }
+    }
+
+    CXorDoublyLinkedList(CXorDoublyLinkedList&& aObj) noexcept
+        : mAllocator(std::move(aObj.mAllocator))
+        , mBegin(aObj.mBegin)
+        , mTail(aObj.mTail)
+        , mSize(aObj.mSize)
+    {
+        aObj.IniEmptyList();
+    }
+
+    ~CXorDoublyLinkedList()
+    {
+        ClearList();
+    }
+
+    /*----------------------------------------------------------------------
+                                Overload operators
+     *----------------------------------------------------------------------*/
+
+    CXorDoublyLinkedList& operator=(const CXorDoublyLinkedList& aObj)
+    {
+        if (this != &aObj)
+        {
+            ClearList();
+            for (const T& value : aObj)
+            {
+                pushBack(value);
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Compares lists
+     */
+    bool operator==(const CXorDoublyLinkedList& aObj) const
+    {
+        if (mSize != aObj.mSize)
+        {
+            return false;
+        }
+        for (DIterator thisIt = begin(), aObjIt = aObj.begin(); thisIt != end(); ++thisIt, ++aObjIt)
+        {
+            if (*thisIt != *aObjIt)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Compare operator
+     */
+    bool operator!=(const CXorDoublyLinkedList& aObj) const
+    {
+        return !(*this == aObj);
+    }
+
+    /*----------------------------------------------------------------------
+                                Methods
+     *----------------------------------------------------------------------*/
+
+    /**
+     * @brief Returns a number of items.
+     * Complexity: O(1)
+     * @return Number of items.
+     */
+    uintmax_t size() const
+    {
+        return mSize;
+    }
+
+    /**
+     * @brief Indicates if the list empty.
+     * Complexity: O(1)
+     * @return true if list is empty, otherwise false.
+     */
+    bool empty() const
+    {
+        return (mSize == 0);
+    }
+
+    /**
+     * @brief Adds value to list.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     */
+    void pushBack(const T& aValue)
+    {
+        emplaceBack(aValue);
+    }
+
+    /**
+     * @brief Adds value to list. The value is moved into the list.
+     * Complexity: O(1)
+     * @param aValue Value to add.
+     */
+    void pushBack(T&& aValue)
+    {
+        emplaceBack(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value in place at the end of the list.
+     * Complexity: O(1)
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceBack(TArgs&&... aArgs)
+    {
+        Item* item = createItem(address(mTail), std::forward<TArgs>(aArgs)...);
+        if (mTail != nullptr)
+        {
+            mTail->mLink ^= address(item);
+        }
+        else
+        {
+            mBegin = item;
+        }
+        mTail = item;
+        mSize++;
+        return item->mValue;
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list.
+     * Complexity: O(1)
+     * @param aValue Value.
+     */
+    void pushFront(const T& aValue)
+    {
+        emplaceFront(aValue);
+    }
+
+    /**
+     * @brief Puts new item at the beginning of the list. The value is moved into the list.
+     * Complexity: O(1)
+     * @param aValue Value.
+     */
+    void pushFront(T&& aValue)
+    {
+        emplaceFront(std::move(aValue));
+    }
+
+    /**
+     * @brief Constructs value in place at the beginning of the list.
+     * Complexity: O(1)
+     * @param aArgs Arguments passed to the constructor of value.
+     * @return Reference to the new value.
+     */
+    template<typename... TArgs>
+    T& emplaceFront(TArgs&&... aArgs)
+    {
+        Item* item = createItem(address(mBegin), std::forward<TArgs>(aArgs)...);
+        if (mBegin != nullptr)
+        {
+            mBegin->mLink ^= address(item);
+        }
+        else
+        {
+            mTail = item;
+        }
+        mBegin = item;
+        mSize++;
+        return item->mValue;
+    }
+
+    /**
+     * @brief Removes last item from list. The value is moved out of the list.
+     * Complexity: O(1)
+     * @return Last item from list.
+     */
+    T popBack()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return popEnd(mTail, mBegin);
+    }
+
+    /**
+     * @brief Remove the first element from the list. The value is moved out of the list.
+     * Complexity: O(1)
+     * @return The first item from list.
+     */
+    T popFront()
+    {
+        if (empty())
+        {
+            throw std::out_of_range("Try to delete item from empty List");
+        }
+        return popEnd(mBegin, mTail);
+    }
+
+    /**
+     * @brief Checks the list contains object.
+     * Complexity: O(n)
+     * @param aValue Value to check.
+     * @return true if list contains value, otherwise false.
+     */
+    bool contains(const T& aValue) const
+    {
+        for (const T& value : *this)
+        {
+            if (value == aValue)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Returns iterator to the first item.
+     */
+    DIterator begin() const
+    {
+        return DIterator(nullptr, mBegin);
+    }
+
+    /**
+     * @brief Returns iterator behind the last item. Can be decremented.
+     */
+    DIterator end() const
+    {
+        return DIterator(mTail, nullptr);
+    }
+
+    /**
+     * @brief Returns iterator to the last item, which walks towards the beginning.
+     */
+    DReverseIterator rbegin() const
+    {
+        return DReverseIterator(nullptr, mTail);
+    }
+
+    /**
+     * @brief Returns reverse iterator before the first item.
+     */
+    DReverseIterator rend() const
+    {
+        return DReverseIterator(mBegin, nullptr);
+    }
+
+    /**
+     * @brief Returns allocator of the list.
+     */
+    TAllocator get_allocator() const
+    {
+        return TAllocator(mAllocator);
+    }
+
+private:
+
+    using ItemAllocator = typename std::allocator_traits<TAllocator>::template rebind_alloc<Item>;
+    using ItemTraits = std::allocator_traits<ItemAllocator>;
+
+    /**
+     * @brief Allocator of items.
+     */
+    ItemAllocator mAllocator;
+
+    /**
+     * @brief Pointer to the first item.
+     */
+    Item* mBegin;
+
+    /**
+     * @brief Pointer to the last item.
+     */
+    Item* mTail;
+
+    /**
+     * @brief Number of items.
+     */
+    uintmax_t mSize;
+
+    /**
+     * @brief Returns address of item as integer.
+     */
+    static uintptr_t address(const Item* aItem)
+    {
+        return reinterpret_cast<uintptr_t>(aItem);
+    }
+
+    /**
+     * @brief Returns neighbour of item on the other side than given neighbour.
+     */
+    static const Item* neighbour(const Item* aItem, const Item* aOther)
+    {
+        return reinterpret_cast<const Item*>(aItem->mLink ^ address(aOther));
+    }
+
+    /**
+     * @brief Removes item at one end of list.
+     * @param aEnd End to remove from, mBegin or mTail.
+     * @param aOtherEnd Opposite end.
+     */
+    T popEnd(Item*& aEnd, Item*& aOtherEnd)
+    {
+        Item* item = aEnd;
+        // the only neighbour of an end item is its whole link
+        Item* inner = reinterpret_cast<Item*>(item->mLink);
+        T returnItem = std::move(item->mValue);
+        if (inner != nullptr)
+        {
+            inner->mLink ^= address(item);
+        }
+        else
+        {
+            aOtherEnd = nullptr;
+        }
+        aEnd = inner;
+        mSize--;
+        destroyItem(item);
+        return returnItem;
+    }
+
+    /**
+     * @brief Allocates item and constructs value in it.
+     */
+    template<typename... TArgs>
+    Item* createItem(uintptr_t aLink, TArgs&&... aArgs)
+    {
+        Item* item = ItemTraits::allocate(mAllocator, 1);
+        try
+        {
+            ItemTraits::construct(mAllocator, item, aLink, std::forward<TArgs>(aArgs)...);
+        }
+        catch (...)
+        {
+            ItemTraits::deallocate(mAllocator, item, 1);
+            throw;
+        }
+        return item;
+    }
+
+    /**
+     * @brief Destroys and frees item.
+     */
+    void destroyItem(Item* aItem)
+    {
+        ItemTraits::destroy(mAllocator, aItem);
+        ItemTraits::deallocate(mAllocator, aItem, 1);
+    }
+
+    /**
+     * @brief Method for initialization empty List
+     */
+    void IniEmptyList()
+    {
+        mBegin = nullptr;
+        mTail = nullptr;
+        mSize = 0;
+    }
+
+    /**
+     * @brief Method which at all clear List
+     */
+    void ClearList()
+    {
+        const Item* previous = nullptr;
+        Item* item = mBegin;
+        while (item != nullptr)
+        {
+            Item* next = const_cast<Item*>(neighbour(item, previous));
+            previous = item;
+            destroyItem(item);
+            item = next;
+        }
+        IniEmptyList();
+    }
+};
+
+#endif
@@ -0,0 +1,182 @@
+#include <include/CppConcurrentDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <deque>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Test base class.
+ */
+class CConcurrentContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CConcurrentContainerTest, empty)
+{
+    CConcurrentDoublyLinkedList<int> container;
+    int value = 7;
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.tryPopFront(value));
+    ASSERT_FALSE(container.tryPopBack(value));
+    ASSERT_EQ(value, 7);
+
+    container.pushBack(1);
+    ASSERT_FALSE(container.empty());
+    ASSERT_TRUE(container.tryPopBack(value));
+    ASSERT_EQ(value, 1);
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for random pushes and pops on both ends compared with std::deque, from one thread.
+ */
+TEST_F(CConcurrentContainerTest, randomOperations)
+{
+    CConcurrentDoublyLinkedList<std::string> container;
+    std::deque<std::string> expected;
+    std::srand(11);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int operation = std::rand() % 4;
+        const std::string text = "value number " + std::to_string(i);
+        std::string value;
+        if (operation == 0)
+        {
+            container.pushBack(text);
+            expected.push_back(text);
+        }
+        else if (operation == 1)
+        {
+            container.pushFront(text);
+            expected.push_front(text);
+        }
+        else if (operation == 2)
+        {
+            ASSERT_EQ(container.tryPopFront(value), !expected.empty());
+            if (!expected.empty())
+            {
+                ASSERT_EQ(value, expected.front());
+                expected.pop_front();
+            }
+        }
+        else
+        {
+            ASSERT_EQ(container.tryPopBack(value), !expected.empty());
+            if (!expected.empty())
+            {
+                ASSERT_EQ(value, expected.back());
+                expected.pop_back();
+            }
+        }
+        ASSERT_EQ(container.empty(), expected.empty());
+    }
+    // remaining values are destroyed by the container
+}
+
+/**
+ * Test for many producers and consumers on both ends. Every value has to be taken exactly once.
+ */
+TEST_F(CConcurrentContainerTest, producersConsumers)
+{
+    const int threads = 4;
+    const int valuesPerThread = 20000;
+    CConcurrentDoublyLinkedList<int> container;
+    std::vector<std::atomic<int>> taken(threads * valuesPerThread);
+    for (std::atomic<int>& count : taken)
+    {
+        count.store(0);
+    }
+    std::atomic<int> remaining(threads * valuesPerThread);
+
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&container, thread, valuesPerThread]()
+        {
+            for (int i = 0; i < valuesPerThread; ++i)
+            {
+                const int value = thread * valuesPerThread + i;
+                if ((value % 2) == 0)
+                {
+                    container.pushBack(value);
+                }
+                else
+                {
+                    container.pushFront(value);
+                }
+            }
+        });
+        workers.emplace_back([&container, &taken, &remaining, thread]()
+        {
+            int value = 0;
+            while (remaining.load() > 0)
+            {
+                const bool popped = ((thread % 2) == 0) ? container.tryPopFront(value) : container.tryPopBack(value);
+                if (popped)
+                {
+                    taken[value].fetch_add(1);
+                    remaining.fetch_sub(1);
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    ASSERT_TRUE(container.empty());
+    for (const std::atomic<int>& count : taken)
+    {
+        ASSERT_EQ(count.load(), 1);
+    }
+}
+
+/**
+ * Test that pushBack from several threads keeps order of every thread when read from the front.
+ */
+TEST_F(CConcurrentContainerTest, orderPerProducer)
+{
+    const int threads = 3;
+    const int valuesPerThread = 10000;
+    CConcurrentDoublyLinkedList<int> container;
+
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&container, thread, valuesPerThread]()
+        {
+            for (int i = 0; i < valuesPerThread; ++i)
+            {
+                container.pushBack(thread * valuesPerThread + i);
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::vector<int> last(threads, -1);
+    int value = 0;
+    int count = 0;
+    while (container.tryPopFront(value))
+    {
+        const int thread = value / valuesPerThread;
+        ASSERT_LT(last[thread], value);
+        last[thread] = value;
+        ++count;
+    }
+    ASSERT_EQ(count, threads * valuesPerThread);
+}
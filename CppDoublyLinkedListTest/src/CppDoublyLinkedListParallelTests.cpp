@@ -0,0 +1,217 @@
+#include <include/CppDoublyLinkedList.hpp>
+#include <include/CppDoublyLinkedListParallel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Test base class.
+ */
+class CParallelContainerTest : public Test
+{
+};
+
+/**
+ * Test that every task of a batch runs exactly once and that errors of tasks are rethrown.
+ */
+TEST_F(CParallelContainerTest, threadPool)
+{
+    CDoublyLinkedListThreadPool pool(4u);
+    ASSERT_EQ(pool.size(), 4u);
+    for (std::size_t round = 0; round < 50u; ++round)
+    {
+        std::vector<std::atomic<int>> runs(round);
+        pool.run(round, [&runs](std::size_t aNumber) { runs[aNumber]++; });
+        ASSERT_TRUE(std::all_of(runs.begin(), runs.end(), [](const std::atomic<int>& aRuns) { return aRuns == 1; }));
+    }
+
+    std::atomic<int> runs(0);
+    ASSERT_THROW(pool.run(10u, [&runs](std::size_t aNumber)
+    {
+        runs++;
+        if (aNumber % 3u == 0u)
+        {
+            throw std::runtime_error("task failed");
+        }
+    }), std::runtime_error);
+    ASSERT_EQ(runs, 10);
+
+    CDoublyLinkedListThreadPool single(1u);
+    ASSERT_EQ(single.size(), 1u);
+    pool.run(1u, [&runs](std::size_t) { runs++; });
+    ASSERT_EQ(runs, 11);
+}
+
+/**
+ * Test that segments cover the list once and in order.
+ */
+TEST_F(CParallelContainerTest, segments)
+{
+    CDoublyLinkedList<unsigned int> container;
+    CDoublyLinkedListSegments emptySegments(container);
+    ASSERT_EQ(emptySegments.size(), 0u);
+
+    const unsigned int size = 5u * CDoublyLinkedListSegments<CDoublyLinkedList<unsigned int>::DIterator>::cMinItems + 3u;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+    }
+    CDoublyLinkedListSegments segments(container);
+    ASSERT_EQ(segments.size(), 6u);
+    unsigned int expected = 0u;
+    for (std::size_t segment = 0; segment < segments.size(); ++segment)
+    {
+        ASSERT_EQ(*segments.first(segment), expected);
+        expected += segments.items(segment);
+    }
+    ASSERT_EQ(expected, size);
+    ASSERT_TRUE(segments.last() == container.end());
+
+    // split points kept by the list are reused until the list changes
+    ASSERT_TRUE(container.splitPoints(segments.size()) == container.splitPoints(segments.size()));
+    const std::vector<CDoublyLinkedList<unsigned int>::DIterator> points = container.splitPoints(segments.size());
+    for (std::size_t segment = 0; segment < segments.size(); ++segment)
+    {
+        ASSERT_TRUE(points[segment] == segments.first(segment));
+    }
+    const auto check = [](const CDoublyLinkedList<unsigned int>& aContainer, const std::vector<unsigned int>& aExpected)
+    {
+        CDoublyLinkedListSegments changed(aContainer);
+        std::size_t position = 0u;
+        for (std::size_t segment = 0; segment < changed.size(); ++segment)
+        {
+            ASSERT_EQ(*changed.first(segment), aExpected[position]);
+            position += changed.items(segment);
+        }
+        ASSERT_EQ(position, aExpected.size());
+    };
+    std::vector<unsigned int> values(container.begin(), container.end());
+    container.pushFront(size);
+    values.insert(values.begin(), size);
+    check(container, values);
+    container.eraseAt(segments.items(0));
+    values.erase(values.begin() + segments.items(0));
+    check(container, values);
+    container.sort(std::greater<unsigned int>());
+    std::sort(values.begin(), values.end(), std::greater<unsigned int>());
+    check(container, values);
+    CDoublyLinkedList<unsigned int> other;
+    other.swap(container);
+    check(container, {});
+    check(other, values);
+}
+
+/**
+ * Test of the algorithms against their sequential counterparts, with different numbers of threads.
+ */
+TEST_F(CParallelContainerTest, algorithms)
+{
+    CDoublyLinkedList<unsigned int> container;
+    const unsigned int size = 200000u;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+    }
+
+    for (const std::size_t threads : {1u, 2u, 5u})
+    {
+        CDoublyLinkedListThreadPool pool(threads);
+
+        std::vector<unsigned char> visits(size, 0u);
+        parallelForEach(container, pool, [&visits](const unsigned int& aValue) { visits[aValue]++; });
+        ASSERT_TRUE(std::all_of(visits.begin(), visits.end(), [](unsigned char aVisits) { return aVisits == 1u; }));
+
+        const unsigned long long sum = parallelReduce(container, pool, 0ull,
+                                                      [](unsigned long long aSum, unsigned long long aValue) { return aSum + aValue; });
+        ASSERT_EQ(sum, std::accumulate(container.begin(), container.end(), 0ull));
+
+        ASSERT_EQ(parallelCountIf(container, pool, [](unsigned int aValue) { return aValue % 7u == 0u; }),
+                  std::count_if(container.begin(), container.end(), [](unsigned int aValue) { return aValue % 7u == 0u; }));
+
+        // the first match in list order is found even if later segments match too
+        auto found = parallelFindIf(container, pool, [](unsigned int aValue) { return aValue >= 150000u; });
+        ASSERT_TRUE(found != container.end());
+        ASSERT_EQ(*found, 150000u);
+        found = parallelFindIf(container, pool, [](unsigned int aValue) { return aValue % 40000u == 39999u; });
+        ASSERT_EQ(*found, 39999u);
+        ASSERT_EQ(*parallelFind(container, pool, 5u), 5u);
+        ASSERT_TRUE(parallelFind(container, pool, size) == container.end());
+    }
+}
+
+/**
+ * Test that algorithms work with other lists and update values in place if their iterators allow it,
+ * and that a list without lookup index updates values in place too.
+ */
+TEST_F(CParallelContainerTest, mutableValues)
+{
+    std::list<unsigned int> container(100000u, 2u);
+    CDoublyLinkedListThreadPool pool(3u);
+    parallelForEach(container, pool, [](unsigned int& aValue) { aValue *= 3u; });
+    ASSERT_EQ(parallelCountIf(container, pool, [](unsigned int aValue) { return aValue == 6u; }), container.size());
+    ASSERT_TRUE(parallelFind(container, pool, 2u) == container.end());
+
+    CDoublyLinkedList<unsigned int> list;
+    for (unsigned int i = 0; i < 100000u; ++i)
+    {
+        list.pushBack(i);
+    }
+    parallelForEach(list, pool, [](unsigned int& aValue) { aValue *= 3u; });
+    unsigned int expected = 0u;
+    for (const unsigned int value : list)
+    {
+        ASSERT_EQ(value, expected);
+        expected += 3u;
+    }
+    ASSERT_EQ(*parallelFind(list, pool, 3u * 99999u), 3u * 99999u);
+
+    // values of a list with lookup index are keys of the index, so they are passed as const
+    using CHashed = CDoublyLinkedList<unsigned int, CDoublyLinkedListPoolAllocator<unsigned int>, CHashLookupPolicy<>>;
+    using CUpdate = void (*)(unsigned int&);
+    using CRead = void (*)(const unsigned int&);
+    static_assert(CHasVisit<CDoublyLinkedList<unsigned int>, CUpdate>::value, "list without index is updated in place");
+    static_assert(!CHasVisit<const CDoublyLinkedList<unsigned int>, CUpdate>::value, "const list is read only");
+    static_assert(!CHasVisit<CHashed, CRead>::value, "list with index is read only");
+    CHashed hashed{1u, 2u, 3u};
+    std::atomic<unsigned int> sum(0u);
+    parallelForEach(hashed, pool, [&sum](const unsigned int& aValue) { sum += aValue; });
+    ASSERT_EQ(sum, 6u);
+}
+
+/**
+ * Test that reduction groups values the same way for any number of threads,
+ * so a non-associative operation gives the same result.
+ */
+TEST_F(CParallelContainerTest, deterministicReduce)
+{
+    CDoublyLinkedList<double> container;
+    for (unsigned int i = 0; i < 100000u; ++i)
+    {
+        container.pushBack(1.0 / (1.0 + i));
+    }
+    CDoublyLinkedListSegments segments(container);
+    auto sum = [](double aSum, double aValue) { return aSum + aValue; };
+
+    CDoublyLinkedListThreadPool single(1u);
+    const double expected = parallelReduce(segments, single, 0.0, sum);
+    for (const std::size_t threads : {2u, 3u, 8u})
+    {
+        CDoublyLinkedListThreadPool pool(threads);
+        for (int round = 0; round < 10; ++round)
+        {
+            ASSERT_EQ(parallelReduce(segments, pool, 0.0, sum), expected);
+        }
+    }
+
+    CDoublyLinkedList<std::string> words{"a", "b", "c"};
+    ASSERT_EQ(parallelReduce(words, single, std::string(">"), std::plus<std::string>()), ">abc");
+}
@@ -0,0 +1,136 @@
+#include <include/CppDoublyLinkedListSerialization.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+using namespace ::testing;
+
+/**
+ * @brief Value without padding, stored as its bytes.
+ */
+struct CPoint
+{
+    int mX;
+    int mY;
+
+    bool operator==(const CPoint& aOther) const
+    {
+        return (mX == aOther.mX) && (mY == aOther.mY);
+    }
+
+    bool operator!=(const CPoint& aOther) const
+    {
+        return !(*this == aOther);
+    }
+};
+
+/**
+ * @brief Test base class.
+ */
+class CSerializationContainerTest : public Test
+{
+};
+
+/**
+ * Test that trivially copyable values and strings are read back as they were written,
+ * and that values are appended to the list.
+ */
+TEST_F(CSerializationContainerTest, roundTrip)
+{
+    CDoublyLinkedList<CPoint> points;
+    // more values than one chunk
+    for (int i = 0; i < 20000; ++i)
+    {
+        points.pushBack({i, -i});
+    }
+    std::stringstream pointStream;
+    serialize(points, pointStream);
+    ASSERT_EQ(pointStream.str().size(), 24u + points.size() * sizeof(CPoint));
+    CDoublyLinkedList<CPoint> pointsCopy;
+    deserialize(pointsCopy, pointStream);
+    ASSERT_TRUE(pointsCopy == points);
+
+    CDoublyLinkedList<std::string> strings{"first", "", std::string(100000u, 'x'), "last"};
+    std::stringstream stringStream;
+    serialize(strings, stringStream);
+    // the stream is not read beyond the list
+    stringStream << "tail";
+    CDoublyLinkedList<std::string> stringsCopy{"existing"};
+    deserialize(stringsCopy, stringStream);
+    ASSERT_EQ(stringsCopy.size(), 5u);
+    ASSERT_EQ(stringsCopy.popFront(), "existing");
+    ASSERT_TRUE(stringsCopy == strings);
+    std::string tail;
+    stringStream >> tail;
+    ASSERT_EQ(tail, "tail");
+
+    CDoublyLinkedList<int> empty;
+    std::stringstream emptyStream;
+    serialize(empty, emptyStream);
+    deserialize(empty, emptyStream);
+    ASSERT_TRUE(empty.empty());
+}
+
+/**
+ * Test that damaged or foreign data is rejected and the list is left as it was.
+ */
+TEST_F(CSerializationContainerTest, invalidData)
+{
+    CDoublyLinkedList<int> numbers{1, 2, 3};
+    std::stringstream stream;
+    serialize(numbers, stream);
+    const std::string data = stream.str();
+
+    CDoublyLinkedList<int> target{7};
+    std::stringstream truncated(data.substr(0u, data.size() - 1u));
+    ASSERT_THROW(deserialize(target, truncated), std::runtime_error);
+    std::stringstream notList("not a list at all, just some text");
+    ASSERT_THROW(deserialize(target, notList), std::runtime_error);
+    std::string newer = data;
+    newer[4] = 2;
+    std::stringstream newerVersion(newer);
+    ASSERT_THROW(deserialize(target, newerVersion), std::runtime_error);
+    std::stringstream otherType(data);
+    CDoublyLinkedList<long long> longs;
+    ASSERT_THROW(deserialize(longs, otherType), std::runtime_error);
+    ASSERT_TRUE(longs.empty());
+    ASSERT_EQ(target.size(), 1u);
+    ASSERT_EQ(*target.begin(), 7);
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/**
+ * Test of writing to and reading from a file descriptor.
+ */
+TEST_F(CSerializationContainerTest, fileDescriptor)
+{
+    std::FILE* file = std::tmpfile();
+    ASSERT_NE(file, nullptr);
+    const int fd = fileno(file);
+
+    CDoublyLinkedList<double> numbers;
+    for (int i = 0; i < 50000; ++i)
+    {
+        numbers.pushFront(i * 0.5);
+    }
+    CDoublyLinkedList<std::string> strings{"one", "two", "three"};
+    serialize(numbers, fd);
+    serialize(strings, fd);
+    ASSERT_EQ(lseek(fd, 0, SEEK_SET), 0);
+
+    CDoublyLinkedList<double> numbersCopy;
+    deserialize(numbersCopy, fd);
+    ASSERT_TRUE(numbersCopy == numbers);
+    std::fclose(file);
+
+    ASSERT_THROW(serialize(strings, -1), std::runtime_error);
+    ASSERT_THROW(deserialize(numbersCopy, -1), std::runtime_error);
+    ASSERT_EQ(numbersCopy.size(), numbers.size());
+}
+
+#endif
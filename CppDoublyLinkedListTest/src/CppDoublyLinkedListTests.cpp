@@ -2,6 +2,16 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 using namespace ::testing;
 
 /**
@@ -339,6 +349,21 @@ TEST_P(CContainerParamTest, insert)
             ASSERT_EQ(*prevValueActual, prevValueExpected);
         }
     }
+
+    // position 0 inserts also into an empty list, positions behind the end are ignored
+    CDoublyLinkedList<int> empty;
+    empty.insert(1, 1);
+    ASSERT_TRUE(empty.empty());
+    const int value = 2;
+    empty.insert(0, value);
+    empty.insert(0, 1);
+    ASSERT_EQ(empty.size(), 2u);
+    ASSERT_EQ(*empty.get(0), 1);
+    ASSERT_EQ(*empty.get(1), 2);
+    CDoublyLinkedList<std::unique_ptr<int>> moved;
+    moved.insert(0, std::unique_ptr<int>(new int(size)));
+    ASSERT_EQ(moved.size(), 1u);
+    ASSERT_EQ(**moved.begin(), static_cast<int>(size));
 }
 
 /**
@@ -426,6 +451,1097 @@ TEST_P(CContainerParamTest, ruleOf3)
     ASSERT_TRUE(containerA1 == containerD1);
 
 }
+
+/**
+ * Test for list which allocates items on the global heap instead of the pool.
+ */
+TEST_P(CContainerParamTest, heapAllocator)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<int, std::allocator<int>> container;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        container.pushBack(j);
+        container.pushFront(-static_cast<int>(j) - 1);
+    }
+    ASSERT_EQ(container.size(), 2u * size);
+
+    CDoublyLinkedList<int, std::allocator<int>> containerCopy(container);
+    ASSERT_TRUE(containerCopy == container);
+
+    for (unsigned int j = size; j > 0; --j)
+    {
+        ASSERT_EQ(container.popBack(), static_cast<int>(j - 1));
+        ASSERT_EQ(container.popFront(), -static_cast<int>(j));
+    }
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for reusing pool items released by pop methods.
+ */
+TEST_P(CContainerParamTest, poolReuse)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<int> container;
+    for (unsigned int round = 0; round < 3u; ++round)
+    {
+        for (unsigned int j = 0; j < size; ++j)
+        {
+            container.pushBack(j + round);
+        }
+        for (unsigned int j = 0; j < size; ++j)
+        {
+            ASSERT_EQ(*container.get(j), static_cast<int>(j + round));
+        }
+        for (unsigned int j = 0; j < size; ++j)
+        {
+            ASSERT_EQ(container.popFront(), static_cast<int>(j + round));
+        }
+        ASSERT_TRUE(container.empty());
+    }
+}
+
+/**
+ * Test for list which takes items from a memory resource.
+ */
+TEST_P(CContainerParamTest, pmrAllocator)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    std::pmr::monotonic_buffer_resource resource;
+    CPmrDoublyLinkedList<int> container(&resource);
+    ASSERT_EQ(container.get_allocator().resource(), &resource);
+
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        container.pushBack(j);
+    }
+
+    CPmrDoublyLinkedList<int> containerCopy(container, &resource);
+    ASSERT_EQ(containerCopy.get_allocator().resource(), &resource);
+    ASSERT_TRUE(containerCopy == container);
+
+    CPmrDoublyLinkedList<int> containerAssigned;
+    containerAssigned = container;
+    ASSERT_EQ(containerAssigned.get_allocator().resource(), std::pmr::get_default_resource());
+    ASSERT_TRUE(containerAssigned == container);
+
+    // memory is reclaimed by the resource
+    container.release();
+    containerCopy.release();
+    ASSERT_TRUE(container.empty());
+    ASSERT_EQ(container.get(0), nullptr);
+
+    container.pushBack(1);
+    ASSERT_EQ(*container.get(0), 1);
+    container.release();
+}
+
+/**
+ * Test for assigning an empty list.
+ */
+TEST_P(CContainerParamTest, assignEmpty)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<int> container;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        container.pushBack(j);
+    }
+    container = container;
+    ASSERT_EQ(container.size(), size);
+
+    container = CDoublyLinkedList<int>();
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for moving values into and out of the list and for constructing them in place.
+ */
+TEST_P(CContainerParamTest, move_emplace)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<std::unique_ptr<int>> container;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        std::unique_ptr<int> value(new int(j));
+        container.pushBack(std::move(value));
+        ASSERT_EQ(value, nullptr);
+    }
+    container.pushFront(std::unique_ptr<int>(new int(-1)));
+    container.insert(1, std::unique_ptr<int>(new int(-2)));
+    const int& emplacedBack = *container.emplaceBack(new int(100));
+    ASSERT_EQ(emplacedBack, 100);
+    const int& emplacedFront = *container.emplaceFront(new int(-100));
+    ASSERT_EQ(emplacedFront, -100);
+
+    typename CDoublyLinkedList<std::unique_ptr<int>>::DIterator it = container.emplace(container.begin() + 3, new int(-3));
+    ASSERT_EQ(**it, -3);
+    it = container.emplace(container.end(), new int(101));
+    ASSERT_EQ(**it, 101);
+    ASSERT_EQ(container.size(), size + 6u);
+
+    ASSERT_EQ(*container.popFront(), -100);
+    ASSERT_EQ(*container.popFront(), -1);
+    ASSERT_EQ(*container.popFront(), -2);
+    ASSERT_EQ(*container.popFront(), -3);
+    ASSERT_EQ(*container.popBack(), 101);
+    ASSERT_EQ(*container.popBack(), 100);
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        std::unique_ptr<int> value = container.popFront();
+        ASSERT_EQ(*value, static_cast<int>(j));
+    }
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for constructing strings in place.
+ */
+TEST_P(CContainerParamTest, emplaceString)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<std::string> container;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        container.emplaceBack(j + 1u, 'a');
+    }
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        ASSERT_EQ(*container.get(j), std::string(j + 1u, 'a'));
+    }
+    container.emplace(container.begin() + (size / 2u), "middle");
+    ASSERT_EQ(*container.get(size / 2u), "middle");
+}
+
+/**
+ * Test for move constructor, move assignment and swap.
+ */
+TEST_P(CContainerParamTest, ruleOf5)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CDoublyLinkedList<int> containerA1;
+    CDoublyLinkedList<int> containerB1;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        containerA1.pushBack(j);
+        containerB1.pushBack(100 * j + 999);
+    }
+    const CDoublyLinkedList<int> containerA2(containerA1);
+    const CDoublyLinkedList<int> containerB2(containerB1);
+    const int* firstA = containerA1.get(0);
+
+    // move constructor takes over items
+    CDoublyLinkedList<int> containerC1(std::move(containerA1));
+    ASSERT_TRUE(containerA1.empty());
+    ASSERT_TRUE(containerC1 == containerA2);
+    ASSERT_EQ(containerC1.get(0), firstA);
+
+    // moved-from list is usable
+    containerA1.pushBack(1);
+    ASSERT_EQ(*containerA1.get(0), 1);
+
+    // move assignment
+    containerA1 = std::move(containerC1);
+    ASSERT_TRUE(containerC1.empty());
+    ASSERT_TRUE(containerA1 == containerA2);
+    ASSERT_EQ(containerA1.get(0), firstA);
+
+    // swap
+    swap(containerA1, containerB1);
+    ASSERT_TRUE(containerA1 == containerB2);
+    ASSERT_TRUE(containerB1 == containerA2);
+    containerA1.swap(containerB1);
+    ASSERT_TRUE(containerA1 == containerA2);
+    ASSERT_TRUE(containerB1 == containerB2);
+
+    // lists in a vector are moved on reallocation
+    std::vector<CDoublyLinkedList<int>> lists;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        lists.push_back(containerA2);
+    }
+    for (const CDoublyLinkedList<int>& list : lists)
+    {
+        ASSERT_TRUE(list == containerA2);
+    }
+}
+
+/**
+ * Test for move assignment between lists on different memory resources.
+ */
+TEST_P(CContainerParamTest, moveAssignPmr)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    std::pmr::unsynchronized_pool_resource resourceA;
+    std::pmr::unsynchronized_pool_resource resourceB;
+    CPmrDoublyLinkedList<std::string> containerA(&resourceA);
+    CPmrDoublyLinkedList<std::string> containerB(&resourceB);
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        containerA.pushBack(std::to_string(j));
+    }
+
+    containerB = std::move(containerA);
+    ASSERT_TRUE(containerA.empty());
+    ASSERT_EQ(containerB.get_allocator().resource(), &resourceB);
+    ASSERT_EQ(containerB.size(), size);
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        ASSERT_EQ(*containerB.get(j), std::to_string(j));
+    }
+}
+
+/**
+ * Test for eraseAt method
+ */
+TEST_P(CContainerParamTest, eraseAt)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        CDoublyLinkedList<int> container;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+        }
+
+        ASSERT_EQ(container.eraseAt(j), static_cast<int>(j));
+        ASSERT_EQ(container.size(), size - 1u);
+        for (unsigned int i = 0; i < size - 1u; ++i)
+        {
+            const int valueExpected = (i < j) ? i : i + 1;
+            ASSERT_EQ(*container.get(i), valueExpected);
+        }
+        ASSERT_EQ(*container.rbegin(), (j == size - 1u) ? static_cast<int>(size - 2u) : static_cast<int>(size - 1u));
+    }
+    CDoublyLinkedList<int> container;
+    ASSERT_THROW(container.eraseAt(0), std::out_of_range);
+}
+
+/**
+ * Test for positional access mixed with every kind of modification, so the remembered position is
+ * checked after each of them.
+ */
+TEST_P(CContainerParamTest, finger)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CDoublyLinkedList<int> container;
+    std::vector<int> expected;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+        expected.push_back(i);
+    }
+    std::srand(size);
+
+    for (unsigned int j = 0; j < 50u * size; ++j)
+    {
+        const unsigned int operation = std::rand() % 8;
+        const unsigned int index = expected.empty() ? 0u : std::rand() % expected.size();
+        if (operation == 0)
+        {
+            container.pushBack(j);
+            expected.push_back(j);
+        }
+        else if (operation == 1)
+        {
+            container.pushFront(j);
+            expected.insert(expected.begin(), j);
+        }
+        else if ((operation == 2) && !expected.empty())
+        {
+            container.insert(index, j);
+            expected.insert(expected.begin() + index, j);
+        }
+        else if ((operation == 3) && (expected.size() > 1u))
+        {
+            ASSERT_EQ(container.eraseAt(index), expected[index]);
+            expected.erase(expected.begin() + index);
+        }
+        else if ((operation == 4) && (expected.size() > 1u))
+        {
+            ASSERT_EQ(container.popBack(), expected.back());
+            expected.pop_back();
+        }
+        else if ((operation == 5) && (expected.size() > 1u))
+        {
+            ASSERT_EQ(container.popFront(), expected.front());
+            expected.erase(expected.begin());
+        }
+        else if (operation == 6)
+        {
+            container.emplace(container.begin() + (expected.size() / 2u), j);
+            expected.insert(expected.begin() + (expected.size() / 2u), j);
+        }
+
+        ASSERT_EQ(container.size(), expected.size());
+        if (!expected.empty())
+        {
+            ASSERT_EQ(*container.get(index % expected.size()), expected[index % expected.size()]);
+            const unsigned int nearby = (index + 1u) % expected.size();
+            ASSERT_EQ(*container.get(nearby), expected[nearby]);
+        }
+    }
+
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(*container.get(i), expected[i]);
+    }
+    for (unsigned int i = expected.size(); i > 0; --i)
+    {
+        ASSERT_EQ(*container.get(i - 1u), expected[i - 1u]);
+    }
+
+    CDoublyLinkedList<int> moved(std::move(container));
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(*moved.get(i), expected[i]);
+    }
+    ASSERT_EQ(container.get(0), nullptr);
+}
+
+/**
+ * Test for hash lookup policy, the index has to follow every modification.
+ */
+TEST_P(CContainerParamTest, hashLookup)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CHashDoublyLinkedList<int> container;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+        container.pushFront(i + size);
+    }
+    for (unsigned int i = 0; i < 2u * size; ++i)
+    {
+        ASSERT_TRUE(container.contains(i));
+        ASSERT_EQ(*container.find(i), static_cast<int>(i));
+    }
+    ASSERT_FALSE(container.contains(2u * size));
+    ASSERT_TRUE(container.find(2u * size) == container.end());
+
+    // duplicates are found until the last one is removed
+    container.insert(1u, 0);
+    ASSERT_EQ(container.eraseAt(1u), 0);
+    ASSERT_TRUE(container.contains(0));
+    ASSERT_EQ(container.eraseAt(size), 0);
+    ASSERT_FALSE(container.contains(0));
+    ASSERT_EQ(container.popBack(), static_cast<int>(size - 1u));
+    ASSERT_FALSE(container.contains(size - 1u));
+
+    ASSERT_EQ(container.popFront(), static_cast<int>(2u * size - 1u));
+    ASSERT_FALSE(container.contains(2u * size - 1u));
+    container.emplace(container.begin() + 1u, 1000);
+    ASSERT_EQ(*container.find(1000), 1000);
+
+    CHashDoublyLinkedList<int> copy(container);
+    CHashDoublyLinkedList<int> moved(std::move(container));
+    ASSERT_FALSE(container.contains(1000));
+    ASSERT_TRUE(copy.contains(1000));
+    ASSERT_TRUE(moved.contains(1000));
+
+    copy.swap(container);
+    ASSERT_TRUE(container.contains(1000));
+    ASSERT_FALSE(copy.contains(1000));
+    container = std::move(moved);
+    ASSERT_TRUE(container.contains(1000));
+    ASSERT_FALSE(moved.contains(1000));
+    ASSERT_TRUE(container == copy || copy.empty());
+
+    std::pmr::monotonic_buffer_resource resource;
+    CDoublyLinkedList<std::string, std::pmr::polymorphic_allocator<std::string>, CHashLookupPolicy<>> strings(&resource);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        strings.pushBack(std::to_string(i));
+    }
+    ASSERT_TRUE(strings.contains(std::to_string(size - 1u)));
+    ASSERT_FALSE(strings.contains(std::to_string(size)));
+}
+
+/**
+ * Test for sort and merge. Both have to be stable and must not move values between items.
+ */
+TEST_P(CContainerParamTest, sortMerge)
+{
+    const unsigned int& size = GetParam(); // get param value
+    using Pair = std::pair<int, unsigned int>;
+    const auto compareFirst = [](const Pair& aFirst, const Pair& aSecond) { return aFirst.first < aSecond.first; };
+    CDoublyLinkedList<Pair> container;
+    std::vector<Pair> expected;
+    std::srand(size);
+    for (unsigned int i = 0; i < 10u * size; ++i)
+    {
+        const Pair value(std::rand() % size, i);
+        container.pushBack(value);
+        expected.push_back(value);
+    }
+    const Pair* firstValue = container.get(0);
+
+    container.sort(compareFirst);
+    std::stable_sort(expected.begin(), expected.end(), compareFirst);
+    ASSERT_EQ(container.size(), expected.size());
+    unsigned int i = 0;
+    for (const Pair& value : container)
+    {
+        ASSERT_EQ(value, expected[i++]);
+    }
+    i = expected.size();
+    for (auto iterator = container.rbegin(); iterator != container.rend(); ++iterator)
+    {
+        ASSERT_EQ(*iterator, expected[--i]);
+    }
+    ASSERT_EQ(*container.get(size), expected[size]);
+    // value stays in its item
+    ASSERT_TRUE(*container.find(Pair(firstValue->first, 0u)) == *firstValue);
+    ASSERT_EQ(&*container.find(Pair(firstValue->first, 0u)), firstValue);
+
+    // lists sharing allocator exchange items
+    CDoublyLinkedList<Pair> other(container.get_allocator());
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        other.pushBack(Pair(2 * j, 10u * size + j));
+        expected.push_back(Pair(2 * j, 10u * size + j));
+    }
+    const Pair* otherValue = other.get(0);
+    container.merge(other, compareFirst);
+    ASSERT_EQ(&*container.find(*otherValue), otherValue);
+    std::stable_sort(expected.begin(), expected.end(), compareFirst);
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(other.begin(), other.end());
+    ASSERT_EQ(container.size(), expected.size());
+    i = 0;
+    for (const Pair& value : container)
+    {
+        ASSERT_EQ(value, expected[i++]);
+    }
+    ASSERT_EQ(*container.rbegin(), expected.back());
+    ASSERT_EQ(container.popBack(), expected.back());
+
+    // pools of lists built independently are joined, items are relinked
+    CHashDoublyLinkedList<int> hashed;
+    CHashDoublyLinkedList<int> hashedOther;
+    for (unsigned int j = size; j > 0; --j)
+    {
+        hashed.pushBack(2 * j);
+        hashedOther.pushFront(2 * j + 1);
+    }
+    ASSERT_TRUE(hashed.get_allocator() != hashedOther.get_allocator());
+    const int* hashedValue = hashedOther.get(0);
+    hashed.sort();
+    hashed.merge(std::move(hashedOther));
+    ASSERT_TRUE(hashed.get_allocator() == hashedOther.get_allocator());
+    ASSERT_EQ(&*hashed.find(3), hashedValue);
+    ASSERT_EQ(hashed.size(), 2u * size);
+    for (unsigned int j = 0; j < 2u * size; ++j)
+    {
+        ASSERT_EQ(*hashed.get(j), static_cast<int>(j + 2u));
+        ASSERT_TRUE(hashed.contains(j + 2u));
+    }
+    ASSERT_FALSE(hashedOther.contains(3));
+
+    // an empty list without pool takes over items of the other list
+    CDoublyLinkedList<unsigned int> empty;
+    CDoublyLinkedList<unsigned int> sorted;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        sorted.pushBack(j);
+    }
+    const unsigned int* sortedValue = sorted.get(0);
+    empty.merge(sorted);
+    ASSERT_TRUE(sorted.empty());
+    ASSERT_EQ(empty.size(), size);
+    ASSERT_EQ(empty.get(0), sortedValue);
+    ASSERT_EQ(*empty.rbegin(), size - 1u);
+
+    // allocators of lists with inline storage are never equal, values are moved
+    CSmallDoublyLinkedList<unsigned int, 4u> small;
+    CSmallDoublyLinkedList<unsigned int, 4u> smallOther;
+    std::vector<unsigned int> smallExpected;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        small.pushBack(2u * j);
+        smallOther.pushBack(3u * j);
+        smallExpected.push_back(2u * j);
+        smallExpected.push_back(3u * j);
+    }
+    std::sort(smallExpected.begin(), smallExpected.end());
+    small.merge(smallOther);
+    ASSERT_TRUE(smallOther.empty());
+    ASSERT_TRUE(std::equal(small.begin(), small.end(), smallExpected.begin(), smallExpected.end()));
+    ASSERT_TRUE(std::equal(small.rbegin(), small.rend(), smallExpected.rbegin(), smallExpected.rend()));
+    CSmallDoublyLinkedList<unsigned int, 4u> smallEmpty;
+    smallEmpty.merge(small);
+    ASSERT_TRUE(small.empty());
+    ASSERT_TRUE(std::equal(smallEmpty.begin(), smallEmpty.end(), smallExpected.begin(), smallExpected.end()));
+}
+
+/**
+ * Test for splice, splitAt and append. Relinked values have to stay in their items.
+ */
+TEST_P(CContainerParamTest, spliceSplit)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CHashDoublyLinkedList<int> container;
+    std::vector<int> expected;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i);
+        expected.push_back(i);
+    }
+    // pool exists after the first item, so the other list shares it
+    CHashDoublyLinkedList<int> other(container.get_allocator());
+    std::vector<int> expectedOther;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        other.pushBack(i + size);
+        expectedOther.push_back(i + size);
+    }
+    const auto check = [](const CHashDoublyLinkedList<int>& aContainer, const std::vector<int>& aExpected)
+    {
+        ASSERT_EQ(aContainer.size(), aExpected.size());
+        unsigned int i = 0;
+        for (const int value : aContainer)
+        {
+            ASSERT_EQ(value, aExpected[i++]);
+            ASSERT_TRUE(aContainer.contains(value));
+        }
+        for (auto iterator = aContainer.rbegin(); iterator != aContainer.rend(); ++iterator)
+        {
+            ASSERT_EQ(*iterator, aExpected[--i]);
+        }
+        if (!aExpected.empty())
+        {
+            ASSERT_EQ(*aContainer.get(aExpected.size() / 2u), aExpected[aExpected.size() / 2u]);
+        }
+    };
+
+    // range from the middle of other list
+    const int* movedValue = other.get(1);
+    const unsigned int last = size / 2u + 1u;
+    container.splice(container.begin() + 1, other, other.begin() + 1, other.begin() + last);
+    expected.insert(expected.begin() + 1, expectedOther.begin() + 1, expectedOther.begin() + last);
+    expectedOther.erase(expectedOther.begin() + 1, expectedOther.begin() + last);
+    check(container, expected);
+    check(other, expectedOther);
+    ASSERT_EQ(&*container.find(*movedValue), movedValue);
+    ASSERT_FALSE(other.contains(*movedValue));
+
+    // range within the same list
+    container.splice(container.end(), container, container.begin(), container.begin() + 2);
+    std::rotate(expected.begin(), expected.begin() + 2, expected.end());
+    check(container, expected);
+
+    // whole list at the beginning
+    container.splice(container.begin(), other);
+    expected.insert(expected.begin(), expectedOther.begin(), expectedOther.end());
+    expectedOther.clear();
+    check(container, expected);
+    check(other, expectedOther);
+
+    CHashDoublyLinkedList<int> tail = container.splitAt(container.begin() + size);
+    std::vector<int> expectedTail(expected.begin() + size, expected.end());
+    expected.erase(expected.begin() + size, expected.end());
+    check(container, expected);
+    check(tail, expectedTail);
+    ASSERT_TRUE(container.splitAt(container.end()).empty());
+
+    container.append(std::move(tail));
+    expected.insert(expected.end(), expectedTail.begin(), expectedTail.end());
+    check(container, expected);
+    check(tail, {});
+
+    // pools of lists built independently are joined, items are relinked
+    CHashDoublyLinkedList<int> separate;
+    separate.pushBack(-1);
+    separate.pushBack(-2);
+    const int* separateValue = separate.get(0);
+    container.splice(container.begin() + 1, separate);
+    expected.insert(expected.begin() + 1, {-1, -2});
+    check(container, expected);
+    check(separate, {});
+    ASSERT_EQ(container.get(1), separateValue);
+    separate.pushBack(-3);
+    separate.splice(separate.begin(), container, container.begin(), container.begin() + 3);
+    check(separate, {expected[0], -1, -2, -3});
+    expected.erase(expected.begin(), expected.begin() + 3);
+    check(container, expected);
+    ASSERT_EQ(separate.get(1), separateValue);
+
+    // joined pools keep their memory until the last of them is gone
+    {
+        auto source = std::make_unique<CHashDoublyLinkedList<int>>();
+        auto target = std::make_unique<CHashDoublyLinkedList<int>>();
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            source->pushBack(i);
+            target->pushBack(-1 - static_cast<int>(i));
+        }
+        const int* sourceValue = source->get(0);
+        target->splice(target->begin(), *source);
+        ASSERT_EQ(target->get(0), sourceValue);
+        source->pushBack(1);
+        target.reset();
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            source->pushBack(i);
+        }
+        ASSERT_EQ(source->size(), size + 1u);
+        ASSERT_EQ(*source->get(size), static_cast<int>(size - 1u));
+    }
+
+    CHashDoublyLinkedList<int> all = container.splitAt(container.begin());
+    check(container, {});
+    check(all, expected);
+
+    // empty list takes over the items
+    const int* firstValue = all.get(0);
+    CHashDoublyLinkedList<int> empty;
+    empty.append(std::move(all));
+    check(empty, expected);
+    ASSERT_EQ(empty.get(0), firstValue);
+}
+
+/**
+ * @brief Value which throws on copy after given number of copies.
+ */
+struct CThrowingValue
+{
+    explicit CThrowingValue(int aValue)
+        : mValue(aValue)
+    {}
+
+    CThrowingValue(const CThrowingValue& aOther)
+        : mValue(aOther.mValue)
+    {
+        if (sCopiesLeft-- == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+    }
+
+    int mValue;
+
+    static int sCopiesLeft;
+};
+
+int CThrowingValue::sCopiesLeft = 0;
+
+/**
+ * Test for range construction, assignment and pushBack of ranges.
+ */
+TEST_P(CContainerParamTest, ranges)
+{
+    const unsigned int& size = GetParam(); // get param value
+    std::vector<int> values;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        values.push_back(i * 3);
+    }
+    const auto check = [](const auto& aContainer, const std::vector<int>& aExpected)
+    {
+        ASSERT_EQ(aContainer.size(), aExpected.size());
+        unsigned int i = 0;
+        for (const int value : aContainer)
+        {
+            ASSERT_EQ(value, aExpected[i++]);
+        }
+        for (auto iterator = aContainer.rbegin(); iterator != aContainer.rend(); ++iterator)
+        {
+            ASSERT_EQ(*iterator, aExpected[--i]);
+        }
+    };
+
+    CDoublyLinkedList<int> container(values.begin(), values.end());
+    check(container, values);
+    CDoublyLinkedList<int> copy(container);
+    check(copy, values);
+    CDoublyLinkedList<int, std::allocator<int>> heap(container.begin(), container.end());
+    check(heap, values);
+    CHashDoublyLinkedList<int> hashed(values.begin(), values.end());
+    check(hashed, values);
+    ASSERT_TRUE(hashed.contains(values.back()));
+
+    CDoublyLinkedList<int> list = {1, 2, 3};
+    check(list, {1, 2, 3});
+
+    // assign shorter, longer and equal range
+    const std::vector<int> shorter(values.begin(), values.begin() + size / 2u);
+    container.assign(shorter.begin(), shorter.end());
+    check(container, shorter);
+    container.assign(values.begin(), values.end());
+    check(container, values);
+    container = copy;
+    check(container, values);
+    container.assign({7, 8});
+    check(container, {7, 8});
+    hashed.assign(shorter.begin(), shorter.end());
+    check(hashed, shorter);
+    ASSERT_FALSE(hashed.contains(values.back()));
+    ASSERT_TRUE(shorter.empty() || hashed.contains(shorter.back()));
+
+    // input iterators are added one by one
+    std::istringstream stream("4 5 6");
+    container.pushBack(std::istream_iterator<int>(stream), std::istream_iterator<int>());
+    check(container, {7, 8, 4, 5, 6});
+    container.pushBack(values.begin(), values.begin());
+    ASSERT_EQ(container.size(), 5u);
+    // items of the batch can be removed one by one
+    ASSERT_EQ(copy.eraseAt(size / 2u), values[size / 2u]);
+    ASSERT_EQ(copy.popFront(), values.front());
+    copy.pushBack(values.begin(), values.end());
+    ASSERT_EQ(copy.size(), 2u * size - 2u);
+
+    // failed copy adds nothing
+    std::vector<CThrowingValue> throwing;
+    throwing.reserve(size);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        throwing.emplace_back(i);
+    }
+    CDoublyLinkedList<CThrowingValue> throwingContainer;
+    throwingContainer.emplaceBack(-1);
+    CThrowingValue::sCopiesLeft = size - 1u;
+    ASSERT_THROW(throwingContainer.pushBack(throwing.begin(), throwing.end()), std::runtime_error);
+    ASSERT_EQ(throwingContainer.size(), 1u);
+    ASSERT_EQ(throwingContainer.rbegin()->mValue, -1);
+    CThrowingValue::sCopiesLeft = size;
+    throwingContainer.pushBack(throwing.begin(), throwing.end());
+    ASSERT_EQ(throwingContainer.size(), size + 1u);
+    ASSERT_EQ(throwingContainer.rbegin()->mValue, static_cast<int>(size - 1u));
+}
+
+/**
+ * Test for list which keeps its first items inside the list object.
+ */
+TEST_P(CContainerParamTest, inlineStorage)
+{
+    const unsigned int& size = GetParam(); // get param value
+    const unsigned int inlineSize = 8u;
+    using CSmallList = CSmallDoublyLinkedList<std::string, inlineSize>;
+
+    const auto isInside = [](const CSmallList& aContainer, const std::string& aValue)
+    {
+        const char* address = reinterpret_cast<const char*>(&aValue);
+        const char* begin = reinterpret_cast<const char*>(&aContainer);
+        return (address >= begin) && (address < begin + sizeof(aContainer));
+    };
+    const auto check = [](const CSmallList& aContainer, const std::vector<std::string>& aExpected)
+    {
+        ASSERT_EQ(aContainer.size(), aExpected.size());
+        ASSERT_TRUE(std::equal(aContainer.begin(), aContainer.end(), aExpected.begin(), aExpected.end()));
+    };
+
+    CSmallList container;
+    std::vector<std::string> expected;
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        expected.push_back("inline storage value " + std::to_string(i));
+        container.pushBack(expected.back());
+    }
+    check(container, expected);
+    unsigned int inside = 0;
+    for (const std::string& value : container)
+    {
+        inside += isInside(container, value) ? 1u : 0u;
+    }
+    ASSERT_EQ(inside, std::min(size, inlineSize));
+
+    // released slots of the inline storage are reused
+    container.popFront();
+    container.pushFront(expected.front());
+    ASSERT_TRUE(isInside(container, *container.begin()));
+    check(container, expected);
+
+    CSmallList copy(container);
+    check(copy, expected);
+    ASSERT_TRUE(isInside(copy, *copy.begin()));
+
+    CSmallList moved(std::move(copy));
+    check(moved, expected);
+    check(copy, {});
+    ASSERT_TRUE(isInside(moved, *moved.begin()));
+
+    CSmallList other{"a", "b"};
+    other = std::move(moved);
+    check(other, expected);
+    ASSERT_TRUE(isInside(other, *other.begin()));
+
+    other.pushBack("c");
+    swap(container, other);
+    ASSERT_TRUE(isInside(container, *container.begin()));
+    ASSERT_TRUE(isInside(other, *other.begin()));
+    check(other, expected);
+    expected.push_back("c");
+    check(container, expected);
+
+    // split and splice move values between the storages of the lists
+    CSmallList tail = container.splitAt(container.begin() + size / 2u);
+    std::vector<std::string> expectedTail(expected.begin() + size / 2u, expected.end());
+    expected.erase(expected.begin() + size / 2u, expected.end());
+    check(container, expected);
+    check(tail, expectedTail);
+    ASSERT_TRUE(isInside(tail, *tail.begin()));
+
+    container.splice(container.begin(), tail, tail.begin() + 1, tail.end());
+    expected.insert(expected.begin(), expectedTail.begin() + 1, expectedTail.end());
+    check(container, expected);
+    check(tail, {expectedTail.front()});
+    container.append(std::move(tail));
+    expected.push_back(expectedTail.front());
+    check(container, expected);
+    check(tail, {});
+
+    // allocators of lists with inline storage are equal only to themselves, so every operation
+    // between two lists moves values, also into an empty list
+    CSmallList whole = container.splitAt(container.begin());
+    check(container, {});
+    check(whole, expected);
+    ASSERT_TRUE(isInside(whole, *whole.begin()));
+    check(whole.splitAt(whole.end()), {});
+    container.splice(container.end(), whole);
+    check(container, expected);
+    check(whole, {});
+    whole.append(std::move(container));
+    check(whole, expected);
+    check(container, {});
+    ASSERT_TRUE(isInside(whole, *whole.begin()));
+    whole.splice(whole.begin(), whole, whole.begin() + 1, whole.end());
+    std::rotate(expected.begin(), expected.begin() + 1, expected.end());
+    check(whole, expected);
+
+    std::vector<std::string> sorted(expected);
+    std::sort(sorted.begin(), sorted.end());
+    for (const std::string& value : sorted)
+    {
+        container.pushBack(value);
+    }
+    CSmallList merged;
+    merged.merge(container);
+    check(merged, sorted);
+    check(container, {});
+    ASSERT_TRUE(isInside(merged, *merged.begin()));
+    CSmallList second{"", "inline storage value 1", "~"};
+    merged.merge(std::move(second));
+    sorted.insert(sorted.begin(), "");
+    sorted.insert(std::upper_bound(sorted.begin() + 1, sorted.end(), std::string("inline storage value 1")), "inline storage value 1");
+    sorted.push_back("~");
+    check(merged, sorted);
+    check(second, {});
+}
+
+/**
+ * Test for list with jump pointers. Jumps go stale by erasing and are only prefetched.
+ */
+TEST_P(CContainerParamTest, prefetchPolicy)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CPrefetchDoublyLinkedList<std::string> container;
+    std::vector<std::string> expected;
+    for (unsigned int i = 0; i < 4u * size; ++i)
+    {
+        expected.push_back("prefetched value " + std::to_string(i));
+        container.pushBack(expected.back());
+    }
+
+    for (unsigned int round = 0; round < 3u; ++round)
+    {
+        // scans use jumps
+        ASSERT_TRUE(container.contains(expected.back()));
+        ASSERT_FALSE(container.contains("missing"));
+        ASSERT_EQ(*container.get(expected.size() - 1u), expected.back());
+        ASSERT_EQ(*(container.begin() + (expected.size() / 2u)), expected[expected.size() / 2u]);
+
+        // erased items leave jumps to freed items behind
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            const unsigned int index = (i * 7u + round) % expected.size();
+            ASSERT_EQ(container.eraseAt(index), expected[index]);
+            expected.erase(expected.begin() + index);
+        }
+        container.pushFront("front " + std::to_string(round));
+        expected.insert(expected.begin(), "front " + std::to_string(round));
+
+        ASSERT_TRUE(std::equal(container.begin(), container.end(), expected.begin(), expected.end()));
+        CPrefetchDoublyLinkedList<std::string> copy(container);
+        ASSERT_TRUE(copy == container);
+    }
+}
+
+/**
+ * @brief Jump prefetch policy which records the item and its jump at every step of iteration.
+ */
+struct CRecordingPrefetchPolicy : CJumpPrefetchPolicy<4u>
+{
+    static void prefetch(const CHint& aHint)
+    {
+        sSteps.emplace_back(&aHint, aHint.mJump);
+    }
+
+    static std::vector<std::pair<const void*, const void*>> sSteps;
+};
+
+std::vector<std::pair<const void*, const void*>> CRecordingPrefetchPolicy::sSteps;
+
+using CRecordingList = CDoublyLinkedList<unsigned int, CDoublyLinkedListPoolAllocator<unsigned int>,
+                                         CNoLookupPolicy, CRecordingPrefetchPolicy>;
+
+/**
+ * @brief Checks that the jump of every item reaches the item 4 items ahead.
+ * @param aContainer List to check.
+ */
+static void expectExactJumps(const CRecordingList& aContainer)
+{
+    CRecordingPrefetchPolicy::sSteps.clear();
+    for (auto it = aContainer.begin(); it != aContainer.end(); ++it)
+    {
+    }
+    const auto& steps = CRecordingPrefetchPolicy::sSteps;
+    ASSERT_EQ(steps.size(), aContainer.size());
+    for (std::size_t i = 0; i + 4u < steps.size(); ++i)
+    {
+        ASSERT_EQ(steps[i].second, steps[i + 4u].first) << "item " << i;
+    }
+}
+
+/**
+ * Test that jumps are set while the list is built, without any scan.
+ */
+TEST_P(CContainerParamTest, prefetchJumpsOnPushes)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CRecordingList back;
+    CRecordingList front;
+    CRecordingList both;
+    for (unsigned int i = 0; i < 4u * size; ++i)
+    {
+        back.pushBack(i);
+        front.pushFront(i);
+        if ((i % 3u) == 0)
+        {
+            both.pushFront(i);
+        }
+        else
+        {
+            both.pushBack(i);
+        }
+    }
+    expectExactJumps(back);
+    expectExactJumps(front);
+    expectExactJumps(both);
+
+    // pushes and pops at the ends keep the distance
+    for (unsigned int i = 0; i < 3u * size; ++i)
+    {
+        back.popFront();
+        back.pushBack(i);
+        front.popFront();
+        front.pushFront(i);
+        if ((i % 2u) == 0)
+        {
+            both.popBack();
+            both.pushBack(i);
+        }
+        else
+        {
+            both.popBack();
+            both.popFront();
+            both.pushFront(i);
+            both.pushBack(i);
+        }
+    }
+    expectExactJumps(back);
+    expectExactJumps(front);
+    expectExactJumps(both);
+
+    // shrunk to nothing and built again
+    while (!back.empty())
+    {
+        back.popBack();
+    }
+    for (unsigned int i = 0; i < 2u * size; ++i)
+    {
+        back.pushBack(i);
+    }
+    expectExactJumps(back);
+
+    // relinking sets all jumps
+    both.sort(std::greater<unsigned int>());
+    expectExactJumps(both);
+    CRecordingList copy(both);
+    expectExactJumps(copy);
+    front.sort();
+    back.merge(front);
+    expectExactJumps(back);
+    ASSERT_TRUE(std::is_sorted(back.begin(), back.end()));
+}
+
+/**
+ * Test for compaction: values keep their order, items are relinked in address order
+ * and automatic compaction keeps the list in order while it is changed.
+ */
+TEST_P(CContainerParamTest, compaction)
+{
+    const unsigned int& size = GetParam(); // get param value
+    CDoublyLinkedList<std::string> container;
+    std::vector<std::string> expected;
+    for (unsigned int i = 0; i < 8u * size; ++i)
+    {
+        expected.push_back("compacted value " + std::to_string(i));
+        container.pushBack(expected.back());
+    }
+    auto scatter = [](const std::string& aFirst, const std::string& aSecond)
+    {
+        return std::hash<std::string>()(aFirst) < std::hash<std::string>()(aSecond);
+    };
+    container.sort(scatter);
+    std::sort(expected.begin(), expected.end(), scatter);
+    ASSERT_GT(container.fragmentation(), 0.0);
+    ASSERT_EQ(*container.get(size), expected[size]);
+
+    container.compact();
+    // only links between blocks of the pool stay scattered
+    ASSERT_LT(container.fragmentation(), 0.1);
+    ASSERT_TRUE(std::equal(container.begin(), container.end(), expected.begin(), expected.end()));
+    ASSERT_TRUE(std::equal(container.rbegin(), container.rend(), expected.rbegin(), expected.rend()));
+    ASSERT_EQ(*container.get(size), expected[size]);
+    for (auto it = container.begin(); std::next(it) != container.end(); ++it)
+    {
+        ASSERT_LT(&*it, &*std::next(it));
+    }
+
+    // items pushed at the front land after the others in memory until the list compacts itself
+    CDoublyLinkedList<unsigned int> numbers;
+    CDoublyLinkedList<unsigned int> reversed;
+    numbers.setCompactionThreshold(0.5);
+    for (unsigned int i = 0; i < 64u * size; ++i)
+    {
+        numbers.pushFront(i);
+        reversed.pushFront(i);
+    }
+    ASSERT_EQ(reversed.fragmentation(), 1.0);
+    ASSERT_LT(numbers.fragmentation(), 0.6);
+    ASSERT_TRUE(numbers == reversed);
+    for (unsigned int i = 0; i < 64u * size; ++i)
+    {
+        ASSERT_EQ(numbers.popBack(), i);
+    }
+
+    CDoublyLinkedList<std::string> empty;
+    empty.compact();
+    ASSERT_TRUE(empty.empty());
+    ASSERT_EQ(empty.fragmentation(), 0.0);
+}
+
 /**
  * @brief Function to display name of tests.
  * @param aInfo Param info.
@@ -0,0 +1,332 @@
+#include <include/CppFineGrainedDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <list>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Checks that list holds the same values as the reference list.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+static void expectSameValues(const CFineGrainedDoublyLinkedList<int>& aContainer, const std::list<int>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    auto expected = aExpected.begin();
+    for (auto it = aContainer.begin(); it != aContainer.end(); ++it, ++expected)
+    {
+        ASSERT_NE(expected, aExpected.end());
+        ASSERT_EQ(*it, *expected);
+    }
+    ASSERT_EQ(expected, aExpected.end());
+}
+
+/**
+ * @brief Test base class.
+ */
+class CFineGrainedContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CFineGrainedContainerTest, empty)
+{
+    CFineGrainedDoublyLinkedList<int> container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_FALSE(container.erase(container.end()));
+}
+
+/**
+ * Test for random inserts and erases compared with std::list, from one thread.
+ */
+TEST_F(CFineGrainedContainerTest, randomOperations)
+{
+    CFineGrainedDoublyLinkedList<int> container;
+    std::list<int> expected;
+    std::srand(5);
+
+    for (int i = 0; i < 2000; ++i)
+    {
+        const int operation = std::rand() % 4;
+        const unsigned int index = expected.empty() ? 0u : std::rand() % expected.size();
+        auto position = container.begin();
+        auto expectedPosition = expected.begin();
+        for (unsigned int step = 0; step < index; ++step)
+        {
+            ++position;
+            ++expectedPosition;
+        }
+
+        if (operation == 0)
+        {
+            container.pushBack(i);
+            expected.push_back(i);
+        }
+        else if (operation == 1)
+        {
+            container.pushFront(i);
+            expected.push_front(i);
+        }
+        else if (operation == 2)
+        {
+            auto inserted = container.insert(position, i);
+            ASSERT_EQ(*inserted, i);
+            expected.insert(expectedPosition, i);
+        }
+        else if (!expected.empty())
+        {
+            ASSERT_TRUE(container.erase(position));
+            ASSERT_FALSE(container.erase(position));
+            expected.erase(expectedPosition);
+        }
+        ASSERT_EQ(container.contains(i), std::find(expected.begin(), expected.end(), i) != expected.end());
+    }
+    expectSameValues(container, expected);
+}
+
+/**
+ * Test that iterator on erased item stays usable and moves to the following items.
+ */
+TEST_F(CFineGrainedContainerTest, iteratorOnErasedItem)
+{
+    CFineGrainedDoublyLinkedList<int> container;
+    for (int i = 0; i < 5; ++i)
+    {
+        container.pushBack(i);
+    }
+
+    auto second = ++container.begin();
+    auto third = second;
+    ++third;
+    ASSERT_TRUE(container.erase(second));
+    ASSERT_TRUE(container.erase(third));
+    ASSERT_EQ(*second, 1);
+    ASSERT_EQ(*third, 2);
+    ASSERT_TRUE(container.insert(second, 10) == container.end());
+
+    ++second;
+    ASSERT_EQ(*second, 3);
+    --third;
+    ASSERT_EQ(*third, 0);
+    expectSameValues(container, {0, 3, 4});
+}
+
+/**
+ * Test for threads inserting and erasing in their own parts of one list while readers traverse it.
+ */
+TEST_F(CFineGrainedContainerTest, concurrentDisjointParts)
+{
+    const int threads = 4;
+    const int operations = 3000;
+    CFineGrainedDoublyLinkedList<int> container;
+    // every thread owns the items between its marker and the next marker
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        container.pushBack(-1 - thread);
+    }
+
+    std::atomic<bool> writing(true);
+    std::vector<std::thread> writers;
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        writers.emplace_back([&container, thread, operations]()
+        {
+            auto marker = container.begin();
+            while (*marker != -1 - thread)
+            {
+                ++marker;
+            }
+            std::mt19937 random(thread);
+            int count = 0;
+            for (int i = 0; i < operations; ++i)
+            {
+                auto position = marker;
+                ++position;
+                const int steps = (count == 0) ? 0 : static_cast<int>(random() % count);
+                for (int step = 0; step < steps; ++step)
+                {
+                    ++position;
+                }
+                if ((count == 0) || ((random() % 3) != 0))
+                {
+                    container.insert(position, thread * operations + i);
+                    ++count;
+                }
+                else
+                {
+                    ASSERT_TRUE(container.erase(position));
+                    --count;
+                }
+            }
+        });
+    }
+    std::thread reader([&container, &writing]()
+    {
+        while (writing.load())
+        {
+            std::size_t count = 0;
+            for (auto it = container.begin(); it != container.end(); ++it)
+            {
+                ++count;
+            }
+            ASSERT_GE(count, 4u);
+            container.contains(-4);
+        }
+    });
+    for (std::thread& writer : writers)
+    {
+        writer.join();
+    }
+    writing.store(false);
+    reader.join();
+
+    // values of one thread stay between its marker and the next one
+    int owner = 0;
+    std::size_t count = 0;
+    for (auto it = container.begin(); it != container.end(); ++it, ++count)
+    {
+        if (*it < 0)
+        {
+            owner = -1 - *it;
+        }
+        else
+        {
+            ASSERT_EQ(*it / operations, owner);
+        }
+    }
+    ASSERT_EQ(count, container.size());
+}
+
+/**
+ * Test for threads inserting and erasing at the same places.
+ */
+TEST_F(CFineGrainedContainerTest, concurrentSamePlace)
+{
+    const int threads = 4;
+    CFineGrainedDoublyLinkedList<int> container;
+    std::atomic<int> inserted(0);
+    std::atomic<int> erased(0);
+
+    std::vector<std::thread> workers;
+    for (int thread = 0; thread < threads; ++thread)
+    {
+        workers.emplace_back([&container, &inserted, &erased, thread]()
+        {
+            for (int i = 0; i < 5000; ++i)
+            {
+                if ((i % 2) == 0)
+                {
+                    container.pushFront(i);
+                    container.pushBack(i);
+                    inserted.fetch_add(2);
+                }
+                else
+                {
+                    auto position = container.begin();
+                    if ((thread % 2) != 0)
+                    {
+                        ++position;
+                    }
+                    if ((position != container.end()) && container.erase(position))
+                    {
+                        erased.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+
+    std::size_t count = 0;
+    for (auto it = container.begin(); it != container.end(); ++it)
+    {
+        ++count;
+    }
+    ASSERT_EQ(count, static_cast<std::size_t>(inserted.load() - erased.load()));
+    ASSERT_EQ(count, container.size());
+}
+
+/**
+ * Test that a value pushed to the front is first when it is linked, while another thread pushes to the front too.
+ * An observer samples the first value together with the size; as all values go to the front, the value
+ * first at size s has to be the s-th value from the back when the list is popped in the end.
+ */
+TEST_F(CFineGrainedContainerTest, concurrentPushFront)
+{
+    const int values = 200000;
+    CFineGrainedDoublyLinkedList<int> container;
+    std::atomic<int> pushing(2);
+    std::vector<std::pair<std::size_t, int>> samples;
+
+    std::vector<std::thread> pushers;
+    for (int thread = 0; thread < 2; ++thread)
+    {
+        pushers.emplace_back([&container, &pushing, thread, values]()
+        {
+            for (int i = thread; i < values; i += 2)
+            {
+                container.pushFront(i);
+            }
+            pushing.fetch_sub(1);
+        });
+    }
+    std::thread observer([&container, &pushing, &samples]()
+    {
+        while (pushing.load() != 0)
+        {
+            const std::size_t before = container.size();
+            auto first = container.begin();
+            if ((before != 0u) && (container.size() == before))
+            {
+                samples.emplace_back(before, *first);
+            }
+        }
+    });
+    for (std::thread& pusher : pushers)
+    {
+        pusher.join();
+    }
+    observer.join();
+
+    std::vector<int> popped;
+    while (!container.empty())
+    {
+        auto first = container.begin();
+        popped.push_back(*first);
+        ASSERT_TRUE(container.erase(first));
+    }
+    ASSERT_EQ(popped.size(), static_cast<std::size_t>(values));
+    for (const std::pair<std::size_t, int>& sample : samples)
+    {
+        ASSERT_EQ(popped[values - sample.first], sample.second);
+    }
+    // values of one thread are popped in reverse order of their pushes
+    for (int thread = 0; thread < 2; ++thread)
+    {
+        int last = values;
+        for (int value : popped)
+        {
+            if ((value % 2) == thread)
+            {
+                ASSERT_LT(value, last);
+                last = value;
+            }
+        }
+    }
+}
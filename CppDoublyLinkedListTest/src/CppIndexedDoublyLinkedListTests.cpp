@@ -0,0 +1,193 @@
+#include <include/CppIndexedDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <list>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Checks that list holds the same values as the reference list, in both directions.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+template<typename T>
+static void expectSameValues(const CIndexedDoublyLinkedList<T>& aContainer, const std::list<T>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    ASSERT_TRUE(std::equal(aContainer.begin(), aContainer.end(), aExpected.begin(), aExpected.end()));
+    ASSERT_TRUE(std::equal(aContainer.rbegin(), aContainer.rend(), aExpected.rbegin(), aExpected.rend()));
+}
+
+/**
+ * @brief Test base class.
+ */
+class CIndexedContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CIndexedContainerTest, empty)
+{
+    CIndexedDoublyLinkedList<int> container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_EQ(container.capacity(), 0u);
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_EQ(container.get(0), nullptr);
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_THROW(container.popBack(), std::out_of_range);
+    ASSERT_THROW(container.popFront(), std::out_of_range);
+}
+
+/**
+ * Test for random pushes and pops on both ends compared with std::list.
+ */
+TEST_F(CIndexedContainerTest, randomOperations)
+{
+    CIndexedDoublyLinkedList<std::string> container;
+    std::list<std::string> expected;
+    std::srand(3);
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        const std::string value = "indexed list value " + std::to_string(i);
+        const int operation = std::rand() % 5;
+        if (operation == 0)
+        {
+            container.pushBack(value);
+            expected.push_back(value);
+        }
+        else if (operation == 1)
+        {
+            container.emplaceFront(value);
+            expected.push_front(value);
+        }
+        else if ((operation == 2) && !expected.empty())
+        {
+            ASSERT_EQ(container.popBack(), expected.back());
+            expected.pop_back();
+        }
+        else if ((operation == 3) && !expected.empty())
+        {
+            ASSERT_EQ(container.popFront(), expected.front());
+            expected.pop_front();
+        }
+        else if (!expected.empty())
+        {
+            const unsigned int index = std::rand() % expected.size();
+            ASSERT_EQ(*container.get(index), *std::next(expected.begin(), index));
+            ASSERT_TRUE(container.contains(*std::next(expected.begin(), index)));
+        }
+        ASSERT_LE(container.size(), container.capacity());
+    }
+    expectSameValues(container, expected);
+}
+
+/**
+ * Test that removed items are reused and the arena doesn't grow in steady state.
+ */
+TEST_F(CIndexedContainerTest, reuseItems)
+{
+    CIndexedDoublyLinkedList<int> container;
+    container.reserve(16u);
+    ASSERT_EQ(container.capacity(), 16u);
+    for (int round = 0; round < 100; ++round)
+    {
+        for (int i = 0; i < 16; ++i)
+        {
+            (((i + round) % 2) == 0) ? container.pushBack(i) : container.pushFront(i);
+        }
+        while (!container.empty())
+        {
+            ((round % 2) == 0) ? container.popFront() : container.popBack();
+        }
+    }
+    ASSERT_EQ(container.capacity(), 16u);
+
+    container.pushBack(1);
+    container.clear();
+    ASSERT_TRUE(container.empty());
+    ASSERT_EQ(container.capacity(), 16u);
+}
+
+/**
+ * Test that iterators stay valid when the arena grows.
+ */
+TEST_F(CIndexedContainerTest, growthKeepsIterators)
+{
+    CIndexedDoublyLinkedList<std::string> container;
+    std::list<std::string> expected;
+    container.pushBack("first value, long enough to be on the heap");
+    expected.push_back(container.popFront());
+    container.pushBack(expected.back());
+    auto first = container.begin();
+    for (int i = 0; i < 100; ++i)
+    {
+        expected.push_back(std::to_string(i));
+        container.pushBack(expected.back());
+    }
+    ASSERT_GE(container.capacity(), 101u);
+    ASSERT_EQ(*first, expected.front());
+    ASSERT_EQ(*++first, "0");
+    ASSERT_EQ(*--container.end(), "99");
+    expectSameValues(container, expected);
+}
+
+/**
+ * Test for copy and move of trivially copyable values (arena copied at once) and strings.
+ */
+TEST_F(CIndexedContainerTest, copyMove)
+{
+    CIndexedDoublyLinkedList<int> numbers;
+    std::list<int> expectedNumbers;
+    for (int i = 0; i < 20; ++i)
+    {
+        numbers.pushBack(i);
+        numbers.pushFront(-i);
+        expectedNumbers.push_back(i);
+        expectedNumbers.push_front(-i);
+    }
+    numbers.popFront();
+    expectedNumbers.pop_front();
+
+    CIndexedDoublyLinkedList<int> numbersCopy(numbers);
+    expectSameValues(numbersCopy, expectedNumbers);
+    // the free item of the source is copied too and reused
+    numbersCopy.pushFront(100);
+    ASSERT_EQ(numbersCopy.capacity(), numbers.size() + 1u);
+    ASSERT_TRUE(numbersCopy != numbers);
+
+    CIndexedDoublyLinkedList<std::string> strings;
+    for (int i = 0; i < 20; ++i)
+    {
+        strings.pushBack("string value number " + std::to_string(i));
+    }
+    CIndexedDoublyLinkedList<std::string> stringsCopy(strings);
+    ASSERT_TRUE(stringsCopy == strings);
+    CIndexedDoublyLinkedList<std::string> stringsMoved(std::move(stringsCopy));
+    ASSERT_TRUE(stringsMoved == strings);
+    ASSERT_TRUE(stringsCopy.empty());
+    stringsCopy = stringsMoved;
+    ASSERT_TRUE(stringsCopy == strings);
+    stringsMoved.popBack();
+    stringsCopy = std::move(stringsMoved);
+    ASSERT_EQ(stringsCopy.size(), 19u);
+
+    // arenas from different resources move values
+    std::pmr::monotonic_buffer_resource resource;
+    CIndexedDoublyLinkedList<std::string, std::pmr::polymorphic_allocator<std::string>> pmrFirst(&resource);
+    CIndexedDoublyLinkedList<std::string, std::pmr::polymorphic_allocator<std::string>> pmrSecond;
+    pmrFirst.pushBack("moved between resources");
+    pmrSecond = std::move(pmrFirst);
+    ASSERT_EQ(*pmrSecond.begin(), "moved between resources");
+    ASSERT_TRUE(pmrFirst.empty());
+}
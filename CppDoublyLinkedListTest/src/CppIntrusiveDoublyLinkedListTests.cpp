@@ -0,0 +1,194 @@
+#include <include/CppIntrusiveDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <list>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Object which can be linked in two lists at once.
+ */
+struct CIntrusiveObject
+{
+    explicit CIntrusiveObject(int aValue = 0)
+        : mValue(aValue)
+    {}
+
+    int mValue;
+    CDoublyLinkedListHook<CIntrusiveObject> mHook;
+    CDoublyLinkedListHook<CIntrusiveObject> mOtherHook;
+};
+
+using CIntrusiveList = CIntrusiveDoublyLinkedList<CIntrusiveObject, &CIntrusiveObject::mHook>;
+using COtherIntrusiveList = CIntrusiveDoublyLinkedList<CIntrusiveObject, &CIntrusiveObject::mOtherHook>;
+
+/**
+ * @brief Checks that list links the same objects as the reference list, in both directions.
+ * @param aContainer List to check.
+ * @param aExpected Reference objects.
+ */
+static void expectSameObjects(const CIntrusiveList& aContainer, const std::list<CIntrusiveObject*>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    auto expected = aExpected.begin();
+    for (auto it = aContainer.begin(); it != aContainer.end(); ++it, ++expected)
+    {
+        ASSERT_EQ(&*it, *expected);
+    }
+    if (!aExpected.empty())
+    {
+        auto it = aContainer.begin() + static_cast<int>(aExpected.size() - 1u);
+        for (auto reverse = aExpected.rbegin(); reverse != aExpected.rend(); ++reverse, --it)
+        {
+            ASSERT_EQ(&*it, *reverse);
+        }
+    }
+}
+
+/**
+ * @brief Test base class.
+ */
+class CIntrusiveContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CIntrusiveContainerTest, empty)
+{
+    CIntrusiveList container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_TRUE(container.begin() == container.end());
+}
+
+/**
+ * Test for random links and unlinks compared with std::list.
+ */
+TEST_F(CIntrusiveContainerTest, randomOperations)
+{
+    std::vector<CIntrusiveObject> objects;
+    for (int i = 0; i < 500; ++i)
+    {
+        objects.emplace_back(i);
+    }
+    std::vector<CIntrusiveObject*> unlinked;
+    for (CIntrusiveObject& object : objects)
+    {
+        unlinked.push_back(&object);
+    }
+    CIntrusiveList container;
+    std::list<CIntrusiveObject*> expected;
+    std::srand(3);
+
+    for (int i = 0; i < 5000; ++i)
+    {
+        const int operation = std::rand() % 5;
+        if ((operation < 3) && !unlinked.empty())
+        {
+            CIntrusiveObject* object = unlinked.back();
+            unlinked.pop_back();
+            if (operation == 0)
+            {
+                container.pushBack(*object);
+                expected.push_back(object);
+            }
+            else if (operation == 1)
+            {
+                container.pushFront(*object);
+                expected.push_front(object);
+            }
+            else
+            {
+                const int index = expected.empty() ? 0 : std::rand() % static_cast<int>(expected.size());
+                auto inserted = container.insert(container.begin() + index, *object);
+                ASSERT_EQ(&*inserted, object);
+                auto position = expected.begin();
+                std::advance(position, index);
+                expected.insert(position, object);
+            }
+        }
+        else if (!expected.empty())
+        {
+            CIntrusiveObject* object;
+            if (operation == 3)
+            {
+                object = &container.popBack();
+                ASSERT_EQ(object, expected.back());
+                expected.pop_back();
+            }
+            else
+            {
+                // unlink from the middle, given only the object
+                auto position = expected.begin();
+                std::advance(position, std::rand() % static_cast<int>(expected.size()));
+                object = *position;
+                container.unlink(*object);
+                expected.erase(position);
+            }
+            ASSERT_EQ(object->mHook.mPrevious, nullptr);
+            ASSERT_EQ(object->mHook.mNext, nullptr);
+            unlinked.push_back(object);
+        }
+    }
+    expectSameObjects(container, expected);
+}
+
+/**
+ * Test for object linked in two lists by different hooks.
+ */
+TEST_F(CIntrusiveContainerTest, twoHooks)
+{
+    CIntrusiveObject objects[4] = {CIntrusiveObject(0), CIntrusiveObject(1), CIntrusiveObject(2), CIntrusiveObject(3)};
+    CIntrusiveList container;
+    COtherIntrusiveList other;
+    for (CIntrusiveObject& object : objects)
+    {
+        container.pushBack(object);
+        other.pushFront(object);
+    }
+    container.unlink(objects[1]);
+    ASSERT_EQ(other.size(), 4u);
+    ASSERT_EQ(other.begin()->mValue, 3);
+    ASSERT_EQ(&other.popBack(), &objects[0]);
+    expectSameObjects(container, {&objects[0], &objects[2], &objects[3]});
+
+    ASSERT_EQ(container.iteratorTo(objects[2])->mValue, 2);
+    (*container.iteratorTo(objects[2])).mValue = 20;
+    ASSERT_EQ(objects[2].mValue, 20);
+}
+
+/**
+ * Test for move, swap and clear.
+ */
+TEST_F(CIntrusiveContainerTest, moveSwapClear)
+{
+    CIntrusiveObject objects[3] = {CIntrusiveObject(0), CIntrusiveObject(1), CIntrusiveObject(2)};
+    CIntrusiveList container;
+    container.pushBack(objects[0]);
+    container.pushBack(objects[1]);
+
+    CIntrusiveList moved(std::move(container));
+    ASSERT_TRUE(container.empty());
+    expectSameObjects(moved, {&objects[0], &objects[1]});
+
+    container.pushBack(objects[2]);
+    swap(container, moved);
+    expectSameObjects(container, {&objects[0], &objects[1]});
+    expectSameObjects(moved, {&objects[2]});
+
+    container.clear();
+    ASSERT_TRUE(container.empty());
+    ASSERT_EQ(objects[0].mHook.mNext, nullptr);
+    ASSERT_EQ(objects[1].mHook.mPrevious, nullptr);
+    moved.pushBack(objects[0]);
+    expectSameObjects(moved, {&objects[2], &objects[0]});
+
+    const CIntrusiveObject copy(objects[2]);
+    ASSERT_EQ(copy.mHook.mPrevious, nullptr);
+    ASSERT_EQ(copy.mHook.mNext, nullptr);
+}
@@ -0,0 +1,264 @@
+#include <include/CppMappedDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <stdexcept>
+#include <string>
+
+using namespace ::testing;
+
+/**
+ * @brief Test base class. Every test gets its own file, which is removed afterwards.
+ */
+class CMappedContainerTest : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        mPath = TempDir() + "mapped_list_" + UnitTest::GetInstance()->current_test_info()->name();
+        std::remove(mPath.c_str());
+    }
+
+    void TearDown() override
+    {
+        std::remove(mPath.c_str());
+    }
+
+    std::string mPath;
+};
+
+/**
+ * @brief Checks that list holds the same values as the reference list, in both directions.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+template<typename T>
+static void expectSameValues(const CMappedDoublyLinkedList<T>& aContainer, const std::list<T>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    ASSERT_TRUE(std::equal(aContainer.begin(), aContainer.end(), aExpected.begin(), aExpected.end()));
+    ASSERT_TRUE(std::equal(aContainer.rbegin(), aContainer.rend(), aExpected.rbegin(), aExpected.rend()));
+}
+
+/**
+ * Test for a new file.
+ */
+TEST_F(CMappedContainerTest, empty)
+{
+    CMappedDoublyLinkedList<int> container(mPath);
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_GT(container.capacity(), 0u);
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_EQ(container.get(0), nullptr);
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_THROW(container.popBack(), std::out_of_range);
+    ASSERT_THROW(container.popFront(), std::out_of_range);
+}
+
+/**
+ * Test for random pushes and pops compared with std::list, across reopening of the file.
+ */
+TEST_F(CMappedContainerTest, randomOperationsAndReopen)
+{
+    std::list<long long> expected;
+    std::srand(5);
+    for (int round = 0; round < 4; ++round)
+    {
+        CMappedDoublyLinkedList<long long> container(mPath);
+        expectSameValues(container, expected);
+        for (int i = 0; i < 2000; ++i)
+        {
+            const long long value = round * 10000 + i;
+            const int operation = std::rand() % 5;
+            if (operation == 0)
+            {
+                container.pushBack(value);
+                expected.push_back(value);
+            }
+            else if (operation == 1)
+            {
+                container.pushFront(value);
+                expected.push_front(value);
+            }
+            else if ((operation == 2) && !expected.empty())
+            {
+                ASSERT_EQ(container.popBack(), expected.back());
+                expected.pop_back();
+            }
+            else if ((operation == 3) && !expected.empty())
+            {
+                ASSERT_EQ(container.popFront(), expected.front());
+                expected.pop_front();
+            }
+            else if (!expected.empty())
+            {
+                const unsigned int index = std::rand() % expected.size();
+                ASSERT_EQ(*container.get(index), *std::next(expected.begin(), index));
+                ASSERT_TRUE(container.contains(*std::next(expected.begin(), index)));
+            }
+        }
+        expectSameValues(container, expected);
+    }
+}
+
+/**
+ * Test that the file grows, iterators stay valid meanwhile and removed items are reused.
+ */
+TEST_F(CMappedContainerTest, growAndReuse)
+{
+    CMappedDoublyLinkedList<int> container(mPath);
+    container.pushBack(-1);
+    auto first = container.begin();
+    const uintmax_t initialCapacity = container.capacity();
+    for (int i = 0; i < 10000; ++i)
+    {
+        // value from the mapping itself while the mapping is replaced
+        container.pushBack(*first);
+    }
+    ASSERT_GE(container.capacity(), 10001u);
+    ASSERT_GT(container.capacity(), initialCapacity);
+    ASSERT_EQ(*first, -1);
+    ASSERT_EQ(*--container.end(), -1);
+
+    const uintmax_t capacity = container.capacity();
+    for (int round = 0; round < 10; ++round)
+    {
+        while (!container.empty())
+        {
+            container.popFront();
+        }
+        for (int i = 0; i < 10001; ++i)
+        {
+            container.pushFront(i);
+        }
+    }
+    ASSERT_EQ(container.capacity(), capacity);
+
+    container.reserve(4u * capacity);
+    ASSERT_EQ(container.capacity(), 4u * capacity);
+    container.clear();
+    ASSERT_TRUE(container.empty());
+    container.pushBack(5);
+    container.sync();
+    ASSERT_EQ(*container.begin(), 5);
+}
+
+/**
+ * Test that files of other types, damaged or truncated files and files open by another list are rejected,
+ * and of moving the list.
+ */
+TEST_F(CMappedContainerTest, invalidFile)
+{
+    {
+        CMappedDoublyLinkedList<int> container(mPath);
+        container.pushBack(1);
+    }
+    ASSERT_THROW(CMappedDoublyLinkedList<double> wrongType(mPath), std::runtime_error);
+
+    std::FILE* file = std::fopen(mPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    std::fputs("XXXX", file);
+    std::fclose(file);
+    ASSERT_THROW(CMappedDoublyLinkedList<int> wrongMagic(mPath), std::runtime_error);
+    std::remove(mPath.c_str());
+    {
+        CMappedDoublyLinkedList<int> container(mPath);
+    }
+    ASSERT_EQ(truncate(mPath.c_str(), 100), 0);
+    ASSERT_THROW(CMappedDoublyLinkedList<int> truncated(mPath), std::runtime_error);
+
+    ASSERT_THROW(CMappedDoublyLinkedList<int> noDirectory(mPath + "/missing/list"), std::runtime_error);
+
+    // a file is open by one list at a time, also within a process
+    std::remove(mPath.c_str());
+    {
+        CMappedDoublyLinkedList<int> owner(mPath);
+        owner.pushBack(7);
+        ASSERT_THROW(CMappedDoublyLinkedList<int> second(mPath), std::runtime_error);
+        ASSERT_EQ(owner.size(), 1u);
+    }
+    CMappedDoublyLinkedList<int> reopened(mPath);
+    ASSERT_EQ(*reopened.begin(), 7);
+
+    CMappedDoublyLinkedList<int> first(TempDir() + "mapped_list_moved");
+    first.pushBack(3);
+    CMappedDoublyLinkedList<int> second(std::move(first));
+    ASSERT_EQ(second.popBack(), 3);
+    std::remove((TempDir() + "mapped_list_moved").c_str());
+}
+
+/**
+ * @brief Writes a field of the header of list file, at its offset in the layout of the file.
+ */
+static void writeHeaderField(const std::string& aPath, long aOffset, uint64_t aValue, std::size_t aSize = sizeof(uint64_t))
+{
+    std::FILE* file = std::fopen(aPath.c_str(), "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fseek(file, aOffset, SEEK_SET), 0);
+    ASSERT_EQ(std::fwrite(&aValue, aSize, 1u, file), 1u);
+    std::fclose(file);
+}
+
+/**
+ * Test that a file with a state out of its item array is rejected, and that a file which wasn't closed is repaired.
+ */
+TEST_F(CMappedContainerTest, reopenAfterCrash)
+{
+    // offsets of the state in header
+    const long used = 24;
+    const long begin = 40;
+    const long size = 56;
+    const long open = 64;
+    const auto create = [this]()
+    {
+        std::remove(mPath.c_str());
+        CMappedDoublyLinkedList<int> container(mPath);
+        for (int i = 0; i < 4; ++i)
+        {
+            container.pushBack(i);
+        }
+    };
+
+    create();
+    writeHeaderField(mPath, begin, 1000u);
+    ASSERT_THROW(CMappedDoublyLinkedList<int> damaged(mPath), std::runtime_error);
+    create();
+    writeHeaderField(mPath, size, 5u);
+    ASSERT_THROW(CMappedDoublyLinkedList<int> damaged(mPath), std::runtime_error);
+    create();
+    writeHeaderField(mPath, used, 1000u);
+    ASSERT_THROW(CMappedDoublyLinkedList<int> damaged(mPath), std::runtime_error);
+
+    // popFront crashed after moving the beginning, before the first item was freed
+    create();
+    writeHeaderField(mPath, begin, 1u);
+    writeHeaderField(mPath, open, 1u, sizeof(uint32_t));
+    {
+        CMappedDoublyLinkedList<int> container(mPath);
+        expectSameValues(container, std::list<int>({1, 2, 3}));
+        container.pushFront(0);
+        // the lost item is reused
+        ASSERT_EQ(container.capacity(), 64u);
+        expectSameValues(container, std::list<int>({0, 1, 2, 3}));
+    }
+
+    // a cycle in the forward links can't be repaired, the items follow the header of 128 bytes
+    create();
+    writeHeaderField(mPath, 128 + 3 * 24 + 8, 0u);
+    writeHeaderField(mPath, open, 1u, sizeof(uint32_t));
+    ASSERT_THROW(CMappedDoublyLinkedList<int> damaged(mPath), std::runtime_error);
+
+    // a consistent file which wasn't closed keeps its list
+    create();
+    writeHeaderField(mPath, open, 1u, sizeof(uint32_t));
+    CMappedDoublyLinkedList<int> container(mPath);
+    expectSameValues(container, std::list<int>({0, 1, 2, 3}));
+    container.pushBack(4);
+    expectSameValues(container, std::list<int>({0, 1, 2, 3, 4}));
+}
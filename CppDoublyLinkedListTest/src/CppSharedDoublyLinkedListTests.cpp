@@ -0,0 +1,362 @@
+#include <include/CppSharedDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/file.h>
+#include <sys/wait.h>
+
+using namespace ::testing;
+
+/**
+ * @brief Test base class. Every test gets its own shared memory, which is removed afterwards.
+ */
+class CSharedContainerTest : public Test
+{
+protected:
+
+    void SetUp() override
+    {
+        mName = "/shared_list_" + std::to_string(getpid()) + "_" + UnitTest::GetInstance()->current_test_info()->name();
+        CSharedDoublyLinkedList<int>::unlink(mName);
+    }
+
+    void TearDown() override
+    {
+        CSharedDoublyLinkedList<int>::unlink(mName);
+    }
+
+    /**
+     * @brief Runs function in a child process and waits for it.
+     * @return Exit status of child, 1 if the function threw.
+     */
+    template<typename TFunction>
+    static int runChild(TFunction aFunction)
+    {
+        const pid_t pid = fork();
+        if (pid == 0)
+        {
+            int status = 0;
+            try
+            {
+                aFunction();
+            }
+            catch (...)
+            {
+                status = 1;
+            }
+            _exit(status);
+        }
+        int status = -1;
+        waitpid(pid, &status, 0);
+        return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+    }
+
+    std::string mName;
+};
+
+/**
+ * Test of queue operations within one process, with two handles of the same list.
+ */
+TEST_F(CSharedContainerTest, singleProcess)
+{
+    CSharedDoublyLinkedList<int> producer(mName, 4u);
+    CSharedDoublyLinkedList<int> consumer(mName, 100u);
+    ASSERT_EQ(consumer.capacity(), 4u);
+    ASSERT_TRUE(consumer.empty());
+    ASSERT_EQ(consumer.popFront(std::chrono::milliseconds(1)), nullptr);
+
+    int* value = producer.allocate();
+    *value = 1;
+    producer.pushBack(value);
+    ASSERT_THROW(producer.pushBack(value), std::invalid_argument);
+    producer.pushBack(2);
+    producer.pushBack(3);
+    int* unused = producer.allocate(std::chrono::nanoseconds(0));
+    ASSERT_NE(unused, nullptr);
+    ASSERT_EQ(producer.allocate(std::chrono::milliseconds(1)), nullptr);
+    producer.release(unused);
+    ASSERT_EQ(consumer.size(), 3u);
+
+    for (int expected = 1; expected <= 3; ++expected)
+    {
+        int* popped = consumer.popFront();
+        ASSERT_EQ(*popped, expected);
+        ASSERT_THROW(consumer.pushBack(popped), std::invalid_argument);
+        consumer.release(popped);
+        ASSERT_THROW(consumer.release(popped), std::invalid_argument);
+    }
+    ASSERT_TRUE(consumer.empty());
+    int local = 0;
+    ASSERT_THROW(consumer.release(&local), std::invalid_argument);
+    ASSERT_EQ(consumer.reclaim(), 0u);
+
+    ASSERT_THROW(CSharedDoublyLinkedList<double> wrongType(mName, 4u), std::runtime_error);
+    ASSERT_THROW(CSharedDoublyLinkedList<int> noCapacity(mName + "_new", 0u), std::length_error);
+    ASSERT_TRUE(CSharedDoublyLinkedList<int>::unlink(mName));
+    ASSERT_FALSE(CSharedDoublyLinkedList<int>::unlink(mName));
+}
+
+/**
+ * Test that values pushed by one process are popped by another one in order, with waiting on both sides.
+ */
+TEST_F(CSharedContainerTest, twoProcesses)
+{
+    const int count = 20000;
+    CSharedDoublyLinkedList<int> consumer(mName, 16u);
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        int status = 0;
+        try
+        {
+            CSharedDoublyLinkedList<int> producer(mName, 16u);
+            for (int i = 0; i < count; ++i)
+            {
+                int* value = producer.allocate();
+                *value = i;
+                producer.pushBack(value);
+            }
+        }
+        catch (...)
+        {
+            status = 1;
+        }
+        _exit(status);
+    }
+    for (int i = 0; i < count; ++i)
+    {
+        int* value = consumer.popFront(std::chrono::seconds(10));
+        ASSERT_NE(value, nullptr);
+        ASSERT_EQ(*value, i);
+        consumer.release(value);
+    }
+    int status = -1;
+    waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    ASSERT_TRUE(consumer.empty());
+}
+
+/**
+ * Test that items held by a dead process are reclaimed: allocated items are freed, popped items are queued again.
+ */
+TEST_F(CSharedContainerTest, deadPeerItems)
+{
+    CSharedDoublyLinkedList<int> list(mName, 4u);
+    for (int i = 0; i < 3; ++i)
+    {
+        list.pushBack(i);
+    }
+    ASSERT_EQ(runChild([this]()
+    {
+        CSharedDoublyLinkedList<int> peer(mName, 4u);
+        peer.allocate();
+        peer.popFront();
+        peer.popFront();
+        // dies holding three items
+    }), 0);
+    ASSERT_EQ(list.size(), 1u);
+    ASSERT_EQ(list.reclaim(), 3u);
+    std::vector<int> values;
+    for (int i = 0; i < 3; ++i)
+    {
+        int* value = list.popFront();
+        values.push_back(*value);
+        list.release(value);
+    }
+    ASSERT_EQ(values, std::vector<int>({0, 1, 2}));
+
+    // a waiting process reclaims items by itself
+    ASSERT_EQ(runChild([this]()
+    {
+        CSharedDoublyLinkedList<int> peer(mName, 4u);
+        for (int i = 0; i < 4; ++i)
+        {
+            peer.allocate();
+        }
+    }), 0);
+    int* value = list.allocate(std::chrono::seconds(5));
+    ASSERT_NE(value, nullptr);
+    list.release(value);
+}
+
+/**
+ * Test that processes holding items are registered with the number of their items, that items are looked
+ * through only for a registered dead process, and that items of processes beyond the registry are reclaimed too.
+ */
+TEST_F(CSharedContainerTest, ownerRegistry)
+{
+    using DoublyLinkedListShared::cMaxOwners;
+    using DoublyLinkedListShared::cOverflow;
+    CSharedDoublyLinkedList<int> list(mName, 8u);
+    const int fd = shm_open(mName.c_str(), O_RDWR, 0);
+    void* mapping = mmap(nullptr, sizeof(DoublyLinkedListShared::CHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    ASSERT_NE(mapping, MAP_FAILED);
+    auto* owners = static_cast<DoublyLinkedListShared::CHeader*>(mapping)->mOwners;
+    // slot holding items of other processes, cMaxOwners if there isn't any
+    const auto otherSlot = [owners]()
+    {
+        uint32_t slot = 0;
+        while ((slot < cMaxOwners) && ((owners[slot].mHeld == 0u) || (owners[slot].mPid == getpid())))
+        {
+            ++slot;
+        }
+        return slot;
+    };
+
+    int* value = list.allocate();
+    *value = 7;
+    ASSERT_EQ(owners[0].mPid, getpid());
+    ASSERT_EQ(owners[0].mHeld, 1u);
+    list.pushBack(value);
+    ASSERT_EQ(owners[0].mHeld, 0u);
+
+    ASSERT_EQ(runChild([this]()
+    {
+        CSharedDoublyLinkedList<int> peer(mName, 8u);
+        peer.allocate();
+        peer.popFront();
+        // dies holding two items
+    }), 0);
+    const uint32_t slot = otherSlot();
+    ASSERT_LT(slot, cMaxOwners);
+    ASSERT_EQ(owners[slot].mHeld, 2u);
+
+    // items of a process which isn't registered as dead aren't looked for
+    const DoublyLinkedListShared::COwner dead = owners[slot];
+    owners[slot].mHeld = 0u;
+    ASSERT_EQ(list.reclaim(), 0u);
+    owners[slot] = dead;
+    ASSERT_EQ(list.reclaim(), 2u);
+    ASSERT_EQ(otherSlot(), cMaxOwners);
+    ASSERT_EQ(list.size(), 1u);
+
+    // with all slots taken, items are counted in the overflow slot and found by looking through all items
+    for (uint32_t i = 0; i < cMaxOwners; ++i)
+    {
+        owners[i] = {getpid(), 0u, 1u};
+    }
+    ASSERT_EQ(runChild([this]()
+    {
+        CSharedDoublyLinkedList<int> peer(mName, 8u);
+        peer.allocate();
+    }), 0);
+    ASSERT_EQ(owners[cOverflow].mHeld, 1u);
+    ASSERT_EQ(list.reclaim(), 1u);
+    ASSERT_EQ(owners[cOverflow].mHeld, 0u);
+    for (uint32_t i = 0; i < cMaxOwners; ++i)
+    {
+        owners[i] = {0, 0u, 0u};
+    }
+
+    value = list.popFront();
+    ASSERT_EQ(*value, 7);
+    list.release(value);
+    ASSERT_EQ(list.reclaim(), 0u);
+    munmap(mapping, sizeof(DoublyLinkedListShared::CHeader));
+}
+
+/**
+ * Test that a change of a process which died holding the mutex is rolled back.
+ */
+TEST_F(CSharedContainerTest, deadPeerHoldingMutex)
+{
+    CSharedDoublyLinkedList<int> list(mName, 8u);
+    for (int i = 0; i < 5; ++i)
+    {
+        list.pushBack(i);
+    }
+    ASSERT_EQ(runChild([this]()
+    {
+        const int fd = shm_open(mName.c_str(), O_RDWR, 0);
+        void* mapping = mmap(nullptr, sizeof(DoublyLinkedListShared::CHeader), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        auto* header = static_cast<DoublyLinkedListShared::CHeader*>(mapping);
+        pthread_mutex_lock(&header->mMutex);
+        // a change is started and left half done
+        header->mJournal.mState = header->mState;
+        header->mJournal.mIndices[0] = DoublyLinkedListShared::cNull;
+        header->mJournal.mIndices[1] = DoublyLinkedListShared::cNull;
+        header->mJournal.mOwnerSlot = DoublyLinkedListShared::cNoSlot;
+        header->mJournal.mActive = 1u;
+        header->mState.mBegin = 1234567u;
+        header->mState.mSize = 0u;
+    }), 0);
+
+    ASSERT_EQ(list.size(), 5u);
+    for (int i = 0; i < 5; ++i)
+    {
+        int* value = list.popFront();
+        ASSERT_EQ(*value, i);
+        list.release(value);
+    }
+    list.pushBack(5);
+    ASSERT_EQ(list.size(), 1u);
+}
+
+/**
+ * Test that a list left uninitialized by a creator which was killed is initialized again,
+ * also by a process which was waiting for the creator.
+ */
+TEST_F(CSharedContainerTest, deadCreator)
+{
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    const pid_t pid = fork();
+    if (pid == 0)
+    {
+        // starts creating the list the way the list does, and waits to be killed
+        const int fd = shm_open(mName.c_str(), O_RDWR | O_CREAT, 0600);
+        flock(fd, LOCK_EX);
+        const std::size_t size = sizeof(DoublyLinkedListShared::CHeader);
+        if (ftruncate(fd, size) == 0)
+        {
+            void* mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            std::memcpy(static_cast<DoublyLinkedListShared::CHeader*>(mapping)->mMagic, "CDLS", 4u);
+        }
+        const char ready = 1;
+        write(fds[1], &ready, 1u);
+        for (;;)
+        {
+            pause();
+        }
+    }
+    char ready = 0;
+    ASSERT_EQ(read(fds[0], &ready, 1u), 1);
+    close(fds[0]);
+    close(fds[1]);
+
+    // the opener waits for the creator
+    std::thread opener([this]()
+    {
+        CSharedDoublyLinkedList<int> list(mName, 8u);
+        list.pushBack(1);
+    });
+    usleep(20000);
+    kill(pid, SIGKILL);
+    waitpid(pid, nullptr, 0);
+    opener.join();
+
+    CSharedDoublyLinkedList<int> list(mName, 16u);
+    ASSERT_EQ(list.capacity(), 8u);
+    int* value = list.popFront(std::chrono::seconds(1));
+    ASSERT_NE(value, nullptr);
+    ASSERT_EQ(*value, 1);
+    list.release(value);
+
+    // memory which was sized but never initialized
+    CSharedDoublyLinkedList<int>::unlink(mName);
+    const int fd = shm_open(mName.c_str(), O_RDWR | O_CREAT, 0600);
+    ASSERT_EQ(ftruncate(fd, 4096), 0);
+    close(fd);
+    CSharedDoublyLinkedList<int> recreated(mName, 4u);
+    ASSERT_EQ(recreated.capacity(), 4u);
+    ASSERT_TRUE(recreated.empty());
+}
@@ -0,0 +1,303 @@
+#include <include/CppSkipDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Checks that list holds the same values as the reference vector.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+static void expectSameValues(const CSkipDoublyLinkedList<int>& aContainer, const std::vector<int>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    for (unsigned int i = 0; i < aExpected.size(); ++i)
+    {
+        const int* valueActual = aContainer.get(i);
+        ASSERT_NE(valueActual, nullptr);
+        ASSERT_EQ(*valueActual, aExpected[i]);
+    }
+    ASSERT_EQ(aContainer.get(aExpected.size()), nullptr);
+
+    unsigned int i = 0;
+    for (int value : aContainer)
+    {
+        ASSERT_EQ(value, aExpected[i]);
+        ++i;
+    }
+    ASSERT_EQ(i, aExpected.size());
+}
+
+/**
+ * @brief Test base class.
+ */
+class CSkipContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CSkipContainerTest, empty)
+{
+    CSkipDoublyLinkedList<int> container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_EQ(container.get(0), nullptr);
+    ASSERT_THROW(container.popBack(), std::out_of_range);
+    ASSERT_THROW(container.eraseAt(0), std::out_of_range);
+
+    // position 0 inserts also into an empty list, positions behind the end are ignored
+    container.insert(1, 1);
+    ASSERT_TRUE(container.empty());
+    container.insert(0, 2);
+    container.insert(0, 1);
+    expectSameValues(container, {1, 2});
+}
+
+/**
+ * Test for random inserts and removals compared with std::vector.
+ */
+TEST_F(CSkipContainerTest, randomOperations)
+{
+    CSkipDoublyLinkedList<int> container;
+    std::vector<int> expected;
+    std::srand(7);
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        const int operation = std::rand() % 6;
+        const unsigned int index = expected.empty() ? 0u : std::rand() % expected.size();
+        if (operation == 0)
+        {
+            container.pushBack(i);
+            expected.push_back(i);
+        }
+        else if (operation == 1)
+        {
+            container.pushFront(i);
+            expected.insert(expected.begin(), i);
+        }
+        else if ((operation == 2) && !expected.empty())
+        {
+            container.insert(index, i);
+            expected.insert(expected.begin() + index, i);
+        }
+        else if ((operation == 3) && !expected.empty())
+        {
+            ASSERT_EQ(container.eraseAt(index), expected[index]);
+            expected.erase(expected.begin() + index);
+        }
+        else if ((operation == 4) && !expected.empty())
+        {
+            ASSERT_EQ(container.popBack(), expected.back());
+            expected.pop_back();
+        }
+        else if (!expected.empty())
+        {
+            ASSERT_EQ(container.popFront(), expected.front());
+            expected.erase(expected.begin());
+        }
+
+        if (!expected.empty())
+        {
+            const unsigned int probe = std::rand() % expected.size();
+            ASSERT_EQ(*container.get(probe), expected[probe]);
+        }
+        if (i % 100 == 0)
+        {
+            expectSameValues(container, expected);
+        }
+    }
+    expectSameValues(container, expected);
+}
+
+/**
+ * Test for move construction and assignment, moved lists keep their express lanes.
+ */
+TEST_F(CSkipContainerTest, move)
+{
+    CSkipDoublyLinkedList<int> source;
+    std::vector<int> expected;
+    for (int i = 0; i < 1000; ++i)
+    {
+        source.pushBack(i);
+        expected.push_back(i);
+    }
+
+    CSkipDoublyLinkedList<int> moved(std::move(source));
+    expectSameValues(moved, expected);
+    expectSameValues(source, {});
+
+    moved.insert(500, -1);
+    expected.insert(expected.begin() + 500, -1);
+    moved.eraseAt(10);
+    expected.erase(expected.begin() + 10);
+    expectSameValues(moved, expected);
+
+    source.pushBack(7);
+    source = std::move(moved);
+    expectSameValues(source, expected);
+    expectSameValues(moved, {});
+
+    // moved-from list is usable again
+    moved.pushFront(3);
+    moved.pushBack(4);
+    expectSameValues(moved, {3, 4});
+}
+
+/**
+ * Test for reverse iteration.
+ */
+TEST_F(CSkipContainerTest, reverseIterator)
+{
+    CSkipDoublyLinkedList<int> container;
+    ASSERT_TRUE(container.rbegin() == container.rend());
+    for (int i = 0; i < 100; ++i)
+    {
+        container.pushFront(i);
+    }
+
+    int expected = 0;
+    for (auto it = container.rbegin(); it != container.rend(); ++it)
+    {
+        ASSERT_EQ(*it, expected);
+        ++expected;
+    }
+    ASSERT_EQ(expected, 100);
+}
+
+/**
+ * Test for values moved into the list or constructed in place.
+ */
+TEST_F(CSkipContainerTest, emplace)
+{
+    CSkipDoublyLinkedList<std::string> container;
+    std::string value(100, 'b');
+    container.pushBack(std::move(value));
+    ASSERT_TRUE(value.empty());
+    value.assign(100, 'a');
+    container.pushFront(std::move(value));
+    ASSERT_TRUE(value.empty());
+    ASSERT_EQ(container.emplaceBack(3u, 'd'), "ddd");
+    ASSERT_EQ(container.emplaceFront(2u, 'x'), "xx");
+    value = "c";
+    container.insert(3, std::move(value));
+
+    const std::vector<std::string> expected = {"xx", std::string(100, 'a'), std::string(100, 'b'), "c", "ddd"};
+    ASSERT_EQ(container.size(), expected.size());
+    for (unsigned int i = 0; i < expected.size(); ++i)
+    {
+        ASSERT_EQ(*container.get(i), expected[i]);
+    }
+}
+
+/**
+ * @brief Base class for GoogleTest parametrized tests.
+ */
+class CSkipContainerParamTest : public TestWithParam<unsigned int>
+{
+};
+
+/**
+ * Tests for many pushBack and popBack.
+ */
+TEST_P(CSkipContainerParamTest, pushBack_popBack)
+{
+    const unsigned int& size = GetParam();
+    CSkipDoublyLinkedList<int> container;
+    std::vector<int> expected;
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i + 1);
+        expected.push_back(i + 1);
+        ASSERT_TRUE(container.contains(i + 1));
+    }
+    expectSameValues(container, expected);
+
+    for (unsigned int i = size; i > 0; --i)
+    {
+        ASSERT_EQ(container.popBack(), static_cast<int>(i));
+        expected.pop_back();
+        expectSameValues(container, expected);
+    }
+}
+
+/**
+ * Test for many pushFont, popFront
+ */
+TEST_P(CSkipContainerParamTest, pushFront_popFront)
+{
+    const unsigned int& size = GetParam();
+    CSkipDoublyLinkedList<int> container;
+    std::vector<int> expected;
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushFront(i + 1);
+        expected.insert(expected.begin(), i + 1);
+    }
+    expectSameValues(container, expected);
+
+    for (unsigned int i = size; i > 0; --i)
+    {
+        ASSERT_EQ(container.popFront(), static_cast<int>(i));
+        expected.erase(expected.begin());
+        expectSameValues(container, expected);
+    }
+}
+
+/**
+ * Test for insert and eraseAt methods.
+ */
+TEST_P(CSkipContainerParamTest, insert_eraseAt)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        CSkipDoublyLinkedList<int> container;
+        std::vector<int> expected;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+            expected.push_back(i);
+        }
+
+        const int valueExpected = (j + size + 100);
+        container.insert(j, valueExpected);
+        expected.insert(expected.begin() + j, valueExpected);
+        expectSameValues(container, expected);
+
+        ASSERT_EQ(container.eraseAt(j + 1u), expected[j + 1u]);
+        expected.erase(expected.begin() + j + 1u);
+        expectSameValues(container, expected);
+
+        CSkipDoublyLinkedList<int> containerCopy(container);
+        ASSERT_TRUE(containerCopy == container);
+    }
+}
+
+/**
+ * @brief Function to display name of tests.
+ * @param aInfo Param info.
+ * @return Label
+ */
+static std::string customSkipMessage(testing::TestParamInfo<unsigned int> aInfo)
+{
+    std::stringstream ss;
+    ss<<"Size_"<<aInfo.param;
+    return ss.str();
+};
+
+INSTANTIATE_TEST_CASE_P(ParamTest_Values,
+                        CSkipContainerParamTest,
+                        Range(2u, 40u, 1u),
+                        customSkipMessage);
@@ -0,0 +1,204 @@
+#include <include/CppSpscDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Allocator which counts allocations.
+ */
+template<typename T>
+struct CCountingAllocator
+{
+    using value_type = T;
+
+    explicit CCountingAllocator(std::size_t* aCount)
+        : mCount(aCount)
+    {}
+
+    template<typename TOther>
+    CCountingAllocator(const CCountingAllocator<TOther>& aObj)
+        : mCount(aObj.mCount)
+    {}
+
+    T* allocate(std::size_t aSize)
+    {
+        ++*mCount;
+        return std::allocator<T>().allocate(aSize);
+    }
+
+    void deallocate(T* aPtr, std::size_t aSize)
+    {
+        std::allocator<T>().deallocate(aPtr, aSize);
+    }
+
+    bool operator==(const CCountingAllocator& aObj) const
+    {
+        return (mCount == aObj.mCount);
+    }
+
+    bool operator!=(const CCountingAllocator& aObj) const
+    {
+        return !(*this == aObj);
+    }
+
+    std::size_t* mCount;
+};
+
+/**
+ * @brief Test base class.
+ */
+class CSpscContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CSpscContainerTest, empty)
+{
+    CSpscDoublyLinkedList<int> container;
+    int value = 7;
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.tryPopFront(value));
+    ASSERT_EQ(container.popFront(&value, 4u), 0u);
+    ASSERT_EQ(value, 7);
+}
+
+/**
+ * Test for order of values and batch operations, from one thread.
+ */
+TEST_F(CSpscContainerTest, batches)
+{
+    CSpscDoublyLinkedList<std::string> container;
+    std::vector<std::string> values;
+    for (int i = 0; i < 10; ++i)
+    {
+        values.push_back("value number " + std::to_string(i));
+    }
+
+    container.pushBack(values[0]);
+    container.pushBack(values.begin() + 1, values.end() - 1);
+    container.emplaceBack(values[9]);
+    ASSERT_FALSE(container.empty());
+
+    std::string out[4];
+    ASSERT_EQ(container.popFront(out, 4u), 4u);
+    for (int i = 0; i < 4; ++i)
+    {
+        ASSERT_EQ(out[i], values[i]);
+    }
+    ASSERT_TRUE(container.tryPopFront(out[0]));
+    ASSERT_EQ(out[0], values[4]);
+    ASSERT_EQ(container.popFront(out, 4u), 4u);
+    ASSERT_EQ(out[3], values[8]);
+    ASSERT_EQ(container.popFront(out, 4u), 1u);
+    ASSERT_EQ(out[0], values[9]);
+    ASSERT_TRUE(container.empty());
+
+    // remaining values are destroyed by the container
+    container.pushBack(values.begin(), values.end());
+}
+
+/**
+ * Test that consumed items are reused, so steady state does not allocate.
+ */
+TEST_F(CSpscContainerTest, reuseItems)
+{
+    std::size_t allocations = 0;
+    CSpscDoublyLinkedList<int, CCountingAllocator<int>> container{CCountingAllocator<int>(&allocations)};
+    int values[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+    int out[8];
+
+    container.pushBack(values, values + 8);
+    ASSERT_EQ(container.popFront(out, 8u), 8u);
+    const std::size_t warm = allocations;
+    for (int round = 0; round < 100; ++round)
+    {
+        container.pushBack(values, values + 8);
+        ASSERT_EQ(container.popFront(out, 8u), 8u);
+        ASSERT_EQ(out[7], 7);
+    }
+    ASSERT_EQ(allocations, warm);
+}
+
+/**
+ * Test that batch push adds nothing if a value throws.
+ */
+TEST_F(CSpscContainerTest, throwingBatch)
+{
+    struct CThrowing
+    {
+        CThrowing(int aValue)
+            : mValue(aValue)
+        {
+            if (aValue < 0)
+            {
+                throw std::runtime_error("negative");
+            }
+        }
+        CThrowing() = default;
+        int mValue = 0;
+    };
+
+    CSpscDoublyLinkedList<CThrowing> container;
+    const int values[3] = {1, -1, 2};
+    ASSERT_THROW(container.pushBack(values, values + 3), std::runtime_error);
+    ASSERT_TRUE(container.empty());
+    container.pushBack(values + 2, values + 3);
+    CThrowing out;
+    ASSERT_TRUE(container.tryPopFront(out));
+    ASSERT_EQ(out.mValue, 2);
+}
+
+/**
+ * Test for producer and consumer threads. Values have to arrive in order.
+ */
+TEST_F(CSpscContainerTest, producerConsumer)
+{
+    const int count = 200000;
+    CSpscDoublyLinkedList<std::string> container;
+
+    std::thread producer([&container, count]()
+    {
+        std::vector<std::string> batch;
+        for (int i = 0; i < count; )
+        {
+            if ((i % 3) == 0)
+            {
+                container.pushBack(std::to_string(i++));
+                continue;
+            }
+            batch.clear();
+            for (int j = 0; (j < 5) && (i < count); ++j)
+            {
+                batch.push_back(std::to_string(i++));
+            }
+            container.pushBack(batch.begin(), batch.end());
+        }
+    });
+
+    std::string out[7];
+    int expected = 0;
+    while (expected < count)
+    {
+        const std::size_t taken = container.popFront(out, 7u);
+        for (std::size_t i = 0; i < taken; ++i)
+        {
+            ASSERT_EQ(out[i], std::to_string(expected++));
+        }
+        if (taken == 0)
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+    ASSERT_TRUE(container.empty());
+}
@@ -0,0 +1,137 @@
+#include <include/CppStaticDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <list>
+#include <type_traits>
+
+using namespace ::testing;
+
+/**
+ * @brief Table built at compile time.
+ */
+constexpr CStaticDoublyLinkedList<int, 8> cTable = []()
+{
+    CStaticDoublyLinkedList<int, 8> table{2, 3};
+    table.pushFront(1);
+    table.pushBack(5);
+    table.insert(3u, 4);
+    table.popFront();
+    table.pushFront(0);
+    return table;
+}();
+
+static_assert(cTable.size() == 5u, "Table is built at compile time");
+static_assert(*cTable.get(0) == 0, "Table is built at compile time");
+static_assert(*cTable.get(4) == 5, "Table is built at compile time");
+static_assert(cTable.contains(4) && !cTable.contains(1), "Table is built at compile time");
+static_assert(*--cTable.end() == 5, "Table is built at compile time");
+
+/**
+ * @brief Test base class.
+ */
+class CStaticContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container and properties of the type.
+ */
+TEST_F(CStaticContainerTest, empty)
+{
+    CStaticDoublyLinkedList<int, 4> container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.full());
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_EQ(container.get(0), nullptr);
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_TRUE(container.rbegin() == container.rend());
+
+    // links take the smallest type which fits the capacity
+    ASSERT_EQ(sizeof(CStaticDoublyLinkedList<uint8_t, 16>), 16u * 3u + 5u * sizeof(uint32_t));
+    ASSERT_EQ(sizeof(CStaticDoublyLinkedList<uint16_t, 1000>), 1000u * 6u + 5u * sizeof(uint32_t));
+    ASSERT_TRUE(noexcept(container.pushBack(1)));
+    ASSERT_TRUE(noexcept(container.popFront()));
+    ASSERT_TRUE((std::is_nothrow_copy_constructible<CStaticDoublyLinkedList<int, 4>>::value));
+}
+
+/**
+ * Test that nothing is added to a full list.
+ */
+TEST_F(CStaticContainerTest, full)
+{
+    CStaticDoublyLinkedList<int, 3> container;
+    ASSERT_TRUE(container.pushBack(1));
+    ASSERT_TRUE(container.emplaceFront(0));
+    ASSERT_TRUE(container.pushBack(2));
+    ASSERT_TRUE(container.full());
+    ASSERT_FALSE(container.pushBack(3));
+    ASSERT_FALSE(container.pushFront(3));
+    ASSERT_FALSE(container.emplaceBack(3));
+    ASSERT_FALSE(container.insert(1u, 3));
+    ASSERT_TRUE((container == CStaticDoublyLinkedList<int, 3>{0, 1, 2}));
+
+    ASSERT_EQ(container.eraseAt(1u), 1);
+    ASSERT_TRUE(container.insert(1u, 5));
+    ASSERT_FALSE(container.assign({1, 2, 3, 4}));
+    ASSERT_TRUE((container == CStaticDoublyLinkedList<int, 3>{1, 2, 3}));
+}
+
+/**
+ * Test for random operations compared with std::list.
+ */
+TEST_F(CStaticContainerTest, randomOperations)
+{
+    CStaticDoublyLinkedList<int, 300> container;
+    std::list<int> expected;
+    std::srand(11);
+
+    for (int i = 0; i < 20000; ++i)
+    {
+        const int operation = std::rand() % 6;
+        const unsigned int index = expected.empty() ? 0u : std::rand() % expected.size();
+        if ((operation == 0) || (operation == 1))
+        {
+            const bool added = (operation == 0) ? container.pushBack(i) : container.pushFront(i);
+            ASSERT_EQ(added, expected.size() < container.capacity());
+            if (added)
+            {
+                (operation == 0) ? expected.push_back(i) : expected.push_front(i);
+            }
+        }
+        else if (expected.empty())
+        {
+            continue;
+        }
+        else if (operation == 2)
+        {
+            ASSERT_EQ(container.popBack(), expected.back());
+            expected.pop_back();
+        }
+        else if (operation == 3)
+        {
+            ASSERT_EQ(container.popFront(), expected.front());
+            expected.pop_front();
+        }
+        else if (operation == 4)
+        {
+            if (container.insert(index, i))
+            {
+                expected.insert(std::next(expected.begin(), index), i);
+            }
+        }
+        else
+        {
+            ASSERT_EQ(*container.get(index), *std::next(expected.begin(), index));
+            ASSERT_EQ(container.eraseAt(index), *std::next(expected.begin(), index));
+            expected.erase(std::next(expected.begin(), index));
+        }
+    }
+    ASSERT_EQ(container.size(), expected.size());
+    ASSERT_TRUE(std::equal(container.begin(), container.end(), expected.begin(), expected.end()));
+    ASSERT_TRUE(std::equal(container.rbegin(), container.rend(), expected.rbegin(), expected.rend()));
+}
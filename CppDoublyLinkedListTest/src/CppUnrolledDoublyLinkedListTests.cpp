@@ -0,0 +1,343 @@
+#include <include/CppUnrolledDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <climits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Unrolled list with small nodes, so splitting and merging happens often.
+ */
+using CSmallNodeList = CUnrolledDoublyLinkedList<int, 4u>;
+
+/**
+ * @brief Checks that list holds the same values as the reference vector.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+static void expectSameValues(const CSmallNodeList& aContainer, const std::vector<int>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    for (unsigned int i = 0; i < aExpected.size(); ++i)
+    {
+        const int* valueActual = aContainer.get(i);
+        ASSERT_NE(valueActual, nullptr);
+        ASSERT_EQ(*valueActual, aExpected[i]);
+    }
+    ASSERT_EQ(aContainer.get(aExpected.size()), nullptr);
+
+    unsigned int i = 0;
+    for (CSmallNodeList::DIterator it = aContainer.begin(); it != aContainer.end(); ++it, ++i)
+    {
+        ASSERT_EQ(*it, aExpected[i]);
+    }
+    ASSERT_EQ(i, aExpected.size());
+
+    for (CSmallNodeList::DReverseIterator rit = aContainer.rbegin(); rit != aContainer.rend(); ++rit)
+    {
+        --i;
+        ASSERT_EQ(*rit, aExpected[i]);
+    }
+    ASSERT_EQ(i, 0u);
+}
+
+/**
+ * @brief Test base class.
+ */
+class CUnrolledContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CUnrolledContainerTest, empty)
+{
+    CSmallNodeList container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_EQ(container.get(0), nullptr);
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_TRUE(container.rbegin() == container.rend());
+    ASSERT_THROW(container.popBack(), std::out_of_range);
+    ASSERT_THROW(container.popFront(), std::out_of_range);
+}
+
+/**
+ * Test for items which are not trivially copyable.
+ */
+TEST_F(CUnrolledContainerTest, strings)
+{
+    CUnrolledDoublyLinkedList<std::string, 3u> container;
+    for (int i = 0; i < 10; ++i)
+    {
+        container.pushBack(std::to_string(i));
+    }
+    container.insert(5, "inserted");
+    ASSERT_EQ(*container.get(5), "inserted");
+    ASSERT_EQ(container.eraseAt(5), "inserted");
+    ASSERT_EQ(container.popFront(), "0");
+    ASSERT_EQ(container.popBack(), "9");
+    ASSERT_TRUE(container.contains("4"));
+    ASSERT_EQ(container.size(), 8u);
+}
+
+/**
+ * @brief Base class for GoogleTest parametrized tests.
+ */
+class CUnrolledContainerParamTest : public TestWithParam<unsigned int>
+{
+};
+
+/**
+ * Tests for many pushBack and popBack.
+ */
+TEST_P(CUnrolledContainerParamTest, pushBack_popBack)
+{
+    const unsigned int& size = GetParam();
+    CSmallNodeList container;
+    std::vector<int> expected;
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushBack(i + 1);
+        expected.push_back(i + 1);
+        ASSERT_TRUE(container.contains(i + 1));
+        ASSERT_FALSE(container.contains(i + 10000));
+    }
+    expectSameValues(container, expected);
+
+    for (unsigned int i = size; i > 0; --i)
+    {
+        ASSERT_EQ(container.popBack(), static_cast<int>(i));
+        expected.pop_back();
+        expectSameValues(container, expected);
+    }
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for many pushFont, popFront
+ */
+TEST_P(CUnrolledContainerParamTest, pushFront_popFront)
+{
+    const unsigned int& size = GetParam();
+    CSmallNodeList container;
+    std::vector<int> expected;
+
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        container.pushFront(i + 1);
+        expected.insert(expected.begin(), i + 1);
+    }
+    expectSameValues(container, expected);
+
+    for (unsigned int i = size; i > 0; --i)
+    {
+        ASSERT_EQ(container.popFront(), static_cast<int>(i));
+        expected.erase(expected.begin());
+        expectSameValues(container, expected);
+    }
+    ASSERT_TRUE(container.empty());
+}
+
+/**
+ * Test for insert and eraseAt methods, which split and merge nodes.
+ */
+TEST_P(CUnrolledContainerParamTest, insert_eraseAt)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        CSmallNodeList container;
+        std::vector<int> expected;
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            container.pushBack(i);
+            expected.push_back(i);
+        }
+
+        const int valueExpected = (j + size + 100);
+        container.insert(j, valueExpected);
+        expected.insert(expected.begin() + j, valueExpected);
+        expectSameValues(container, expected);
+
+        container.insert(j, valueExpected + 1);
+        expected.insert(expected.begin() + j, valueExpected + 1);
+        expectSameValues(container, expected);
+
+        for (unsigned int k = 0; k < size / 2u; ++k)
+        {
+            const unsigned int index = (j + k) % expected.size();
+            ASSERT_EQ(container.eraseAt(index), expected[index]);
+            expected.erase(expected.begin() + index);
+            expectSameValues(container, expected);
+        }
+    }
+}
+
+/**
+ * Test for copy constructor, assignment and compare operators.
+ */
+TEST_P(CUnrolledContainerParamTest, ruleOf3)
+{
+    const unsigned int& size = GetParam(); // get param value
+
+    CSmallNodeList containerA1;
+    CSmallNodeList containerB1;
+    for (unsigned int j = 0; j < size; ++j)
+    {
+        containerA1.pushBack(j);
+        containerB1.pushBack(100 * j + 999);
+    }
+
+    ASSERT_TRUE(containerA1 == containerA1);
+    ASSERT_TRUE(containerA1 != containerB1);
+
+    CSmallNodeList containerC1(containerA1);
+    ASSERT_TRUE(containerA1 == containerC1);
+
+    CSmallNodeList containerD1;
+    containerD1 = containerA1;
+    ASSERT_TRUE(containerA1 == containerD1);
+
+    const CSmallNodeList::DIterator calculatedLast = containerA1.begin() + (size - 1);
+    ASSERT_EQ(*calculatedLast, *containerA1.rbegin());
+    ASSERT_EQ(*(calculatedLast - (size - 1)), *containerA1.begin());
+}
+
+/**
+ * @brief Value which counts its instances and can be made to throw on copy or move assignment.
+ */
+struct CFragileValue
+{
+    explicit CFragileValue(int aValue)
+        : mValue(aValue)
+    {
+        sLive++;
+    }
+
+    CFragileValue(const CFragileValue& aOther)
+        : mValue(aOther.mValue)
+    {
+        if (sCopiesLeft-- == 0)
+        {
+            throw std::runtime_error("copy");
+        }
+        sLive++;
+    }
+
+    CFragileValue(CFragileValue&& aOther)
+        : mValue(aOther.mValue)
+    {
+        sLive++;
+    }
+
+    CFragileValue& operator=(CFragileValue&& aOther)
+    {
+        if (sMovesLeft-- == 0)
+        {
+            throw std::runtime_error("move");
+        }
+        mValue = aOther.mValue;
+        return *this;
+    }
+
+    ~CFragileValue()
+    {
+        sLive--;
+    }
+
+    int mValue;
+
+    static int sCopiesLeft;
+    static int sMovesLeft;
+    static int sLive;
+};
+
+int CFragileValue::sCopiesLeft = INT_MAX;
+int CFragileValue::sMovesLeft = INT_MAX;
+int CFragileValue::sLive = 0;
+
+/**
+ * Test that a throwing copy or move leaves the list unchanged and leaks no value.
+ */
+TEST_P(CUnrolledContainerParamTest, exceptionSafety)
+{
+    const unsigned int& size = GetParam(); // get param value
+    using CFragileList = CUnrolledDoublyLinkedList<CFragileValue, 4u>;
+    const auto check = [](const CFragileList& aContainer, const std::vector<int>& aExpected)
+    {
+        ASSERT_EQ(aContainer.size(), aExpected.size());
+        // values of the list and the value failing to be copied
+        ASSERT_EQ(CFragileValue::sLive, static_cast<int>(aExpected.size()) + 1);
+        unsigned int i = 0;
+        for (const CFragileValue& value : aContainer)
+        {
+            ASSERT_EQ(value.mValue, aExpected[i++]);
+        }
+        ASSERT_EQ(i, aExpected.size());
+    };
+
+    {
+        CFragileList container;
+        std::vector<int> expected;
+        const CFragileValue failing(-1);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            // a new node is needed whenever the end node is full
+            CFragileValue::sCopiesLeft = 0;
+            ASSERT_THROW(container.pushBack(failing), std::runtime_error);
+            CFragileValue::sCopiesLeft = 0;
+            ASSERT_THROW(container.pushFront(failing), std::runtime_error);
+            CFragileValue::sCopiesLeft = INT_MAX;
+            check(container, expected);
+
+            container.pushBack(CFragileValue(i));
+            expected.push_back(i);
+        }
+        check(container, expected);
+
+        for (unsigned int index = 1; index < size; ++index)
+        {
+            CFragileValue::sCopiesLeft = 0;
+            ASSERT_THROW(container.insert(index, failing), std::runtime_error);
+            CFragileValue::sCopiesLeft = INT_MAX;
+            // shifted items are moved back
+            CFragileValue::sMovesLeft = 0;
+            ASSERT_THROW(container.insert(index, failing), std::runtime_error);
+            CFragileValue::sMovesLeft = INT_MAX;
+            check(container, expected);
+        }
+
+        // values copied before the throwing one are destroyed with the partial copy
+        CFragileValue::sCopiesLeft = size / 2u;
+        ASSERT_THROW(CFragileList copy(container), std::runtime_error);
+        CFragileValue::sCopiesLeft = INT_MAX;
+        check(container, expected);
+    }
+    ASSERT_EQ(CFragileValue::sLive, 0);
+}
+
+/**
+ * @brief Function to display name of tests.
+ * @param aInfo Param info.
+ * @return Label
+ */
+static std::string customUnrolledMessage(testing::TestParamInfo<unsigned int> aInfo)
+{
+    std::stringstream ss;
+    ss<<"Size_"<<aInfo.param;
+    return ss.str();
+};
+
+INSTANTIATE_TEST_CASE_P(ParamTest_Values,
+                        CUnrolledContainerParamTest,
+                        Range(2u, 20u, 1u),
+                        customUnrolledMessage);
@@ -0,0 +1,184 @@
+#include <include/CppXorDoublyLinkedList.hpp>
+#include <include/CppDoublyLinkedList.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <deque>
+#include <memory_resource>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace ::testing;
+
+/**
+ * @brief Checks that list holds the same values as the reference deque, in both directions.
+ * @param aContainer List to check.
+ * @param aExpected Reference values.
+ */
+template<typename T>
+static void expectSameValues(const CXorDoublyLinkedList<T>& aContainer, const std::deque<T>& aExpected)
+{
+    ASSERT_EQ(aContainer.size(), aExpected.size());
+    auto expected = aExpected.begin();
+    for (auto it = aContainer.begin(); it != aContainer.end(); ++it, ++expected)
+    {
+        ASSERT_EQ(*it, *expected);
+    }
+    auto reverse = aExpected.rbegin();
+    for (auto it = aContainer.rbegin(); it != aContainer.rend(); ++it, ++reverse)
+    {
+        ASSERT_EQ(*it, *reverse);
+    }
+    ASSERT_EQ(reverse, aExpected.rend());
+}
+
+/**
+ * @brief Test base class.
+ */
+class CXorContainerTest : public Test
+{
+};
+
+/**
+ * Test for empty container.
+ */
+TEST_F(CXorContainerTest, empty)
+{
+    CXorDoublyLinkedList<int> container;
+    ASSERT_EQ(container.size(), 0u);
+    ASSERT_TRUE(container.empty());
+    ASSERT_FALSE(container.contains(1));
+    ASSERT_TRUE(container.begin() == container.end());
+    ASSERT_TRUE(container.rbegin() == container.rend());
+    ASSERT_THROW(container.popBack(), std::out_of_range);
+    ASSERT_THROW(container.popFront(), std::out_of_range);
+}
+
+/**
+ * Test for random pushes and pops on both ends compared with std::deque.
+ */
+TEST_F(CXorContainerTest, randomOperations)
+{
+    CXorDoublyLinkedList<std::string> container;
+    std::deque<std::string> expected;
+    std::srand(13);
+
+    for (int i = 0; i < 3000; ++i)
+    {
+        const int operation = std::rand() % 4;
+        const std::string value = "value number " + std::to_string(i);
+        if (operation == 0)
+        {
+            container.pushBack(value);
+            expected.push_back(value);
+        }
+        else if (operation == 1)
+        {
+            container.emplaceFront(value);
+            expected.push_front(value);
+        }
+        else if ((operation == 2) && !expected.empty())
+        {
+            ASSERT_EQ(container.popBack(), expected.back());
+            expected.pop_back();
+        }
+        else if (!expected.empty())
+        {
+            ASSERT_EQ(container.popFront(), expected.front());
+            expected.pop_front();
+        }
+        if ((i % 100) == 0)
+        {
+            expectSameValues(container, expected);
+        }
+    }
+    expectSameValues(container, expected);
+    ASSERT_EQ(container.contains(expected.front()), true);
+    ASSERT_EQ(container.contains("missing"), false);
+}
+
+/**
+ * Test for walking in both directions from the middle and from end().
+ */
+TEST_F(CXorContainerTest, bidirectional)
+{
+    CXorDoublyLinkedList<int> container;
+    for (int i = 0; i < 6; ++i)
+    {
+        container.pushBack(i);
+    }
+
+    auto it = container.end();
+    --it;
+    ASSERT_EQ(*it, 5);
+    it--;
+    ASSERT_EQ(*it, 4);
+    ++it;
+    ASSERT_EQ(*it, 5);
+    ++it;
+    ASSERT_TRUE(it == container.end());
+
+    auto reverse = container.rbegin();
+    ++reverse;
+    ++reverse;
+    ASSERT_EQ(*reverse, 3);
+    --reverse;
+    ASSERT_EQ(*reverse, 4);
+}
+
+/**
+ * Test for copy, move and compare.
+ */
+TEST_F(CXorContainerTest, copyMove)
+{
+    CXorDoublyLinkedList<int> container;
+    for (int i = 0; i < 10; ++i)
+    {
+        container.pushFront(i);
+    }
+    CXorDoublyLinkedList<int> copy(container);
+    ASSERT_TRUE(copy == container);
+    copy.popBack();
+    ASSERT_TRUE(copy != container);
+    copy = container;
+    ASSERT_TRUE(copy == container);
+
+    CXorDoublyLinkedList<int> moved(std::move(copy));
+    ASSERT_TRUE(moved == container);
+    ASSERT_TRUE(copy.empty());
+}
+
+/**
+ * Test that an item takes one pointer less than an item of CDoublyLinkedList.
+ */
+TEST_F(CXorContainerTest, itemSize)
+{
+    struct CCountingResource : std::pmr::memory_resource
+    {
+        std::size_t mBytes = 0;
+        void* do_allocate(std::size_t aBytes, std::size_t aAlignment) override
+        {
+            mBytes += aBytes;
+            return std::pmr::new_delete_resource()->allocate(aBytes, aAlignment);
+        }
+        void do_deallocate(void* aPtr, std::size_t aBytes, std::size_t aAlignment) override
+        {
+            std::pmr::new_delete_resource()->deallocate(aPtr, aBytes, aAlignment);
+        }
+        bool do_is_equal(const std::pmr::memory_resource& aOther) const noexcept override
+        {
+            return (this == &aOther);
+        }
+    } xorCounter, listCounter;
+
+    {
+        CXorDoublyLinkedList<void*, std::pmr::polymorphic_allocator<void*>> xorList(&xorCounter);
+        CPmrDoublyLinkedList<void*> list(&listCounter);
+        xorList.pushBack(nullptr);
+        list.pushBack(nullptr);
+    }
+    ASSERT_EQ(xorCounter.mBytes, 2u * sizeof(void*));
+    ASSERT_EQ(listCounter.mBytes, 3u * sizeof(void*));
+}